@@ -6,6 +6,9 @@
 
 #include "Traits.h"
 
+#include <cstring>
+#include <limits>
+#include <memory>
 #include <stdexcept>
 
 #if (!defined ISLITTLEENDIAN)
@@ -71,6 +74,10 @@ public:
     Archive & serialize(unsigned char const *pBuffer, size_t cBuffer);
     template <typename T> Archive & serialize(T const &value);
 
+    /// Serializes a contiguous range of POD values; the data is the same as if
+    /// each item was serialized individually.
+    template <typename T> Archive & serialize_array(T const *pItems, size_t cItems);
+
     ByteArray commit(void);
 
     // Methods valid when `Mode` is `ModeValue::Deserialzing`
@@ -79,10 +86,22 @@ public:
 
     template <typename T> T deserialize(void);
 
+    /// Deserializes a contiguous range of POD values written by `serialize_array`
+    /// (or by serializing each item individually).
+    template <typename T> Archive & deserialize_array(T *pItems, size_t cItems);
+
     bool AtEnd(void) const;
 
+    /// Returns an archive that deserializes the remaining data. The data is shared
+    /// with this archive (rather than copied) when this archive owns its buffer.
     Archive clone(void) const;
 
+    /// Returns an archive that deserializes the next `cBytes` bytes and advances this
+    /// archive past them. The data is shared with this archive when this archive owns
+    /// its buffer and copied otherwise, so the result remains valid after this archive
+    /// (and any buffer that it references) is destroyed.
+    Archive extract(size_t cBytes);
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -91,6 +110,10 @@ private:
     // ----------------------------------------------------------------------
     ByteArray                               _buffer;
 
+    // The data owned by a deserializing archive; shared with archives created by
+    // `clone` and `extract`.
+    std::shared_ptr<ByteArray const>        _pSharedBuffer;
+
     unsigned char const *                   _pBuffer;
     unsigned char const * const             _pEndBuffer;
 
@@ -99,11 +122,19 @@ private:
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    Archive(std::shared_ptr<ByteArray const> pSharedBuffer, unsigned char const *pBuffer, size_t cbBuffer);
+
     template <typename T> Archive & serialize_impl(T const &value, std::true_type);
     template <typename T> Archive & serialize_impl(T const &value, std::false_type);
 
     template <typename T> T deserialize_impl(std::true_type);
     template <typename T> T deserialize_impl(std::false_type);
+
+    template <typename T> Archive & serialize_array_impl(T const *pItems, size_t cItems, std::true_type);
+    template <typename T> Archive & serialize_array_impl(T const *pItems, size_t cItems, std::false_type);
+
+    template <typename T> Archive & deserialize_array_impl(T *pItems, size_t cItems, std::true_type);
+    template <typename T> Archive & deserialize_array_impl(T *pItems, size_t cItems, std::false_type);
 };
 
 // ----------------------------------------------------------------------
@@ -133,9 +164,9 @@ inline Archive::Archive(size_t cReservedSize) :
 
 inline Archive::Archive(ByteArray data) :
     Mode(ModeValue::Deserializing),
-    _buffer(std::move(data)),
-    _pBuffer(_buffer.data()),
-    _pEndBuffer(_pBuffer + _buffer.size()) {
+    _pSharedBuffer(std::make_shared<ByteArray const>(std::move(data))),
+    _pBuffer(_pSharedBuffer->data()),
+    _pEndBuffer(_pBuffer + _pSharedBuffer->size()) {
 }
 
 inline Archive::Archive(unsigned char const *pBuffer, size_t cbBuffer) :
@@ -154,7 +185,7 @@ inline Archive & Archive::serialize(unsigned char const *pBuffer, size_t cBuffer
     if((pBuffer == nullptr && cBuffer != 0) || (pBuffer != nullptr && cBuffer == 0))
         throw std::invalid_argument("Invalid buffer");
 
-    std::copy(pBuffer, pBuffer + cBuffer, std::back_inserter(_buffer));
+    _buffer.insert(_buffer.end(), pBuffer, pBuffer + cBuffer);
 
     return *this;
 }
@@ -164,6 +195,19 @@ Archive & Archive::serialize(T const &value) {
     return serialize_impl(value, std::integral_constant<bool, ISLITTLEENDIAN>());
 }
 
+template <typename T>
+Archive & Archive::serialize_array(T const *pItems, size_t cItems) {
+    static_assert(std::is_pod<T>::value, "T must be a POD");
+
+    if(pItems == nullptr && cItems != 0)
+        throw std::invalid_argument("Invalid items");
+
+    if(cItems == 0)
+        return *this;
+
+    return serialize_array_impl(pItems, cItems, std::integral_constant<bool, ISLITTLEENDIAN>());
+}
+
 inline Archive::ByteArray Archive::commit(void) {
     if(Mode != ModeValue::Serializing)
         throw std::runtime_error("Invalid mode");
@@ -176,6 +220,16 @@ T Archive::deserialize(void) {
     return deserialize_impl<T>(std::integral_constant<bool, ISLITTLEENDIAN>());
 }
 
+template <typename T>
+Archive & Archive::deserialize_array(T *pItems, size_t cItems) {
+    static_assert(std::is_pod<T>::value, "T must be a POD");
+
+    if(pItems == nullptr && cItems != 0)
+        throw std::invalid_argument("Invalid items");
+
+    return deserialize_array_impl(pItems, cItems, std::integral_constant<bool, ISLITTLEENDIAN>());
+}
+
 inline unsigned char const * Archive::get_buffer_ptr(void) const {
     if(Mode != ModeValue::Deserializing)
         throw std::runtime_error("Invalid mode");
@@ -213,9 +267,33 @@ inline Archive Archive::clone(void) const {
     if(_pBuffer == _pEndBuffer)
         throw std::runtime_error("It isn't possible to clone a completed archive");
 
+    if(_pSharedBuffer)
+        return Archive(_pSharedBuffer, _pBuffer, static_cast<size_t>(_pEndBuffer - _pBuffer));
+
     return Archive(ByteArray(_pBuffer, _pEndBuffer));
 }
 
+inline Archive Archive::extract(size_t cBytes) {
+    if(cBytes == 0)
+        throw std::invalid_argument("cBytes");
+
+    unsigned char const * const             pData(get_buffer_ptr());
+
+    update_buffer_ptr(cBytes);
+
+    if(_pSharedBuffer)
+        return Archive(_pSharedBuffer, pData, cBytes);
+
+    return Archive(ByteArray(pData, pData + cBytes));
+}
+
+inline Archive::Archive(std::shared_ptr<ByteArray const> pSharedBuffer, unsigned char const *pBuffer, size_t cbBuffer) :
+    Mode(ModeValue::Deserializing),
+    _pSharedBuffer(std::move(pSharedBuffer)),
+    _pBuffer(pBuffer),
+    _pEndBuffer(_pBuffer + cbBuffer) {
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -255,7 +333,10 @@ T Archive::deserialize_impl(std::true_type) {
     if(static_cast<size_t>(_pEndBuffer - _pBuffer) < sizeof(T))
         throw std::runtime_error("Invalid buffer");
 
-    T                                       value(*reinterpret_cast<T const *>(_pBuffer));
+    // The data isn't necessarily aligned for `T`
+    typename std::remove_const<T>::type     value;
+
+    std::memcpy(&value, _pBuffer, sizeof(T));
 
     _pBuffer += sizeof(T);
     return value;
@@ -266,5 +347,49 @@ T Archive::deserialize_impl(std::false_type) {
     return swap_endian<T>(deserialize_impl<T>(std::true_type()));
 }
 
+template <typename T>
+Archive & Archive::serialize_array_impl(T const *pItems, size_t cItems, std::true_type) {
+    if(cItems > std::numeric_limits<size_t>::max() / sizeof(T))
+        throw std::invalid_argument("Invalid items");
+
+    return serialize(reinterpret_cast<unsigned char const *>(pItems), cItems * sizeof(T));
+}
+
+template <typename T>
+Archive & Archive::serialize_array_impl(T const *pItems, size_t cItems, std::false_type) {
+    T const * const                         pEndItems(pItems + cItems);
+
+    while(pItems != pEndItems)
+        serialize_impl(*pItems++, std::false_type());
+
+    return *this;
+}
+
+template <typename T>
+Archive & Archive::deserialize_array_impl(T *pItems, size_t cItems, std::true_type) {
+    if(Mode != ModeValue::Deserializing)
+        throw std::runtime_error("Invalid mode");
+
+    if(cItems > static_cast<size_t>(_pEndBuffer - _pBuffer) / sizeof(T))
+        throw std::runtime_error("Invalid buffer");
+
+    if(cItems != 0) {
+        std::memcpy(pItems, _pBuffer, cItems * sizeof(T));
+        _pBuffer += cItems * sizeof(T);
+    }
+
+    return *this;
+}
+
+template <typename T>
+Archive & Archive::deserialize_array_impl(T *pItems, size_t cItems, std::false_type) {
+    T * const                               pEndItems(pItems + cItems);
+
+    while(pItems != pEndItems)
+        *pItems++ = deserialize_impl<T>(std::false_type());
+
+    return *this;
+}
+
 } // namespace Featurizer
 } // namespace Microsoft
@@ -8,6 +8,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "Traits.h"
@@ -146,6 +147,17 @@ public:
     TransformedType execute(InputType const &input);
     using BaseType::execute;
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_batch
+    ///  \brief         Transforms `cInput` items into `pOutput`, which must
+    ///                 reference `cInput` constructed items. This results in a
+    ///                 single virtual call for the entire batch; `Transformers`
+    ///                 that don't override `execute_batch_impl` invoke
+    ///                 `execute_impl` for each item. `TransformedType` must be
+    ///                 move assignable.
+    ///
+    void execute_batch(InputType const *pInput, size_t cInput, TransformedType *pOutput);
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -153,6 +165,8 @@ private:
     // |
     // ----------------------------------------------------------------------
     void flush_impl(CallbackFunction const &callback) override;
+
+    virtual void execute_batch_impl(InputType const *pInput, size_t cInput, TransformedType *pOutput);
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -199,6 +213,20 @@ struct RawStringComparison {
     inline bool operator()(char const *p1, char const *p2) const { return strcmp(p1, p2) < 0; }
 };
 
+// Assigns a value to an item in a batch's output. `StandardTransformer::execute_batch`
+// only accepts types that can be move assigned, but the virtual `execute_batch_impl`
+// is instantiated for every transformed type (some of which, such as those with
+// const members, can't be assigned).
+template <typename T>
+void AssignBatchItem(T &item, T value, std::true_type /*is_move_assignable*/) {
+    item = std::move(value);
+}
+
+template <typename T>
+void AssignBatchItem(T &, T, std::false_type /*is_move_assignable*/) {
+    throw std::logic_error("The transformed type can't be assigned");
+}
+
 } // namespace Details
 
 // A single column supports `Annotations` from different `Estimators`...
@@ -609,6 +637,22 @@ typename StandardTransformer<InputT, TransformedT>::TransformedType StandardTran
     return execute(value);
 }
 
+template <typename InputT, typename TransformedT>
+void StandardTransformer<InputT, TransformedT>::execute_batch(InputType const *pInput, size_t cInput, TransformedType *pOutput) {
+    static_assert(std::is_move_assignable<TransformedType>::value, "Batch output items must be move assignable");
+
+    if(pInput == nullptr && cInput != 0)
+        throw std::invalid_argument("pInput");
+
+    if(pOutput == nullptr && cInput != 0)
+        throw std::invalid_argument("pOutput");
+
+    if(cInput == 0)
+        return;
+
+    execute_batch_impl(pInput, cInput, pOutput);
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -617,6 +661,26 @@ void StandardTransformer<InputT, TransformedT>::flush_impl(CallbackFunction cons
     // This method doesn't do anything for StandardTransformers
 }
 
+template <typename InputT, typename TransformedT>
+void StandardTransformer<InputT, TransformedT>::execute_batch_impl(InputType const *pInput, size_t cInput, TransformedType *pOutput) {
+    // Create the callback once for the batch rather than once for each item
+    TransformedType *                       pCurrent(pOutput);
+    CallbackFunction const                  callback(
+        [&pCurrent](TransformedType value) {
+            Details::AssignBatchItem(*pCurrent, std::move(value), std::integral_constant<bool, std::is_move_assignable<TransformedType>::value>());
+        }
+    );
+
+    InputType const * const                 pEndInput(pInput + cInput);
+
+    while(pInput != pEndInput) {
+        BaseType::execute(*pInput, callback);
+
+        ++pInput;
+        ++pCurrent;
+    }
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  Estimator
@@ -9,7 +9,7 @@
 #include "../Traits.h"
 
 #include "Base/RollingWindowTransformerBase.h"
-#include "Calculators/MeanCalculator.h"
+#include "Calculators/RollingMeanCalculator.h"
 #include "Components/InferenceOnlyFeaturizerImpl.h"
 #include "Components/FilterDecoratorFeaturizer.h"
 #include "Components/GrainFeaturizerImpl.h"
@@ -191,9 +191,15 @@ public:
 template <typename InputT, size_t MaxNumTrainingItemsV>
 AnalyticalRollingWindowTransformer<InputT, MaxNumTrainingItemsV>::AnalyticalRollingWindowTransformer(AnalyticalRollingWindowCalculation windowCalculation, std::uint32_t horizon, std::uint32_t maxWindowSize, std::uint32_t minWindowSize) :
     BaseType(
-        [] (typename Components::CircularBuffer<InputT>::iterator begin, typename Components::CircularBuffer<InputT>::iterator end) {
-            return Calculators::MeanCalculator<InputT>::execute(begin, end);
+        [] (std::uint32_t windowSize) -> typename BaseType::WindowCalculatorFunction {
+            Calculators::RollingMeanCalculator<InputT>      calculator(windowSize);
+
+            return [calculator] (InputT const &value) mutable {
+                calculator.update(value);
+                return calculator.commit();
+            };
         },
+        static_cast<std::uint8_t>(windowCalculation),
         std::move(horizon),
         std::move(maxWindowSize),
         std::move(minWindowSize)),
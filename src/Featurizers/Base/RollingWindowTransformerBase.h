@@ -9,6 +9,8 @@
 #include "../../Featurizer.h"
 #include "../../Traits.h"
 
+#include <functional>
+#include <limits>
 #include <vector>
 
 namespace Microsoft {
@@ -22,6 +24,12 @@ namespace Base {
 ///                 This class does not have an archive constructor or a save method as those need
 ///                 to be implemented by the derived classes.
 ///
+///                 The window for a horizon offset is the same as the window for the next offset
+///                 when processing the previous row, so the result for each window is calculated
+///                 once and the results for the most recent `horizon` windows are kept. The window
+///                 calculator is invoked once per row, and the rolling calculators in `Calculators`
+///                 update the result in O(1).
+///
 template <
     typename InputT,
     typename OutputT,
@@ -36,16 +44,24 @@ public:
     // |
     // ----------------------------------------------------------------------
     using BaseType                    = Components::InferenceOnlyTransformerImpl<InputT, Microsoft::Featurizer::RowMajMatrix<OutputT>>;
-    using CalculatorFunctionInputType = typename Components::CircularBuffer<InputT>::iterator;
-    using CalculatorFunction          = std::function<OutputT(CalculatorFunctionInputType, CalculatorFunctionInputType)>;
     using CallbackFunction            = typename BaseType::CallbackFunction;
 
+    /// Adds a value to the window (removing the oldest value once the window holds
+    /// `maxWindowSize` values) and returns the result for the updated window.
+    using WindowCalculatorFunction    = std::function<OutputT(InputT const &)>;
+
+    /// Creates a `WindowCalculatorFunction` in its initial state.
+    using CreateWindowCalculatorFunction = std::function<WindowCalculatorFunction (std::uint32_t maxWindowSize)>;
+
     // ----------------------------------------------------------------------
     // |
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    RollingWindowTransformerBase(CalculatorFunction calculator, std::uint32_t horizon, std::uint32_t maxWindowSize, std::uint32_t minWindowSize) ;
+    /// `calculatorKind` identifies the calculation performed by `createCalculator`
+    /// (the derived class's serialized calculation) and is used when comparing
+    /// transformers, as the calculator functions themselves can't be compared.
+    RollingWindowTransformerBase(CreateWindowCalculatorFunction createCalculator, std::uint8_t calculatorKind, std::uint32_t horizon, std::uint32_t maxWindowSize, std::uint32_t minWindowSize) ;
     ~RollingWindowTransformerBase(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(RollingWindowTransformerBase);
@@ -70,8 +86,16 @@ private:
     // |  Private Members
     // |
     // ----------------------------------------------------------------------
-    CalculatorFunction                              _calculator;
-    Components::CircularBuffer<InputT>              _buffer;
+    const CreateWindowCalculatorFunction            _createCalculator;
+    const std::uint8_t                              _calculatorKind;
+    WindowCalculatorFunction                        _calculator;
+
+    // Results for the most recent `_horizon` windows
+    Components::CircularBuffer<OutputT>             _windowResults;
+
+    // The most recent input isn't part of any window until the next row is processed
+    InputT                                          _lastInput;
+    size_t                                          _numInputs;
 
     // ----------------------------------------------------------------------
     // |
@@ -81,40 +105,44 @@ private:
 
     // MSVC runs into problems when the declaration and definition are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
-        _buffer.push(input);
-        const size_t bufferSize = _buffer.size();
+        // Calculate the result for the window that ends before this input
+        OutputT                                     windowResult;
 
-        typename BaseType::TransformedType         results(1, _horizon);
+        if(_numInputs == 0)
+            windowResult = Traits<OutputT>::CreateNullValue();
+        else {
+            windowResult = _calculator(_lastInput);
 
-        for (std::uint32_t offset = 0; offset < _horizon; ++offset){
-            OutputT result;
-            
             // If we don't have enough elements then output NaN
-            if (bufferSize < _horizon - offset + _minWindowSize) {
-                result = Traits<OutputT>::CreateNullValue();
+            if(_numInputs < _minWindowSize)
+                windowResult = Traits<OutputT>::CreateNullValue();
+        }
 
-            } else {
-                // If we have strictly less elements then the window size, but more then the minimum size
-                size_t numElements;
-                size_t startingOffset;
+        _windowResults.push(std::move(windowResult));
 
-                if (bufferSize < _maxWindowSize + _horizon - offset) { ///bufferSize - (_horizon - offset) < _maxWindowSize)
-                    numElements = bufferSize - (_horizon - offset);
-                    startingOffset = 0;
-                } else {
-                    numElements = _maxWindowSize;
-                    startingOffset = offset - (_buffer.capacity() - bufferSize);
-                }
+        _lastInput = input;
 
-                const std::tuple<typename Components::CircularBuffer<InputT>::iterator, typename Components::CircularBuffer<InputT>::iterator> range(_buffer.range(numElements, startingOffset));
-                const typename Components::CircularBuffer<InputT>::iterator start_iter(std::get<0>(range));
-                const typename Components::CircularBuffer<InputT>::iterator end_iter(std::get<1>(range));
+        // Saturate rather than overflow; the exact count only matters until it exceeds the min window size
+        if(_numInputs != std::numeric_limits<size_t>::max())
+            ++_numInputs;
+
+        typename BaseType::TransformedType         results(1, _horizon);
 
-                result = _calculator(start_iter, end_iter);
-            }
+        // Offsets without a corresponding window precede the first input
+        std::uint32_t const                         numNullOffsets(_horizon - static_cast<std::uint32_t>(_windowResults.size()));
+        std::uint32_t                               offset(0);
 
+        while(offset < numNullOffsets) {
+            results(0, static_cast<Eigen::Index>(offset)) = Traits<OutputT>::CreateNullValue();
+            ++offset;
+        }
+
+        for(auto const & result : _windowResults) {
             results(0, static_cast<Eigen::Index>(offset)) = result;
+            ++offset;
         }
+
+        assert(offset == _horizon);
         callback(results);
     }
 
@@ -137,7 +165,7 @@ private:
 // |
 // ----------------------------------------------------------------------
 template <typename InputT, typename OutputT, size_t MaxNumTrainingItemsV>
-RollingWindowTransformerBase<InputT, OutputT, MaxNumTrainingItemsV>::RollingWindowTransformerBase(CalculatorFunction calculator, std::uint32_t horizon, std::uint32_t maxWindowSize,  std::uint32_t minWindowSize) :
+RollingWindowTransformerBase<InputT, OutputT, MaxNumTrainingItemsV>::RollingWindowTransformerBase(CreateWindowCalculatorFunction createCalculator, std::uint8_t calculatorKind, std::uint32_t horizon, std::uint32_t maxWindowSize,  std::uint32_t minWindowSize) :
     _horizon(
         std::move(
             [&horizon]() -> std::uint32_t & {
@@ -170,14 +198,27 @@ RollingWindowTransformerBase<InputT, OutputT, MaxNumTrainingItemsV>::RollingWind
             }()
         )
     ),
-    _calculator(std::move(calculator)),
-    _buffer(horizon + maxWindowSize) {
+    _createCalculator(
+        std::move(
+            [&createCalculator](void) -> CreateWindowCalculatorFunction & {
+                if(!createCalculator)
+                    throw std::invalid_argument("createCalculator");
+
+                return createCalculator;
+            }()
+        )
+    ),
+    _calculatorKind(calculatorKind),
+    _calculator(_createCalculator(_maxWindowSize)),
+    _windowResults(horizon),
+    _lastInput(),
+    _numInputs(0) {
 
 }
 
 template <typename InputT, typename OutputT, size_t MaxNumTrainingItemsV>
 bool RollingWindowTransformerBase<InputT, OutputT, MaxNumTrainingItemsV>::operator==(RollingWindowTransformerBase const &other) const {
-    return _maxWindowSize  == other._maxWindowSize && _calculator == other._calculator && _horizon == other._horizon && _minWindowSize == other._minWindowSize;
+    return _maxWindowSize  == other._maxWindowSize && _calculatorKind == other._calculatorKind && _horizon == other._horizon && _minWindowSize == other._minWindowSize;
 }
 
 template <typename InputT, typename OutputT, size_t MaxNumTrainingItemsV>
@@ -187,8 +228,11 @@ bool RollingWindowTransformerBase<InputT, OutputT, MaxNumTrainingItemsV>::operat
 
 template <typename InputT, typename OutputT, size_t MaxNumTrainingItemsV>
 void RollingWindowTransformerBase<InputT, OutputT, MaxNumTrainingItemsV>::flush_impl(CallbackFunction const &) /*override*/ {
-    /// The only state to clear is the buffer and no rows to return.
-    _buffer.clear();
+    /// The only state to clear is the window state and no rows to return.
+    _calculator = _createCalculator(_maxWindowSize);
+    _windowResults.clear();
+    _lastInput = InputT();
+    _numInputs = 0;
 }
 
 } // namespace Components
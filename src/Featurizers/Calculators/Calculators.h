@@ -4,6 +4,9 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <cmath>
+#include <type_traits>
+
 namespace Microsoft {
 namespace Featurizer {
 namespace Featurizers {
@@ -194,6 +197,24 @@ inline OutputT CalculatorBase<SuperClassT, InputT, OutputT>::execute(InputIterat
     return calculator.commit();
 }
 
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            IsNaN
+///  \brief         Returns true if the value is a floating point NaN.
+///
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value, bool>::type IsNaN(T const &value) {
+    return std::isnan(value);
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value == false, bool>::type IsNaN(T const &) {
+    return false;
+}
+
+} // namespace Details
+
 } // namespace Calculators
 } // namespace Featurizers
 } // namespace Featurizer
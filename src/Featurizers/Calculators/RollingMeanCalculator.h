@@ -0,0 +1,52 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include "Calculators.h"
+#include "RollingSumCalculator.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Calculators {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         RollingMeanCalculator
+///  \brief         Mean of the most recent `windowSize` values, calculated
+///                 in O(1) per update.
+///
+template <typename T>
+class RollingMeanCalculator : public CalculatorBase<RollingMeanCalculator<T>, T, double> {
+public:
+    RollingMeanCalculator(size_t windowSize) :
+        _sumCalc(windowSize) {
+        this->reset();
+    }
+
+private:
+    friend class CalculatorBase<RollingMeanCalculator<T>, T, double>;
+
+    RollingSumCalculator<T>                 _sumCalc;
+
+    inline void update_impl(T value) {
+        _sumCalc.update(value);
+    }
+
+    inline double commit_impl(void) {
+        if (_sumCalc.size() == 0){
+            return 0;
+        }
+        return static_cast<double>(_sumCalc.commit()) / _sumCalc.size();
+    }
+
+    inline void reset_impl(void) {
+        _sumCalc.reset();
+    }
+};
+
+} // namespace Calculators
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
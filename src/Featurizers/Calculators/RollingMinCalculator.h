@@ -0,0 +1,83 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <deque>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "Calculators.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Calculators {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         RollingMinCalculator
+///  \brief         Minimum of the most recent `windowSize` values. Candidates
+///                 are kept in a monotonic deque, so each update is amortized
+///                 O(1). Like `MinCalculator`, NaN values are ignored.
+///
+template <typename T>
+class RollingMinCalculator : public CalculatorBase<RollingMinCalculator<T>, T, T> {
+public:
+    RollingMinCalculator(size_t windowSize) :
+        _windowSize(
+            [&windowSize](void) -> size_t {
+                if(windowSize == 0)
+                    throw std::invalid_argument("windowSize");
+
+                return windowSize;
+            }()
+        ) {
+        this->reset();
+    }
+
+private:
+    friend class CalculatorBase<RollingMinCalculator<T>, T, T>;
+
+    size_t const                            _windowSize;
+    size_t                                  _numValues;
+
+    // Pairs of (position, value) where values are strictly increasing; the
+    // front of the deque is the minimum of the window.
+    std::deque<std::pair<size_t, T>>        _candidates;
+
+    inline void update_impl(T value) {
+        size_t const                        position(_numValues++);
+
+        // Remove the value that has left the window
+        if(_candidates.empty() == false && _candidates.front().first + _windowSize <= position)
+            _candidates.pop_front();
+
+        if(Details::IsNaN(value))
+            return;
+
+        // Remove values that can no longer be the minimum
+        while(_candidates.empty() == false && _candidates.back().second >= value)
+            _candidates.pop_back();
+
+        _candidates.emplace_back(position, std::move(value));
+    }
+
+    inline T commit_impl(void) {
+        if(_candidates.empty())
+            return std::numeric_limits<T>::max();
+
+        return _candidates.front().second;
+    }
+
+    inline void reset_impl(void) {
+        _numValues = 0;
+        _candidates.clear();
+    }
+};
+
+} // namespace Calculators
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "Calculators.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Calculators {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         RollingSumCalculator
+///  \brief         Sum of the most recent `windowSize` values. A running sum
+///                 is updated as values enter and leave the window, so each
+///                 update is O(1). The sum is periodically recalculated from
+///                 the values in the window so that floating point errors
+///                 don't accumulate over long series.
+///
+///                 Only finite values contribute to the running sum; NaN and
+///                 infinite values are counted instead, so that the sum recovers
+///                 once they leave the window. As with `SumCalculator`, the result
+///                 is NaN while a NaN (or both +Inf and -Inf) are in the window,
+///                 and +/-Inf while an infinite value is in the window.
+template <typename T>
+class RollingSumCalculator : public CalculatorBase<RollingSumCalculator<T>, T, T> {
+public:
+    RollingSumCalculator(size_t windowSize) :
+        _windowSize(
+            [&windowSize](void) -> size_t {
+                if(windowSize == 0)
+                    throw std::invalid_argument("windowSize");
+
+                return windowSize;
+            }()
+        ) {
+        this->reset();
+    }
+
+    /// Number of values in the window
+    size_t size(void) const {
+        return _values.size();
+    }
+
+private:
+    friend class CalculatorBase<RollingSumCalculator<T>, T, T>;
+
+    size_t const                            _windowSize;
+
+    // Values in the window, stored as a ring buffer once the window is full
+    std::vector<T>                          _values;
+    size_t                                  _oldestIndex;
+    size_t                                  _numReplaced;
+
+    // Sum of the finite values in the window
+    T                                       _sum;
+
+    // Non-finite values in the window
+    size_t                                  _numNaN;
+    size_t                                  _numPositiveInf;
+    size_t                                  _numNegativeInf;
+
+    inline void update_impl(T value) {
+        if(_values.size() < _windowSize) {
+            _values.emplace_back(value);
+            add(value);
+            return;
+        }
+
+        T &                                 oldest(_values[_oldestIndex]);
+
+        remove(oldest);
+        add(value);
+
+        oldest = std::move(value);
+
+        if(++_oldestIndex == _windowSize)
+            _oldestIndex = 0;
+
+        if(++_numReplaced == _windowSize) {
+            // Recalculate the sum from oldest to newest (the order used by SumCalculator)
+            _sum = static_cast<T>(0);
+
+            for(size_t offset = 0; offset < _windowSize; ++offset) {
+                T const &                   windowValue(_values[(_oldestIndex + offset) % _windowSize]);
+
+                if(IsFinite(windowValue))
+                    _sum += windowValue;
+            }
+
+            _numReplaced = 0;
+        }
+    }
+
+    inline T commit_impl(void) {
+        if(_numNaN != 0 || (_numPositiveInf != 0 && _numNegativeInf != 0))
+            return std::numeric_limits<T>::quiet_NaN();
+
+        if(_numPositiveInf != 0)
+            return std::numeric_limits<T>::infinity();
+
+        if(_numNegativeInf != 0)
+            return -std::numeric_limits<T>::infinity();
+
+        return _sum;
+    }
+
+    inline void reset_impl(void) {
+        _values.clear();
+        _oldestIndex = 0;
+        _numReplaced = 0;
+        _sum = static_cast<T>(0);
+        _numNaN = 0;
+        _numPositiveInf = 0;
+        _numNegativeInf = 0;
+    }
+
+    inline void add(T const &value) {
+        if(IsFinite(value))
+            _sum += value;
+        else
+            ++non_finite_count(value);
+    }
+
+    inline void remove(T const &value) {
+        if(IsFinite(value))
+            _sum -= value;
+        else
+            --non_finite_count(value);
+    }
+
+    inline size_t & non_finite_count(T const &value) {
+        if(std::isnan(value))
+            return _numNaN;
+
+        return value > static_cast<T>(0) ? _numPositiveInf : _numNegativeInf;
+    }
+
+    static inline bool IsFinite(T const &value) {
+        return IsFinite(value, std::integral_constant<bool, std::is_floating_point<T>::value>());
+    }
+
+    static inline bool IsFinite(T const &value, std::true_type) {
+        return std::isfinite(value);
+    }
+
+    static inline bool IsFinite(T const &, std::false_type) {
+        return true;
+    }
+};
+
+} // namespace Calculators
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
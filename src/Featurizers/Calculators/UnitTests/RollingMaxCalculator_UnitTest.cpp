@@ -0,0 +1,74 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "../MaxCalculator.h"
+#include "../RollingMaxCalculator.h"
+
+namespace NS = Microsoft::Featurizer::Featurizers::Calculators;
+
+TEST_CASE("Standard - int") {
+    NS::RollingMaxCalculator<int>           calc(3);
+    std::vector<int> const                  values{5, 1, 3, 4, -3, 2};
+    std::vector<int> const                  expected{5, 5, 5, 4, 4, 4};
+
+    for(size_t i = 0; i < values.size(); ++i) {
+        calc.update(values[i]);
+        CHECK(calc.commit() == expected[i]);
+    }
+
+    calc.reset();
+    CHECK(calc.commit() == std::numeric_limits<int>::min());
+
+    calc.update(10);
+    CHECK(calc.commit() == 10);
+}
+
+TEST_CASE("NaN - double") {
+    NS::RollingMaxCalculator<double>        calc(2);
+
+    calc.update(std::numeric_limits<double>::quiet_NaN());
+    CHECK(calc.commit() == Approx(std::numeric_limits<double>::min()));
+
+    calc.update(2.0);
+    CHECK(calc.commit() == Approx(2.0));
+
+    calc.update(std::numeric_limits<double>::quiet_NaN());
+    CHECK(calc.commit() == Approx(2.0));
+
+    calc.update(std::numeric_limits<double>::quiet_NaN());
+    CHECK(calc.commit() == Approx(std::numeric_limits<double>::min()));
+}
+
+TEST_CASE("Invalid window size") {
+    CHECK_THROWS_WITH(NS::RollingMaxCalculator<int>(0), "windowSize");
+}
+
+TEST_CASE("Compare with MaxCalculator") {
+    std::mt19937                            gen(42);
+    std::uniform_int_distribution<int>      dist(-1000, 1000);
+    std::vector<int>                        values;
+
+    for(size_t windowSize : {1, 2, 7, 100}) {
+        NS::RollingMaxCalculator<int>       calc(windowSize);
+
+        values.clear();
+
+        for(size_t i = 0; i < 1000; ++i) {
+            values.emplace_back(dist(gen));
+            calc.update(values.back());
+
+            int const                       expected(NS::MaxCalculator<int>::execute(values.end() - static_cast<std::ptrdiff_t>(std::min(windowSize, values.size())), values.end()));
+
+            CHECK(calc.commit() == expected);
+        }
+    }
+}
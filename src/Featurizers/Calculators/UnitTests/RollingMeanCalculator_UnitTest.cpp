@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "../MeanCalculator.h"
+#include "../RollingMeanCalculator.h"
+
+namespace NS = Microsoft::Featurizer::Featurizers::Calculators;
+
+TEST_CASE("Standard - int") {
+    NS::RollingMeanCalculator<int>          calc(2);
+
+    CHECK(calc.commit() == Approx(0.0));
+
+    calc.update(5);
+    CHECK(calc.commit() == Approx(5.0));
+
+    calc.update(3);
+    CHECK(calc.commit() == Approx(4.0));
+
+    calc.update(1);
+    CHECK(calc.commit() == Approx(2.0));
+
+    calc.reset();
+    CHECK(calc.commit() == Approx(0.0));
+
+    calc.update(10);
+    CHECK(calc.commit() == Approx(10.0));
+}
+
+TEST_CASE("Compare with MeanCalculator") {
+    std::mt19937                            gen(42);
+    std::uniform_int_distribution<int>      dist(-1000, 1000);
+    std::vector<int>                        values;
+
+    for(size_t windowSize : {1, 2, 7, 100}) {
+        NS::RollingMeanCalculator<int>      calc(windowSize);
+
+        values.clear();
+
+        for(size_t i = 0; i < 1000; ++i) {
+            values.emplace_back(dist(gen));
+            calc.update(values.back());
+
+            double const                    expected(NS::MeanCalculator<int>::execute(values.end() - static_cast<std::ptrdiff_t>(std::min(windowSize, values.size())), values.end()));
+
+            CHECK(calc.commit() == Approx(expected));
+        }
+    }
+}
+
+TEST_CASE("Non-finite values leave the window") {
+    double const                            nan(std::numeric_limits<double>::quiet_NaN());
+    double const                            inf(std::numeric_limits<double>::infinity());
+
+    NS::RollingMeanCalculator<double>       calc(3);
+
+    calc.update(1.0);
+    calc.update(nan);
+    calc.update(2.0);
+    CHECK(std::isnan(calc.commit()));
+
+    calc.update(3.0);
+    CHECK(std::isnan(calc.commit()));
+
+    calc.update(4.0);
+    CHECK(calc.commit() == Approx(3.0));
+
+    calc.update(inf);
+    CHECK(calc.commit() == inf);
+
+    calc.update(5.0);
+    calc.update(6.0);
+    CHECK(calc.commit() == inf);
+
+    calc.update(7.0);
+    CHECK(calc.commit() == Approx(6.0));
+
+    // Values continue to be correct after the periodic recalculation
+    for(int value = 8; value < 20; ++value) {
+        calc.update(static_cast<double>(value));
+        CHECK(calc.commit() == Approx(static_cast<double>(value - 1)));
+    }
+}
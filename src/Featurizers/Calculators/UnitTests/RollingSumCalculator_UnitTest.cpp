@@ -0,0 +1,99 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "catch.hpp"
+#include "../SumCalculator.h"
+#include "../RollingSumCalculator.h"
+
+namespace NS = Microsoft::Featurizer::Featurizers::Calculators;
+
+TEST_CASE("Standard - int") {
+    NS::RollingSumCalculator<int>           calc(3);
+
+    calc.update(1);
+    CHECK(calc.commit() == 1);
+    CHECK(calc.size() == 1);
+
+    calc.update(2);
+    calc.update(3);
+    CHECK(calc.commit() == 6);
+    CHECK(calc.size() == 3);
+
+    calc.update(4);
+    CHECK(calc.commit() == 9);
+    CHECK(calc.size() == 3);
+
+    calc.update(-10);
+    CHECK(calc.commit() == -3);
+
+    calc.reset();
+    CHECK(calc.commit() == 0);
+    CHECK(calc.size() == 0);
+
+    calc.update(10);
+    CHECK(calc.commit() == 10);
+}
+
+TEST_CASE("Invalid window size") {
+    CHECK_THROWS_WITH(NS::RollingSumCalculator<int>(0), "windowSize");
+}
+
+TEST_CASE("Compare with SumCalculator") {
+    std::mt19937                            gen(42);
+    std::uniform_real_distribution<double>  dist(-1000.0, 1000.0);
+    std::vector<double>                     values;
+
+    for(size_t windowSize : {1, 2, 7, 100}) {
+        NS::RollingSumCalculator<double>    calc(windowSize);
+
+        values.clear();
+
+        for(size_t i = 0; i < 1000; ++i) {
+            values.emplace_back(dist(gen));
+            calc.update(values.back());
+
+            double const                    expected(NS::SumCalculator<double>::execute(values.end() - static_cast<std::ptrdiff_t>(std::min(windowSize, values.size())), values.end()));
+
+            CHECK(calc.commit() == Approx(expected).margin(1e-6));
+        }
+    }
+}
+
+TEST_CASE("Non-finite values - double") {
+    double const                            nan(std::numeric_limits<double>::quiet_NaN());
+    double const                            inf(std::numeric_limits<double>::infinity());
+
+    NS::RollingSumCalculator<double>        calc(2);
+
+    calc.update(1.0);
+    calc.update(nan);
+    CHECK(std::isnan(calc.commit()));
+
+    calc.update(2.0);
+    CHECK(std::isnan(calc.commit()));
+
+    // The NaN has left the window
+    calc.update(3.0);
+    CHECK(calc.commit() == 5.0);
+
+    calc.update(inf);
+    CHECK(calc.commit() == inf);
+
+    calc.update(-inf);
+    CHECK(std::isnan(calc.commit()));
+
+    calc.update(4.0);
+    CHECK(calc.commit() == -inf);
+
+    calc.update(5.0);
+    CHECK(calc.commit() == 9.0);
+}
@@ -774,6 +774,38 @@ private:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 
+/////////////////////////////////////////////////////////////////////////
+///  \fn            ExecuteBatchPerItem
+///  \brief         Executes each item in the batch with a single callback;
+///                 used by chain elements that can't forward the batch to a
+///                 `StandardTransformer`.
+///
+template <typename ChainElementT, typename InputT, typename TransformedT>
+void ExecuteBatchPerItem(ChainElementT &element, InputT const *pInput, size_t cInput, TransformedT *pOutput) {
+    static_assert(std::is_move_assignable<TransformedT>::value, "Batch output items must be move assignable");
+
+    size_t                                  cResults(0);
+    std::function<void (TransformedT)> const            callback(
+        [&pOutput, &cResults](TransformedT value) {
+            if(cResults++ == 0)
+                *pOutput = std::move(value);
+        }
+    );
+
+    InputT const * const                    pEndInput(pInput + cInput);
+
+    while(pInput != pEndInput) {
+        cResults = 0;
+        element.execute(*pInput, callback);
+
+        if(cResults != 1)
+            throw std::runtime_error("This method should only be used with Transformers that generate 1 output value for each input value");
+
+        ++pInput;
+        ++pOutput;
+    }
+}
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         TransformerChainElement
 ///  \brief         Single `Transformer` within a chain of `Transformers`.
@@ -833,6 +865,12 @@ public:
         callback(std::move(input));
     }
 
+    template <typename InputT, typename TransformedT>
+    void execute_batch(InputT const *pInput, size_t cInput, TransformedT *pOutput) {
+        for(size_t index = 0; index < cInput; ++index)
+            pOutput[index] = pInput[index];
+    }
+
     template <typename CallbackT>
     void flush(CallbackT const &) {
     }
@@ -889,6 +927,21 @@ public:
         _pTransformer->execute(input, callback);
     }
 
+    template <typename InputT, typename TransformedT>
+    void execute_batch(InputT const *pInput, size_t cInput, TransformedT *pOutput) {
+        // ----------------------------------------------------------------------
+        using ThisTransformer               = typename ThisEstimator::TransformerType;
+        using ThisStandardTransformer       = StandardTransformer<typename ThisTransformer::InputType, typename ThisTransformer::TransformedType>;
+        // ----------------------------------------------------------------------
+
+        execute_batch(pInput, cInput, pOutput, std::integral_constant<bool, std::is_base_of<ThisStandardTransformer, ThisTransformer>::value>());
+    }
+
+    template <typename... ArgTs>
+    size_t execute_into(ArgTs &&... args) {
+        return static_cast<typename ThisEstimator::TransformerType &>(*_pTransformer).execute_into(std::forward<ArgTs>(args)...);
+    }
+
     template <typename CallbackT>
     void flush(CallbackT const &callback) {
         _pTransformer->flush(callback);
@@ -902,6 +955,21 @@ private:
     // ----------------------------------------------------------------------
     using TransformerUniquePtr              = typename ThisEstimator::TransformerUniquePtr;
 
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    template <typename InputT, typename TransformedT>
+    void execute_batch(InputT const *pInput, size_t cInput, TransformedT *pOutput, std::true_type) {
+        static_cast<typename ThisEstimator::TransformerType &>(*_pTransformer).execute_batch(pInput, cInput, pOutput);
+    }
+
+    template <typename InputT, typename TransformedT>
+    void execute_batch(InputT const *pInput, size_t cInput, TransformedT *pOutput, std::false_type) {
+        ExecuteBatchPerItem(*this, pInput, cInput, pOutput);
+    }
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
@@ -960,6 +1028,16 @@ public:
         NextTransformerChainElement::execute(input, callback);
     }
 
+    template <typename InputT, typename TransformedT>
+    void execute_batch(InputT const *pInput, size_t cInput, TransformedT *pOutput) {
+        NextTransformerChainElement::execute_batch(pInput, cInput, pOutput);
+    }
+
+    template <typename... ArgTs>
+    size_t execute_into(ArgTs &&... args) {
+        return NextTransformerChainElement::execute_into(std::forward<ArgTs>(args)...);
+    }
+
     template <typename CallbackT>
     void flush(CallbackT const &callback) {
         NextTransformerChainElement::flush(callback);
@@ -1029,6 +1107,13 @@ public:
         );
     }
 
+    template <typename InputT, typename TransformedT>
+    void execute_batch(InputT const *pInput, size_t cInput, TransformedT *pOutput) {
+        // Intermediate results may be produced for each input, so the items
+        // are passed through the chain one at a time.
+        ExecuteBatchPerItem(*this, pInput, cInput, pOutput);
+    }
+
     template <typename CallbackT>
     void flush(CallbackT const &callback) {
         NextTransformerChainElement &       next(static_cast<NextTransformerChainElement &>(*this));
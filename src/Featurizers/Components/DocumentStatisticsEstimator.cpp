@@ -102,6 +102,18 @@ DocumentStatisticsAnnotationData::DocumentStatisticsAnnotationData(DocumentStati
 // |  Details::DocumentStatisticsTrainingOnlyPolicy
 // |
 // ----------------------------------------------------------------------
+namespace {
+
+bool IsToLowerDecorator(Details::DocumentStatisticsTrainingOnlyPolicy::StringDecorator const &decorator) {
+    using FunctionPtr                       = std::string (*)(std::string);
+
+    FunctionPtr const * const               pFunc(decorator.target<FunctionPtr>());
+
+    return pFunc != nullptr && *pFunc == &Strings::ToLower;
+}
+
+} // anonymous namespace
+
 Details::DocumentStatisticsTrainingOnlyPolicy::DocumentStatisticsTrainingOnlyPolicy(
     StringDecorator decorator,
     AnalyzerMethod analyzer,
@@ -113,8 +125,9 @@ Details::DocumentStatisticsTrainingOnlyPolicy::DocumentStatisticsTrainingOnlyPol
     std::uint32_t ngramRangeMin,
     std::uint32_t ngramRangeMax
 ) :
+    _lowercase(IsToLowerDecorator(decorator)),
     //decorator is an optional parameter
-    _stringDecoratorFunc(std::move(decorator)),
+    _stringDecoratorFunc(_lowercase ? StringDecorator() : std::move(decorator)),
     //analyzer is an optional parameter
     _analyzer(std::move(analyzer)),
     //regexToken is an optional parameter
@@ -179,7 +192,7 @@ Details::DocumentStatisticsTrainingOnlyPolicy::DocumentStatisticsTrainingOnlyPol
             }()
         )
     ),
-    _parseFunc(DocumentParseFuncGenerator(_analyzer, _regexToken, _ngramRangeMin, _ngramRangeMax)),
+    _tokenizer(_lowercase, _analyzer, _regexToken, _ngramRangeMin, _ngramRangeMax),
     _totalNumDocuments(0) {
         if (_minDf > _maxDf)
             throw std::invalid_argument("_minDf > _maxDf");
@@ -212,8 +225,13 @@ void Details::DocumentStatisticsTrainingOnlyPolicy::fit(InputType const &input)
             [](InputTypeConstIterator begin, InputTypeConstIterator end) {
                 return std::make_pair(begin, end);
             },
-            [](InputTypeConstIteratorRange const &range) -> std::string {
-                return std::string(std::get<0>(range), std::get<1>(range));
+            [](InputTypeConstIteratorRange const &range) -> std::string const & {
+                // Reused so that looking up a term that has already been seen
+                // doesn't allocate
+                static thread_local std::string         key;
+
+                key.assign(std::get<0>(range), std::get<1>(range));
+                return key;
             }
         );
     }
@@ -366,85 +384,6 @@ DocumentStatisticsAnnotationData Details::DocumentStatisticsTrainingOnlyPolicy::
     return DocumentStatisticsAnnotationData(std::move(termFrequencyAndIndex), std::move(_totalNumDocuments));
 }
 
-// ----------------------------------------------------------------------
-// |
-// |  Public Functions
-// |
-// ----------------------------------------------------------------------
-ParseFunctionType DocumentParseFuncGenerator(AnalyzerMethod const &analyzer, std::string const & regexToken, std::uint32_t const & ngramRangeMin, std::uint32_t const & ngramRangeMax) {
-    if (analyzer == AnalyzerMethod::Word) {
-        if (!regexToken.empty()) {
-            return [regexToken] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
-                Microsoft::Featurizer::Strings::ParseRegex(
-                    input,
-                    regexToken,
-                    callback
-                );
-            };
-        } else if (ngramRangeMin == 1 && ngramRangeMax == 1) {
-            return [] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
-                Microsoft::Featurizer::Strings::Parse<std::string::const_iterator, std::function<bool (char)>>(
-                    input,
-                    [] (char c) {return std::isspace(c);},
-                    callback
-                );
-            };
-        } else {
-            return [ngramRangeMin, ngramRangeMax] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
-                Microsoft::Featurizer::Strings::ParseNgramWord<std::string::const_iterator, std::function<bool (char)>>(
-                    input,
-                    [] (char c) {return std::isspace(c);},
-                    ngramRangeMin,
-                    ngramRangeMax,
-                    callback
-                );
-            };
-        }
-    } else if (analyzer == AnalyzerMethod::Char) {
-        return [ngramRangeMin, ngramRangeMax] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
-            Microsoft::Featurizer::Strings::ParseNgramChar<std::string::const_iterator>(
-                input,
-                ngramRangeMin,
-                ngramRangeMax,
-                callback
-            );
-        };
-    } else {
-        assert(analyzer == AnalyzerMethod::Charwb);
-        return [ngramRangeMin, ngramRangeMax] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
-            Microsoft::Featurizer::Strings::ParseNgramCharwb<std::string::const_iterator, std::function<bool (char)>>(
-                input,
-                [] (char c) {return std::isspace(c);},
-                ngramRangeMin,
-                ngramRangeMax,
-                callback
-            );
-        };
-    }
-}
-
-std::string DocumentDecorator(std::string const& input, bool const& lower, AnalyzerMethod const& analyzer, std::string const& regex, std::uint32_t const& ngram_min, std::uint32_t const& ngram_max) {
-
-    std::string decoratedInput = lower ? Strings::ToLower(input) : input;
-    std::string processedInput;
-
-    if (analyzer == AnalyzerMethod::Word) {
-        if (regex.empty() && !(ngram_min == 1 && ngram_max == 1)) {
-            processedInput = Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(decoratedInput);
-        } else {
-            processedInput = decoratedInput;
-        }
-    } else if (analyzer == AnalyzerMethod::Char) {
-        processedInput = Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(decoratedInput);
-    } else {
-        assert(analyzer == AnalyzerMethod::Charwb);
-        auto predicate = [] (char c) {return std::isspace(c);};
-        std::string processedString(Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(decoratedInput));
-        processedInput = Microsoft::Featurizer::Strings::Details::StringPadding<std::function<bool (char)>>(processedString, predicate);
-    }
-    return processedInput;
-}
-
 } // namespace Components
 } // namespace Featurizers
 } // namespace Featurizer
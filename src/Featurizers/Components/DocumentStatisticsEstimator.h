@@ -13,6 +13,7 @@
 
 #include "TrainingOnlyEstimatorImpl.h"
 #include "IndexMapEstimator.h"
+#include "DocumentTokenizer.h"
 #include "../../Strings.h"
 
 namespace Microsoft {
@@ -24,13 +25,6 @@ namespace Components {
 static constexpr char const * const         DocumentStatisticsEstimatorName("DocumentStatisticsEstimator");
 
 using StringIterator                    = std::string::const_iterator;
-using ParseFunctionType                 = std::function<void (std::string const &, std::function<void (StringIterator, StringIterator)> const &)>;
-
-enum class AnalyzerMethod : unsigned char {
-    Word = 1,
-    Char = 2,
-    Charwb = 3
-};
 
 /////////////////////////////////////////////////////////////////////////
 ///  \class         IterRangeComp
@@ -154,6 +148,10 @@ private:
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
+    // `Strings::ToLower` is applied by the tokenizer as it copies the
+    // document rather than to each term, in which case `_stringDecoratorFunc`
+    // is empty
+    bool const                              _lowercase;
     StringDecorator const                   _stringDecoratorFunc;
     AnalyzerMethod const                    _analyzer;
     std::string const                       _regexToken;
@@ -165,7 +163,7 @@ private:
     std::uint32_t const                     _ngramRangeMin;
     std::uint32_t const                     _ngramRangeMax;
 
-    ParseFunctionType const                 _parseFunc;
+    DocumentTokenizer                       _tokenizer;
 
     FrequencyMap                            _termFrequency;
     std::uint32_t                           _totalNumDocuments;
@@ -178,7 +176,7 @@ private:
     template <
         typename SetT,
         typename CreateKeyFuncT,            // SetT::value_type (InputTypeConstIterator begin, InputTypeConstIterator end)
-        typename KeyToStringFuncT           // <string-like> (SetT::value_type), where <string-like> will be a string reference or object depending on the set type
+        typename KeyToStringFuncT           // std::string const & (SetT::value_type); the string is only copied when the term is new
     >
     void fit_impl(
         InputType const &input,
@@ -238,9 +236,6 @@ public:
 DocumentStatisticsAnnotationData::FrequencyAndIndexMap MergeTwoMapsWithSameKeys(Details::DocumentStatisticsTrainingOnlyPolicy::FrequencyMap termFrequency,
                                                                                 Details::DocumentStatisticsTrainingOnlyPolicy::IndexMap termIndex);
 
-ParseFunctionType DocumentParseFuncGenerator(AnalyzerMethod const &analyzer, std::string const & regexToken, std::uint32_t const & ngramRangeMin, std::uint32_t const & ngramRangeMax);
-std::string DocumentDecorator(std::string const& input, bool const& lower, AnalyzerMethod const& analyzer, std::string const& regex, std::uint32_t const& ngram_min, std::uint32_t const& ngram_max);
-
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -294,25 +289,8 @@ template <typename SetT, typename CreateKeyFuncT, typename KeyToStringFuncT>
 void Details::DocumentStatisticsTrainingOnlyPolicy::fit_impl(InputType const &input, CreateKeyFuncT const &createKeyFunc, KeyToStringFuncT const &keyToStringFunc) {
     SetT                                    documents;
 
-    std::string processedInput;
-    if (_analyzer == AnalyzerMethod::Word) {
-        if (_regexToken.empty() && !(_ngramRangeMin == 1 && _ngramRangeMax == 1)) {
-            processedInput = Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(input);
-        } else {
-            processedInput = input;
-        }
-    } else if (_analyzer == AnalyzerMethod::Char) {
-        processedInput = Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(input);
-    } else {
-        assert(_analyzer == AnalyzerMethod::Charwb);
-        auto predicate = [] (char c) {return std::isspace(c);};
-
-        std::string processedString(Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(input));
-        processedInput = Microsoft::Featurizer::Strings::Details::StringPadding<std::function<bool (char)>>(processedString, predicate);
-    }
-
-    _parseFunc(
-        processedInput,
+    _tokenizer.Tokenize(
+        input,
         [&createKeyFunc, &documents] (InputTypeConstIterator begin, InputTypeConstIterator end) {
             documents.insert(createKeyFunc(begin, end));
         }
@@ -320,13 +298,13 @@ void Details::DocumentStatisticsTrainingOnlyPolicy::fit_impl(InputType const &in
 
     auto const                              getCountFunc(
         [this, &keyToStringFunc](typename SetT::value_type const &key) -> typename FrequencyMap::mapped_type & {
-            auto                                        mapKey(keyToStringFunc(key));
+            std::string const &                         mapKey(keyToStringFunc(key));
             typename FrequencyMap::iterator const       iter(_termFrequency.find(mapKey));
 
             if(iter != _termFrequency.end())
                 return iter->second;
 
-            std::pair<typename FrequencyMap::iterator, bool> const          result(_termFrequency.insert(std::make_pair(std::move(mapKey), 0)));
+            std::pair<typename FrequencyMap::iterator, bool> const          result(_termFrequency.insert(std::make_pair(mapKey, 0)));
 
             return result.first->second;
         }
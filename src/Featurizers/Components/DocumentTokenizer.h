@@ -0,0 +1,556 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../Featurizer.h"
+#include "../../Strings.h"
+
+#if (defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2))
+#   define FEATURIZER_DOCUMENT_TOKENIZER_SSE2
+#   include <emmintrin.h>
+#   if (defined _MSC_VER)
+#       include <intrin.h>
+#   endif
+#endif
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+enum class AnalyzerMethod : unsigned char {
+    Word = 1,
+    Char = 2,
+    Charwb = 3
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         DocumentTokenizer
+///  \brief         Produces the terms of a document in a single pass over
+///                 the document.
+///
+///                 Lowercasing, the replacement of punctuation with spaces,
+///                 the removal of duplicate whitespace and the padding used
+///                 by the Charwb analyzer are all performed as the document
+///                 is copied into a buffer that is reused across calls, and
+///                 terms are emitted as soon as they are complete. The terms
+///                 are the same as those produced by normalizing the whole
+///                 document and then parsing it with the `Strings` functions,
+///                 although they may be emitted in a different order.
+///
+///                 Terms are provided as iterators that are valid until the
+///                 next call to `Tokenize` on the same thread. The buffer is
+///                 shared by all tokenizers on a thread (rather than stored in
+///                 the tokenizer), so a tokenizer can be used on multiple threads
+///                 concurrently.
+///
+///                 The regex token (if any) is compiled once during construction
+///                 and is shared (read-only) by tokenizers moved from this one.
+///
+class DocumentTokenizer {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using StringIterator                    = std::string::const_iterator;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    DocumentTokenizer(
+        bool lowercase,
+        AnalyzerMethod analyzer,
+        std::string regexToken,
+        std::uint32_t ngramRangeMin,
+        std::uint32_t ngramRangeMax
+    );
+
+    ~DocumentTokenizer(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(DocumentTokenizer);
+
+    /// Invokes `callback(StringIterator begin, StringIterator end)` for each term in the input.
+    template <typename CallbackT>
+    void Tokenize(std::string const &input, CallbackT const &callback) const;
+
+    /// Invokes `callback(StringIterator begin, StringIterator end)` for each term in the
+    /// `cInput` characters at `pInput`; the input doesn't need to be null-terminated.
+    template <typename CallbackT>
+    void Tokenize(char const *pInput, size_t cInput, CallbackT const &callback) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+
+    // Scratch buffers that are reused across calls to `Tokenize` on the same thread
+    struct ScratchBuffers {
+        std::string                         Buffer;
+        std::vector<std::pair<size_t, size_t>>          Words;
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr size_t                 NoPosition = std::numeric_limits<size_t>::max();
+
+    bool const                              _lowercase;
+    AnalyzerMethod const                    _analyzer;
+    std::shared_ptr<re2::RE2 const> const   _pRegex;
+    std::uint32_t const                     _ngramRangeMin;
+    std::uint32_t const                     _ngramRangeMax;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    static ScratchBuffers & GetScratchBuffers(void);
+
+    /// Copies the input to `scratch.Buffer` (starting at `offset`), lowercasing characters
+    /// if necessary. When `ReplacePunctuationV` is true, punctuation is replaced with
+    /// spaces and sequences of whitespace are replaced by their first character.
+    ///
+    /// `onChars(size_t begin, size_t end)` is invoked when characters that aren't
+    /// whitespace are written to the buffer and `onWhitespace(size_t pos)` is
+    /// invoked when a whitespace character is written. Returns the position after
+    /// the last character written.
+    template <bool ReplacePunctuationV, typename OnCharsT, typename OnWhitespaceT>
+    size_t Normalize(ScratchBuffers &scratch, char const *pInput, size_t cInput, size_t offset, OnCharsT const &onChars, OnWhitespaceT const &onWhitespace) const;
+
+    template <typename CallbackT>
+    void TokenizeWords(ScratchBuffers &scratch, char const *pInput, size_t cInput, CallbackT const &callback) const;
+
+    template <typename CallbackT>
+    void TokenizeWordNgrams(ScratchBuffers &scratch, char const *pInput, size_t cInput, CallbackT const &callback) const;
+
+    template <typename CallbackT>
+    void TokenizeChars(ScratchBuffers &scratch, char const *pInput, size_t cInput, CallbackT const &callback) const;
+
+    template <typename CallbackT>
+    void TokenizeCharwbs(ScratchBuffers &scratch, char const *pInput, size_t cInput, CallbackT const &callback) const;
+
+    template <typename CallbackT>
+    void TokenizeRegex(ScratchBuffers &scratch, char const *pInput, size_t cInput, CallbackT const &callback) const;
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+namespace Details {
+
+// These match the "C" locale versions of std::isspace and std::ispunct
+inline bool IsWhitespace(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+inline bool IsPunctuation(char c) {
+    unsigned char const                     value(static_cast<unsigned char>(c));
+
+    return (value >= 33 && value <= 47) || (value >= 58 && value <= 64) || (value >= 91 && value <= 96) || (value >= 123 && value <= 126);
+}
+
+inline char ToLower(char c) {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c | 0x20) : c;
+}
+
+#if (defined FEATURIZER_DOCUMENT_TOKENIZER_SSE2)
+
+/// Returns a mask of the characters in [low, high]
+inline __m128i InRange(__m128i chars, char low, char high) {
+    return _mm_cmplt_epi8(
+        _mm_xor_si128(_mm_sub_epi8(chars, _mm_set1_epi8(low)), _mm_set1_epi8(static_cast<char>(0x80))),
+        _mm_set1_epi8(static_cast<char>(high - low + 1 - 128))
+    );
+}
+
+inline unsigned int CountTrailingZeros(unsigned int value) {
+#   if (defined _MSC_VER)
+    unsigned long                           result;
+
+    _BitScanForward(&result, value);
+    return static_cast<unsigned int>(result);
+#   else
+    return static_cast<unsigned int>(__builtin_ctz(value));
+#   endif
+}
+
+#endif
+
+/// Copies characters from [pInput, pEnd) to pOutput (lowercasing them if necessary)
+/// until whitespace (or punctuation when `ReplacePunctuationV` is true) is encountered;
+/// returns the number of characters copied. Up to 16 characters beyond those copied
+/// may be written to pOutput.
+template <bool ReplacePunctuationV>
+size_t CopyOrdinaryChars(char const *pInput, char const *pEnd, char *pOutput, bool lowercase) {
+    char const * const                      pStart(pInput);
+
+#if (defined FEATURIZER_DOCUMENT_TOKENIZER_SSE2)
+    // Process 16 characters at a time; non-ASCII characters are neither whitespace,
+    // punctuation nor uppercase, so they don't need special handling.
+    while(pEnd - pInput >= 16) {
+        __m128i                             chars(_mm_loadu_si128(reinterpret_cast<__m128i const *>(pInput)));
+        __m128i                             special(_mm_or_si128(InRange(chars, '\t', '\r'), InRange(chars, ' ', ' ')));
+
+        if(ReplacePunctuationV) {
+            special = _mm_or_si128(special, InRange(chars, '!', '/'));
+            special = _mm_or_si128(special, InRange(chars, ':', '@'));
+            special = _mm_or_si128(special, InRange(chars, '[', '`'));
+            special = _mm_or_si128(special, InRange(chars, '{', '~'));
+        }
+
+        if(lowercase)
+            chars = _mm_or_si128(chars, _mm_and_si128(InRange(chars, 'A', 'Z'), _mm_set1_epi8(0x20)));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pOutput), chars);
+
+        unsigned int const                  mask(static_cast<unsigned int>(_mm_movemask_epi8(special)));
+
+        if(mask != 0)
+            return static_cast<size_t>(pInput - pStart) + CountTrailingZeros(mask);
+
+        pInput += 16;
+        pOutput += 16;
+    }
+#endif
+
+    while(pInput != pEnd) {
+        char const                          c(*pInput);
+
+        if(IsWhitespace(c) || (ReplacePunctuationV && IsPunctuation(c)))
+            break;
+
+        *pOutput++ = lowercase ? ToLower(c) : c;
+        ++pInput;
+    }
+
+    return static_cast<size_t>(pInput - pStart);
+}
+
+} // namespace Details
+
+inline DocumentTokenizer::DocumentTokenizer(
+    bool lowercase,
+    AnalyzerMethod analyzer,
+    std::string regexToken,
+    std::uint32_t ngramRangeMin,
+    std::uint32_t ngramRangeMax
+) :
+    _lowercase(std::move(lowercase)),
+    _analyzer(std::move(analyzer)),
+    _pRegex(
+        [&regexToken](void) -> std::shared_ptr<re2::RE2 const> {
+            if(regexToken.empty())
+                return std::shared_ptr<re2::RE2 const>();
+
+            return std::make_shared<re2::RE2>(regexToken);
+        }()
+    ),
+    _ngramRangeMin(std::move(ngramRangeMin)),
+    _ngramRangeMax(std::move(ngramRangeMax)) {
+}
+
+inline DocumentTokenizer::ScratchBuffers & DocumentTokenizer::GetScratchBuffers(void) {
+    static thread_local ScratchBuffers      scratch;
+
+    return scratch;
+}
+
+template <typename CallbackT>
+void DocumentTokenizer::Tokenize(std::string const &input, CallbackT const &callback) const {
+    Tokenize(input.data(), input.size(), callback);
+}
+
+template <typename CallbackT>
+void DocumentTokenizer::Tokenize(char const *pInput, size_t cInput, CallbackT const &callback) const {
+    ScratchBuffers &                        scratch(GetScratchBuffers());
+
+    // Reserve room for the padding added by the Charwb analyzer and the
+    // characters that may be written beyond the end of the data by `Normalize`.
+    scratch.Buffer.resize(cInput + 2 + 16);
+
+    if(_analyzer == AnalyzerMethod::Word) {
+        if(_pRegex)
+            TokenizeRegex(scratch, pInput, cInput, callback);
+        else if(_ngramRangeMin == 1 && _ngramRangeMax == 1)
+            TokenizeWords(scratch, pInput, cInput, callback);
+        else
+            TokenizeWordNgrams(scratch, pInput, cInput, callback);
+    }
+    else if(_analyzer == AnalyzerMethod::Char)
+        TokenizeChars(scratch, pInput, cInput, callback);
+    else {
+        assert(_analyzer == AnalyzerMethod::Charwb);
+        TokenizeCharwbs(scratch, pInput, cInput, callback);
+    }
+}
+
+template <bool ReplacePunctuationV, typename OnCharsT, typename OnWhitespaceT>
+size_t DocumentTokenizer::Normalize(ScratchBuffers &scratch, char const *pInput, size_t cInput, size_t offset, OnCharsT const &onChars, OnWhitespaceT const &onWhitespace) const {
+    char const * const                      pEnd(pInput + cInput);
+    char * const                            pBuffer(&scratch.Buffer[0]);
+    size_t                                  pos(offset);
+    bool                                    prevIsWhitespace(false);
+
+    while(pInput != pEnd) {
+        size_t const                        numChars(Details::CopyOrdinaryChars<ReplacePunctuationV>(pInput, pEnd, pBuffer + pos, _lowercase));
+
+        if(numChars != 0) {
+            onChars(pos, pos + numChars);
+
+            pInput += numChars;
+            pos += numChars;
+            prevIsWhitespace = false;
+
+            if(pInput == pEnd)
+                break;
+        }
+
+        char                                c(*pInput++);
+
+        if(ReplacePunctuationV) {
+            if(Details::IsPunctuation(c))
+                c = ' ';
+
+            if(prevIsWhitespace)
+                continue;
+
+            prevIsWhitespace = true;
+        }
+
+        pBuffer[pos] = c;
+        onWhitespace(pos);
+        ++pos;
+    }
+
+    return pos;
+}
+
+template <typename CallbackT>
+void DocumentTokenizer::TokenizeWords(ScratchBuffers &scratch, char const *pInput, size_t cInput, CallbackT const &callback) const {
+    StringIterator const                    begin(scratch.Buffer.cbegin());
+    size_t                                  wordStart(NoPosition);
+
+    size_t const                            length(
+        Normalize<false>(
+            scratch,
+            pInput,
+            cInput,
+            0,
+            [&wordStart](size_t start, size_t) {
+                if(wordStart == NoPosition)
+                    wordStart = start;
+            },
+            [&callback, &begin, &wordStart](size_t pos) {
+                if(wordStart != NoPosition) {
+                    callback(begin + static_cast<std::ptrdiff_t>(wordStart), begin + static_cast<std::ptrdiff_t>(pos));
+                    wordStart = NoPosition;
+                }
+            }
+        )
+    );
+
+    if(wordStart != NoPosition)
+        callback(begin + static_cast<std::ptrdiff_t>(wordStart), begin + static_cast<std::ptrdiff_t>(length));
+
+    scratch.Buffer.resize(length);
+}
+
+template <typename CallbackT>
+void DocumentTokenizer::TokenizeWordNgrams(ScratchBuffers &scratch, char const *pInput, size_t cInput, CallbackT const &callback) const {
+    StringIterator const                    begin(scratch.Buffer.cbegin());
+    size_t                                  wordStart(NoPosition);
+
+    scratch.Words.clear();
+
+    size_t const                            length(
+        Normalize<true>(
+            scratch,
+            pInput,
+            cInput,
+            0,
+            [&wordStart](size_t start, size_t) {
+                if(wordStart == NoPosition)
+                    wordStart = start;
+            },
+            [&scratch, &wordStart](size_t pos) {
+                if(wordStart != NoPosition) {
+                    scratch.Words.emplace_back(wordStart, pos);
+                    wordStart = NoPosition;
+                }
+            }
+        )
+    );
+
+    if(wordStart != NoPosition)
+        scratch.Words.emplace_back(wordStart, length);
+
+    scratch.Buffer.resize(length);
+
+    if(scratch.Words.empty())
+        throw std::invalid_argument("wordIterPairVector.size() == 0");
+
+    if(_ngramRangeMin < 1 || _ngramRangeMin > _ngramRangeMax || _ngramRangeMax > scratch.Words.size())
+        throw std::invalid_argument("ngramRangeMin and ngramRangeMax not valid");
+
+    for(size_t ngramRangeVal = _ngramRangeMin; ngramRangeVal <= _ngramRangeMax; ++ngramRangeVal) {
+        for(size_t wordIndex = 0; wordIndex < scratch.Words.size() - ngramRangeVal + 1; ++wordIndex)
+            callback(begin + static_cast<std::ptrdiff_t>(scratch.Words[wordIndex].first), begin + static_cast<std::ptrdiff_t>(scratch.Words[wordIndex + ngramRangeVal - 1].second));
+    }
+}
+
+template <typename CallbackT>
+void DocumentTokenizer::TokenizeChars(ScratchBuffers &scratch, char const *pInput, size_t cInput, CallbackT const &callback) const {
+    if(_ngramRangeMin < 1 || _ngramRangeMin > _ngramRangeMax)
+        throw std::invalid_argument("ngramRangeMin and ngramRangeMax not valid");
+
+    // Only n-grams of the minimum length are produced (which is consistent with
+    // `Strings::ParseNgramChar`); each is emitted as soon as its last character is written.
+    StringIterator const                    begin(scratch.Buffer.cbegin());
+    size_t const                            ngramLength(_ngramRangeMin);
+
+    auto const                              emitFunc(
+        [&callback, &begin, ngramLength](size_t end) {
+            if(end >= ngramLength)
+                callback(begin + static_cast<std::ptrdiff_t>(end - ngramLength), begin + static_cast<std::ptrdiff_t>(end));
+        }
+    );
+
+    size_t const                            length(
+        Normalize<true>(
+            scratch,
+            pInput,
+            cInput,
+            0,
+            [&emitFunc](size_t start, size_t end) {
+                while(start != end)
+                    emitFunc(++start);
+            },
+            [&emitFunc](size_t pos) {
+                emitFunc(pos + 1);
+            }
+        )
+    );
+
+    scratch.Buffer.resize(length);
+
+    if(_ngramRangeMax > length)
+        throw std::invalid_argument("ngramRangeMin and ngramRangeMax not valid");
+}
+
+template <typename CallbackT>
+void DocumentTokenizer::TokenizeCharwbs(ScratchBuffers &scratch, char const *pInput, size_t cInput, CallbackT const &callback) const {
+    // This is consistent with `Strings::Details::StringPadding`
+    if(cInput == 0)
+        throw std::out_of_range("input");
+
+    if(_ngramRangeMin < 1 || _ngramRangeMin > _ngramRangeMax)
+        throw std::invalid_argument("ngramRangeMin and ngramRangeMax not valid");
+
+    // N-grams of the minimum length are produced for each word, where the
+    // word includes the whitespace that surrounds it (see `Strings::ParseNgramCharwb`).
+    // A single whitespace character that is shared by 2 words is produced for
+    // each of those words.
+    StringIterator const                    begin(scratch.Buffer.cbegin());
+    size_t const                            ngramLength(_ngramRangeMin);
+    size_t                                  lastWhitespace(NoPosition);
+
+    auto const                              emitFunc(
+        [&callback, &begin, &lastWhitespace, ngramLength](size_t pos) {
+            if(lastWhitespace == NoPosition)
+                return;
+
+            if(ngramLength == 1 && pos == lastWhitespace + 1)
+                callback(begin + static_cast<std::ptrdiff_t>(lastWhitespace), begin + static_cast<std::ptrdiff_t>(pos));
+
+            if(pos + 1 - lastWhitespace >= ngramLength)
+                callback(begin + static_cast<std::ptrdiff_t>(pos + 1 - ngramLength), begin + static_cast<std::ptrdiff_t>(pos + 1));
+        }
+    );
+
+    auto const                              onWhitespaceFunc(
+        [&emitFunc, &lastWhitespace](size_t pos) {
+            emitFunc(pos);
+            lastWhitespace = pos;
+        }
+    );
+
+    size_t                                  offset(0);
+
+    if(Details::IsWhitespace(pInput[0]) == false && Details::IsPunctuation(pInput[0]) == false) {
+        scratch.Buffer[0] = ' ';
+        lastWhitespace = 0;
+        offset = 1;
+    }
+
+    size_t                                  length(
+        Normalize<true>(
+            scratch,
+            pInput,
+            cInput,
+            offset,
+            [&emitFunc](size_t start, size_t end) {
+                while(start != end)
+                    emitFunc(start++);
+            },
+            onWhitespaceFunc
+        )
+    );
+
+    if(Details::IsWhitespace(scratch.Buffer[length - 1]) == false) {
+        scratch.Buffer[length] = ' ';
+        onWhitespaceFunc(length);
+        ++length;
+    }
+
+    scratch.Buffer.resize(length);
+}
+
+template <typename CallbackT>
+void DocumentTokenizer::TokenizeRegex(ScratchBuffers &scratch, char const *pInput, size_t cInput, CallbackT const &callback) const {
+    // The terms are parsed from the buffer (even when the input isn't lowercased)
+    // so that they are always provided as `StringIterator`s.
+    scratch.Buffer.resize(
+        Normalize<false>(
+            scratch,
+            pInput,
+            cInput,
+            0,
+            [](size_t, size_t) {},
+            [](size_t) {}
+        )
+    );
+
+    Strings::ParseRegex(static_cast<std::string const &>(scratch.Buffer), *_pRegex, callback);
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,470 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../Archive.h"
+#include "../../Featurizer.h"
+#include "../../Traits.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         FrozenIndexMap
+///  \brief         Immutable map of strings to indexes that is optimized
+///                 for lookup and size.
+///
+///                 Strings are stored in a single contiguous arena and are
+///                 located with a minimal perfect hash (hash and displace);
+///                 a lookup hashes the string once and compares it with a
+///                 single candidate. All data lives in one block of 32-bit
+///                 words, which is written to (and read from) an `Archive`
+///                 as-is.
+///
+///                 Lookups are performed with a pointer and length, so callers
+///                 don't need to create a `std::string` for each lookup.
+///
+class FrozenIndexMap {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using IndexMap                          = std::unordered_map<std::string, std::uint32_t>;
+
+    /// Value returned by `find` when the string isn't in the map
+    static constexpr std::uint32_t          InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    explicit FrozenIndexMap(IndexMap const &map);
+    explicit FrozenIndexMap(Archive &ar);
+
+    ~FrozenIndexMap(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(FrozenIndexMap);
+
+    void save(Archive &ar) const;
+
+    bool operator==(FrozenIndexMap const &other) const;
+
+    size_t size(void) const;
+
+    /// Returns the index associated with the string or `InvalidIndex` if
+    /// the string isn't in the map.
+    std::uint32_t find(char const *pData, size_t cData) const;
+    std::uint32_t find(std::string const &value) const;
+
+    /// Invokes `func(char const *pData, size_t cData, std::uint32_t index)` for
+    /// each item in the map.
+    template <typename FunctionT>
+    void enumerate(FunctionT const &func) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+
+    // The data block contains:
+    //
+    //     Header:          NumItems, Seed, NumChars
+    //     Displacements:   [NumItems] (see `DirectSlotFlag`)
+    //     Slots:           [NumItems] x (Offset, Length, Index)
+    //     Chars:           [NumChars], padded to a multiple of 4 bytes
+    //
+    static constexpr size_t                 HeaderSize = 3;
+    static constexpr size_t                 SlotSize = 3;
+
+    // A displacement with this bit set is the slot of the only item in its
+    // bucket; other values are used to calculate the slot for items in the bucket.
+    static constexpr std::uint32_t          DirectSlotFlag = 0x80000000;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<std::uint32_t>              _data;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    static std::uint64_t Hash(char const *pData, size_t cData, std::uint32_t seed);
+    static std::uint64_t Mix(std::uint64_t value);
+    static std::uint32_t GetSlot(std::uint64_t hash, std::uint32_t displacement, std::uint32_t numItems);
+
+    static std::vector<std::uint32_t> Create(IndexMap const &map);
+    static std::vector<std::uint32_t> Deserialize(Archive &ar);
+
+    /// Returns false if it wasn't possible to create a perfect hash with the seed
+    static bool Populate(std::vector<IndexMap::value_type const *> const &items, std::uint32_t seed, std::uint32_t *pDisplacements, std::uint32_t *pSlots);
+
+    char const * GetChars(void) const;
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+inline FrozenIndexMap::FrozenIndexMap(IndexMap const &map) :
+    _data(Create(map)) {
+}
+
+inline FrozenIndexMap::FrozenIndexMap(Archive &ar) :
+    _data(Deserialize(ar)) {
+}
+
+inline void FrozenIndexMap::save(Archive &ar) const {
+    Traits<std::uint32_t>::serialize(ar, static_cast<std::uint32_t>(_data.size()));
+    ar.serialize_array(_data.data(), _data.size());
+}
+
+inline bool FrozenIndexMap::operator==(FrozenIndexMap const &other) const {
+    return _data == other._data;
+}
+
+inline size_t FrozenIndexMap::size(void) const {
+    return _data[0];
+}
+
+inline std::uint32_t FrozenIndexMap::find(char const *pData, size_t cData) const {
+    std::uint32_t const                     numItems(_data[0]);
+
+    if(numItems == 0)
+        return InvalidIndex;
+
+    std::uint64_t const                     hash(Hash(pData, cData, _data[1]));
+    std::uint32_t const                     displacement(_data[HeaderSize + static_cast<size_t>(hash % numItems)]);
+    std::uint32_t const                     slot(
+        (displacement & DirectSlotFlag) ? (displacement & ~DirectSlotFlag) : GetSlot(hash, displacement, numItems)
+    );
+    std::uint32_t const * const             pSlot(_data.data() + HeaderSize + numItems + slot * SlotSize);
+
+    if(pSlot[1] != cData || (cData != 0 && std::memcmp(GetChars() + pSlot[0], pData, cData) != 0))
+        return InvalidIndex;
+
+    return pSlot[2];
+}
+
+inline std::uint32_t FrozenIndexMap::find(std::string const &value) const {
+    return find(value.data(), value.size());
+}
+
+template <typename FunctionT>
+void FrozenIndexMap::enumerate(FunctionT const &func) const {
+    std::uint32_t const                     numItems(_data[0]);
+    std::uint32_t const *                   pSlot(_data.data() + HeaderSize + numItems);
+    char const * const                      pChars(GetChars());
+
+    for(std::uint32_t slot = 0; slot < numItems; ++slot) {
+        func(pChars + pSlot[0], static_cast<size_t>(pSlot[1]), pSlot[2]);
+        pSlot += SlotSize;
+    }
+}
+
+inline std::uint64_t FrozenIndexMap::Hash(char const *pData, size_t cData, std::uint32_t seed) {
+    // FNV-1a, seeded by the perfect hash seed
+    std::uint64_t                           hash(14695981039346656037ull ^ Mix(seed));
+    char const * const                      pEnd(pData + cData);
+
+    while(pData != pEnd) {
+        hash ^= static_cast<unsigned char>(*pData++);
+        hash *= 1099511628211ull;
+    }
+
+    return Mix(hash);
+}
+
+inline std::uint64_t FrozenIndexMap::Mix(std::uint64_t value) {
+    // splitmix64 finalizer
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ull;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebull;
+    value ^= value >> 31;
+
+    return value;
+}
+
+inline std::uint32_t FrozenIndexMap::GetSlot(std::uint64_t hash, std::uint32_t displacement, std::uint32_t numItems) {
+    return static_cast<std::uint32_t>(Mix(hash + displacement * 0x9e3779b97f4a7c15ull) % numItems);
+}
+
+inline std::vector<std::uint32_t> FrozenIndexMap::Create(IndexMap const &map) {
+    if(map.size() >= DirectSlotFlag)
+        throw std::invalid_argument("'map' contains too many items");
+
+    // Sort the items so that the result doesn't depend on the order of the
+    // items in the unordered_map.
+    std::vector<IndexMap::value_type const *>   items;
+    size_t                                      numChars(0);
+
+    items.reserve(map.size());
+
+    for(auto const & kvp : map) {
+        if(kvp.second == InvalidIndex)
+            throw std::invalid_argument("'map' contains an invalid index");
+
+        items.emplace_back(&kvp);
+        numChars += kvp.first.size();
+    }
+
+    if(numChars > std::numeric_limits<std::uint32_t>::max())
+        throw std::invalid_argument("'map' contains too many characters");
+
+    std::sort(
+        items.begin(),
+        items.end(),
+        [](IndexMap::value_type const *pA, IndexMap::value_type const *pB) {
+            return pA->first < pB->first;
+        }
+    );
+
+    size_t const                            numItems(items.size());
+    std::vector<std::uint32_t>              result(HeaderSize + numItems + numItems * SlotSize + (numChars + sizeof(std::uint32_t) - 1) / sizeof(std::uint32_t), 0);
+
+    result[0] = static_cast<std::uint32_t>(numItems);
+    result[2] = static_cast<std::uint32_t>(numChars);
+
+    std::uint32_t * const                   pDisplacements(result.data() + HeaderSize);
+    std::uint32_t * const                   pSlots(pDisplacements + numItems);
+    char * const                            pChars(reinterpret_cast<char *>(pSlots + numItems * SlotSize));
+
+    // Perfect hash creation will succeed with the first seed except in pathological cases
+    std::uint32_t                           seed(0);
+
+    while(Populate(items, seed, pDisplacements, pSlots) == false) {
+        if(++seed == 64)
+            throw std::runtime_error("Unable to create the perfect hash");
+    }
+
+    result[1] = seed;
+
+    // Copy the chars; slots currently contain the item index as the offset
+    std::vector<std::uint32_t>              offsets;
+    std::uint32_t                           offset(0);
+
+    offsets.reserve(numItems);
+
+    for(auto const *pItem : items) {
+        offsets.emplace_back(offset);
+
+        if(pItem->first.empty() == false)
+            std::memcpy(pChars + offset, pItem->first.data(), pItem->first.size());
+
+        offset += static_cast<std::uint32_t>(pItem->first.size());
+    }
+
+    std::uint32_t *                         pSlot(pSlots);
+
+    for(size_t slot = 0; slot < numItems; ++slot) {
+        IndexMap::value_type const &        item(*items[pSlot[0]]);
+
+        pSlot[0] = offsets[pSlot[0]];
+        pSlot[1] = static_cast<std::uint32_t>(item.first.size());
+        pSlot[2] = item.second;
+
+        pSlot += SlotSize;
+    }
+
+    return result;
+}
+
+inline bool FrozenIndexMap::Populate(std::vector<IndexMap::value_type const *> const &items, std::uint32_t seed, std::uint32_t *pDisplacements, std::uint32_t *pSlots) {
+    std::uint32_t const                     numItems(static_cast<std::uint32_t>(items.size()));
+
+    if(numItems == 0)
+        return true;
+
+    // Group the items by bucket
+    std::vector<std::uint64_t>              hashes;
+    std::vector<std::uint32_t>              bucketStarts(numItems + 1, 0);
+
+    hashes.reserve(numItems);
+
+    for(auto const *pItem : items) {
+        hashes.emplace_back(Hash(pItem->first.data(), pItem->first.size(), seed));
+        ++bucketStarts[static_cast<size_t>(hashes.back() % numItems) + 1];
+    }
+
+    for(size_t bucket = 0; bucket < numItems; ++bucket)
+        bucketStarts[bucket + 1] += bucketStarts[bucket];
+
+    std::vector<std::uint32_t>              bucketItems(numItems);
+
+    {
+        std::vector<std::uint32_t>          positions(bucketStarts.begin(), bucketStarts.end() - 1);
+
+        for(std::uint32_t item = 0; item < numItems; ++item)
+            bucketItems[positions[static_cast<size_t>(hashes[item] % numItems)]++] = item;
+    }
+
+    // Place the largest buckets first, as they are the most difficult to place
+    std::vector<std::uint32_t>              buckets(numItems);
+
+    for(std::uint32_t bucket = 0; bucket < numItems; ++bucket)
+        buckets[bucket] = bucket;
+
+    std::stable_sort(
+        buckets.begin(),
+        buckets.end(),
+        [&bucketStarts](std::uint32_t a, std::uint32_t b) {
+            return bucketStarts[a + 1] - bucketStarts[a] > bucketStarts[b + 1] - bucketStarts[b];
+        }
+    );
+
+    std::vector<bool>                       isOccupied(numItems, false);
+    std::vector<std::uint32_t>              candidates;
+    std::vector<std::uint32_t>::const_iterator
+                                            iBucket(buckets.begin());
+
+    std::fill(pDisplacements, pDisplacements + numItems, 0);
+
+    while(iBucket != buckets.end()) {
+        std::uint32_t const                 bucket(*iBucket);
+        std::uint32_t const * const         pItemsBegin(bucketItems.data() + bucketStarts[bucket]);
+        std::uint32_t const * const         pItemsEnd(bucketItems.data() + bucketStarts[bucket + 1]);
+
+        if(pItemsEnd - pItemsBegin < 2)
+            break;
+
+        std::uint32_t                       displacement(1);
+
+        while(true) {
+            if(displacement == DirectSlotFlag)
+                return false;
+
+            candidates.clear();
+
+            for(std::uint32_t const *pItem = pItemsBegin; pItem != pItemsEnd; ++pItem) {
+                std::uint32_t const         slot(GetSlot(hashes[*pItem], displacement, numItems));
+
+                if(isOccupied[slot] || std::find(candidates.begin(), candidates.end(), slot) != candidates.end())
+                    break;
+
+                candidates.emplace_back(slot);
+            }
+
+            if(candidates.size() == static_cast<size_t>(pItemsEnd - pItemsBegin))
+                break;
+
+            // Items with the same hash can never be separated
+            if(displacement == 1) {
+                for(std::uint32_t const *pItem = pItemsBegin; pItem != pItemsEnd; ++pItem) {
+                    for(std::uint32_t const *pOther = pItem + 1; pOther != pItemsEnd; ++pOther) {
+                        if(hashes[*pItem] == hashes[*pOther])
+                            return false;
+                    }
+                }
+            }
+
+            ++displacement;
+        }
+
+        pDisplacements[bucket] = displacement;
+
+        for(size_t index = 0; index < candidates.size(); ++index) {
+            isOccupied[candidates[index]] = true;
+            pSlots[candidates[index] * SlotSize] = pItemsBegin[index];
+        }
+
+        ++iBucket;
+    }
+
+    // The remaining buckets contain at most 1 item, which can be placed directly
+    std::uint32_t                           freeSlot(0);
+
+    while(iBucket != buckets.end()) {
+        std::uint32_t const                 bucket(*iBucket);
+
+        if(bucketStarts[bucket] == bucketStarts[bucket + 1])
+            break;
+
+        while(isOccupied[freeSlot])
+            ++freeSlot;
+
+        isOccupied[freeSlot] = true;
+        pDisplacements[bucket] = DirectSlotFlag | freeSlot;
+        pSlots[freeSlot * SlotSize] = bucketItems[bucketStarts[bucket]];
+
+        ++iBucket;
+    }
+
+    return true;
+}
+
+inline std::vector<std::uint32_t> FrozenIndexMap::Deserialize(Archive &ar) {
+    std::uint32_t const                     numWords(Traits<std::uint32_t>::deserialize(ar));
+
+    if(numWords < HeaderSize)
+        throw std::runtime_error("Invalid FrozenIndexMap data");
+
+    // Ensure that the archive contains the data before allocating memory for
+    // it, as `numWords` may be corrupt
+    size_t const                            numBytes(numWords * sizeof(std::uint32_t));
+    unsigned char const * const             pBuffer(ar.get_buffer_ptr());
+
+    ar.update_buffer_ptr(numBytes);
+
+    std::vector<std::uint32_t>              result(numWords);
+
+    Archive(pBuffer, numBytes).deserialize_array(result.data(), result.size());
+
+    // Validate the data
+    std::uint64_t const                     numItems(result[0]);
+    std::uint64_t const                     numChars(result[2]);
+
+    if(
+        numItems >= DirectSlotFlag
+        || HeaderSize + numItems + numItems * SlotSize + (numChars + sizeof(std::uint32_t) - 1) / sizeof(std::uint32_t) != numWords
+    )
+        throw std::runtime_error("Invalid FrozenIndexMap data");
+
+    std::uint32_t const * const             pDisplacements(result.data() + HeaderSize);
+    std::uint32_t const * const             pSlots(pDisplacements + numItems);
+
+    for(std::uint32_t const *pDisplacement = pDisplacements; pDisplacement != pSlots; ++pDisplacement) {
+        if((*pDisplacement & DirectSlotFlag) && (*pDisplacement & ~DirectSlotFlag) >= numItems)
+            throw std::runtime_error("Invalid FrozenIndexMap data");
+    }
+
+    for(std::uint32_t const *pSlot = pSlots; pSlot != pSlots + numItems * SlotSize; pSlot += SlotSize) {
+        if(static_cast<std::uint64_t>(pSlot[0]) + pSlot[1] > numChars)
+            throw std::runtime_error("Invalid FrozenIndexMap data");
+    }
+
+    return result;
+}
+
+inline char const * FrozenIndexMap::GetChars(void) const {
+    return reinterpret_cast<char const *>(_data.data() + HeaderSize + _data[0] + _data[0] * SlotSize);
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
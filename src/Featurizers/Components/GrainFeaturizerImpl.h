@@ -4,11 +4,16 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
+#include <deque>
+#include <list>
 #include <unordered_map>
 
 #include "../../Archive.h"
 #include "../../Featurizer.h"
 #include "Details/EstimatorTraits.h"
+#include "GrainIndex.h"
+#include "ThreadPool.h"
 
 namespace Microsoft {
 namespace Featurizer {
@@ -67,11 +72,27 @@ struct GrainFeaturizerTraits {
     using TransformedType                   = std::tuple<GrainT const &, typename Details::EstimatorOutputType<EstimatorT>::type>;
 };
 
+/////////////////////////////////////////////////////////////////////////
+///  \enum          GrainOutputOrder
+///  \brief         The order in which `GrainTransformer::execute_parallel`
+///                 provides output.
+///
+enum class GrainOutputOrder {
+    Input,                                  /// Output is in the order of the input items
+    Grain                                   /// Output is grouped by grain (in sorted order); output for a grain is in the order of the grain's input items
+};
+
 /////////////////////////////////////////////////////////////////////////
 ///  \class         GrainTransformer
 ///  \brief         A Transformer that applies a Transformer unique to the
 ///                 observed grain using grain-specific state.
 ///
+///                 Each grain's Transformer is serialized separately, along with
+///                 a table of offsets keyed by grain. When deserialized, a
+///                 grain's Transformer is only created when the grain is first
+///                 encountered, and Transformers that haven't been used
+///                 recently can be evicted (see `set_max_materialized_bytes`).
+///
 template <typename GrainT, typename EstimatorT>
 class GrainTransformer :
     public Transformer<
@@ -101,6 +122,10 @@ public:
     using GrainTransformerTypeUniquePtr     = std::unique_ptr<GrainTransformerType>;
     using TransformerMap                    = std::map<GrainT, GrainTransformerTypeUniquePtr>;
 
+    using GrainIndexType                    = GrainIndex<GrainT>;
+    using GrainIdType                       = typename GrainIndexType::IdType;
+    using TransformerVector                 = std::vector<GrainTransformerTypeUniquePtr>;
+
     using CreateTransformerFunc             = std::function<GrainTransformerTypeUniquePtr (void)>;
 
     // ----------------------------------------------------------------------
@@ -112,6 +137,10 @@ public:
     // The `createFunc` is invoked (if available) when a grain is encountered during
     // prediction time that wasn't seen during training.
     GrainTransformer(TransformerMap transformers, CreateTransformerFunc createFunc=CreateTransformerFunc());
+
+    // `transformers` contains the Transformer for each grain in `grains`, indexed by grain id.
+    GrainTransformer(GrainIndexType grains, TransformerVector transformers, CreateTransformerFunc createFunc=CreateTransformerFunc());
+
     GrainTransformer(CreateTransformerFunc createFunc);
 
     GrainTransformer(Archive &ar);
@@ -126,6 +155,45 @@ public:
 
     void save(Archive &ar) const override;
 
+    using BaseType::execute;
+
+    /// Returns the id associated with the grain, creating a Transformer for the
+    /// grain if it wasn't encountered during training (and `createFunc` was provided).
+    /// Callers that transform many rows can look up each unique grain once and
+    /// then transform rows by id, avoiding per-row grain hashing and comparisons.
+    GrainIdType get_grain_id(GrainT const &grain);
+
+    /// Transforms `cItems` items, where `pGrainIds[i]` is the id (returned by
+    /// `get_grain_id`) of the grain associated with `pItems[i]`.
+    void execute(GrainIdType const *pGrainIds, typename EstimatorT::InputType const *pItems, size_t cItems, typename BaseType::CallbackFunction const &callback);
+
+    /// Transforms `cItems` items using the threads in `pool`. Items are grouped
+    /// by grain and each grain's Transformer processes its items (in their
+    /// original order) on one of the threads, so the Transformer for each grain
+    /// sees the same sequence of items as it would with `execute`. Output is
+    /// buffered and provided to `callback` on the calling thread once all of the
+    /// items have been transformed.
+    void execute_parallel(
+        ThreadPool &pool,
+        typename BaseType::InputType const *pItems,
+        size_t cItems,
+        typename BaseType::CallbackFunction const &callback,
+        GrainOutputOrder order=GrainOutputOrder::Input
+    );
+
+    /// Limits the size of the per-grain Transformers that are created from the
+    /// archive used to deserialize this object. When the serialized size of the
+    /// materialized Transformers exceeds `maxBytes`, the least recently used
+    /// Transformers are destroyed and will be deserialized again when their
+    /// grains are next encountered. Note that an evicted Transformer loses any
+    /// state that it accumulated while transforming data, so eviction should
+    /// only be used with Transformers whose output doesn't depend on previously
+    /// transformed items. Transformers created by `createFunc` are never evicted.
+    void set_max_materialized_bytes(size_t maxBytes);
+
+    /// Returns the number of per-grain Transformers that have been created.
+    size_t num_materialized_transformers(void) const;
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -134,6 +202,29 @@ private:
     // ----------------------------------------------------------------------
     struct UseDeserializationCtorTag {};
 
+    struct SerializedTransformers {
+        // Shares the buffer of the archive used to deserialize this object when that
+        // archive owns its buffer; an archive in serialization mode indicates that
+        // there isn't any data.
+        Archive                             Data;
+
+        // The offset of each grain's Transformer in `Data` (indexed by grain id),
+        // followed by the size of `Data`.
+        std::vector<std::uint64_t>          Offsets;
+    };
+
+    using GrainIdList                       = std::list<GrainIdType>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+
+    // The first value in an archive that contains a grain offset table (archives
+    // without the table start with the number of grains).
+    static constexpr std::uint64_t          IndexedLayoutMarker = std::numeric_limits<std::uint64_t>::max();
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
@@ -147,40 +238,32 @@ private:
     Archive const                           _createFuncArchive;
     CreateTransformerFunc const             _createFunc;
 
-    TransformerMap                          _transformers;
+    GrainIndexType                          _grains;
+
+    // Indexed by grain id; the Transformer is null for deserialized grains that
+    // haven't been encountered (or whose Transformer was evicted).
+    TransformerVector                       _transformers;
+    SerializedTransformers const            _serialized;
+
+    size_t                                  _maxMaterializedBytes;
+    size_t                                  _cMaterializedBytes;
+
+    // Deserialized grains with materialized Transformers, most recently used first;
+    // only maintained when `_maxMaterializedBytes` has been set.
+    GrainIdList                             _lruIds;
+    std::vector<typename GrainIdList::iterator>                     _lruPositions;  // Indexed by grain id
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
-    GrainTransformer(TransformerMap transformers, Archive createFuncArchive, UseDeserializationCtorTag);
+    GrainTransformer(GrainIndexType grains, TransformerVector transformers, SerializedTransformers serialized, Archive createFuncArchive, UseDeserializationCtorTag);
 
     // MSVC has problems when the declaration and definition are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
         GrainT const &                      grain(std::get<0>(input));
-        GrainTransformerType &              transformer(
-            [this, &grain](void) -> GrainTransformerType & {
-
-                typename TransformerMap::iterator const                     iter(
-                    [this, &grain]() {
-                        typename TransformerMap::iterator const             i(_transformers.find(grain));
-
-                        if(i != _transformers.end())
-                            return i;
-
-                        if(!_createFunc)
-                            throw std::runtime_error("Grain not found");
-
-                        return _transformers.emplace(grain, _createFunc()).first;
-                    }()
-                );
-
-                assert(iter->second);
-                return *iter->second;
-            }()
-        );
-
+        GrainTransformerType &              transformer(GetTransformer(get_grain_id(grain)));
         typename EstimatorT::InputType const &          grainInput(std::get<1>(input));
 
         transformer.execute(
@@ -193,16 +276,37 @@ private:
 
     // MSVC has problems when the declaration and definition are separated
     void flush_impl(typename BaseType::CallbackFunction const &callback) override {
-        for(auto &kvp : _transformers) {
-            kvp.second->flush(
-                [&callback, &kvp](typename EstimatorT::TransformedType output) {
-                    callback(typename TheseGrainFeaturizerTraits::TransformedType(kvp.first, std::move(output)));
+        // Flush in grain order so that the output doesn't depend on the order in which
+        // grains were encountered. Deserialized grains whose Transformers aren't
+        // materialized haven't transformed any data (or were evicted, which discards
+        // their state), so they are skipped rather than deserialized just to be flushed.
+        for(GrainIdType id : _grains.sorted_ids()) {
+            if(!_transformers[id])
+                continue;
+
+            GrainT const &                  grain(_grains[id]);
+
+            _transformers[id]->flush(
+                [&callback, &grain](typename EstimatorT::TransformedType output) {
+                    callback(typename TheseGrainFeaturizerTraits::TransformedType(grain, std::move(output)));
                 }
             );
         }
     }
 
     GrainTransformerTypeUniquePtr CreateTransformerFromArchive(void) const;
+
+    size_t GetNumSerializedTransformers(void) const;
+    size_t GetSerializedSize(GrainIdType id) const;
+    unsigned char const * GetSerializedData(GrainIdType id) const;
+
+    /// Returns the grain's Transformer, deserializing it if necessary. Transformers
+    /// are only evicted when `evict` is true.
+    GrainTransformerType & GetTransformer(GrainIdType id, bool evict=true);
+
+    /// Evicts the least recently used Transformers (other than `keepId`) until
+    /// the materialized size is within `_maxMaterializedBytes`.
+    void EvictTransformers(GrainIdType keepId);
 };
 
 namespace Impl {
@@ -245,20 +349,49 @@ public:
     static GrainEstimatorAnnotation const & get_annotation(AnnotationMaps const &columnAnnotations, size_t colIndex, char const *name);
     static GrainEstimatorAnnotation const * get_annotation_nothrow(AnnotationMaps const &columnAnnotations, size_t colIndex, char const *name);
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            set_num_training_threads
+    ///  \brief         Trains the per-grain `Estimators` on `numThreads` threads
+    ///                 (0 uses one thread per hardware thread, 1 disables
+    ///                 multi-threaded training). Must be invoked before training
+    ///                 begins.
+    ///
+    ///                 When enabled, the rows in each call to `fit` are grouped
+    ///                 by grain and each grain's rows are provided (in their
+    ///                 original order) to its `Estimator` on one of the threads;
+    ///                 `complete_training` is invoked concurrently as well.
+    ///                 Each per-grain `Estimator` is created with its own copy of
+    ///                 the `AnnotationMaps`, so per-grain `Estimators` must not
+    ///                 share other mutable state. Results (including grain-based
+    ///                 `Annotations`) are the same as single-threaded training.
+    ///
+    ///                 This setting has no effect on inference-only estimators.
+    ///                 The rolling window and LagLead featurizers are
+    ///                 inference-only, so they don't train anything. Their
+    ///                 per-grain work happens during inference, where
+    ///                 `GrainTransformer::execute_parallel` distributes it.
+    ///
+    void set_num_training_threads(size_t numThreads);
+
 protected:
     // ----------------------------------------------------------------------
     // |
     // |  Protected Types
     // |
     // ----------------------------------------------------------------------
-    using EstimatorMap                      = std::map<GrainT, EstimatorT>;
+    using GrainIndexType                    = GrainIndex<GrainT>;
+    using GrainIdType                       = typename GrainIndexType::IdType;
+
+    // A deque is used so that Estimators aren't moved once training has begun
+    using EstimatorDeque                    = std::deque<EstimatorT>;
 
     // ----------------------------------------------------------------------
     // |
     // |  Protected Data
     // |
     // ----------------------------------------------------------------------
-    EstimatorMap                            _estimators;
+    GrainIndexType                          _grains;
+    EstimatorDeque                          _estimators;        // Indexed by grain id
 
 private:
     // ----------------------------------------------------------------------
@@ -275,6 +408,18 @@ private:
 
     size_t                                  _cRemainingTrainingItems;
 
+    // The following values are only used with multi-threaded training
+    std::unique_ptr<ThreadPool>             _pThreadPool;
+    std::vector<AnnotationMapsPtr>          _grainColumnAnnotations;    // Indexed by grain id
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using GrainEstimatorAnnotationMap       = typename GrainEstimatorAnnotation::AnnotationMap;
+    using Sizes                             = std::vector<size_t>;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
@@ -283,6 +428,26 @@ private:
     bool begin_training_impl(void) override;
     FitResult fit_impl(InputType const *pItems, size_t cItems) override;
     void complete_training_impl(void) override;
+
+    /// Returns the id of the grain, creating its `Estimator` (and beginning
+    /// training) if the grain hasn't been encountered.
+    GrainIdType GetEstimatorId(GrainT const &grain);
+
+    void FitParallel(InputType const *pItems, size_t cItems);
+
+    static void FitGrainEstimator(EstimatorT &estimator, typename EstimatorT::InputType const &input);
+    static Sizes GetSizes(AnnotationMaps const &columnAnnotations);
+
+    /// Moves the `Annotation` created by a per-grain `Estimator` during
+    /// `complete_training` (if any) from `columnAnnotations` to `newAnnotations`.
+    static void ExtractGrainAnnotation(
+        GrainT const &grain,
+        EstimatorT const &estimator,
+        AnnotationMaps &columnAnnotations,
+        Sizes const &sizes,
+        GrainEstimatorAnnotationMap &newAnnotations,
+        size_t &colIndex
+    );
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -450,10 +615,12 @@ private:
     // |
     // ----------------------------------------------------------------------
     typename BaseType::TransformerUniquePtr create_transformer_impl(void) override {
-        typename TransformerType::TransformerMap        transformers;
+        typename TransformerType::TransformerVector     transformers;
+
+        transformers.reserve(this->_estimators.size());
 
-        for(auto & kvp: this->_estimators)
-            transformers.emplace(std::make_pair(kvp.first, kvp.second.create_transformer()));
+        for(auto & estimator: this->_estimators)
+            transformers.emplace_back(estimator.create_transformer());
 
         if(transformers.empty()) {
             if(!_createTransformerFunc)
@@ -462,10 +629,11 @@ private:
             return typename BaseType::TransformerUniquePtr(new TransformerType(_createTransformerFunc));
         }
 
+        // The Transformer's grain ids match the Estimator's grain ids
         if(_createTransformerFunc)
-            return typename BaseType::TransformerUniquePtr(new TransformerType(std::move(transformers), _createTransformerFunc));
+            return typename BaseType::TransformerUniquePtr(new TransformerType(this->_grains, std::move(transformers), _createTransformerFunc));
 
-        return typename BaseType::TransformerUniquePtr(new TransformerType(std::move(transformers)));
+        return typename BaseType::TransformerUniquePtr(new TransformerType(this->_grains, std::move(transformers)));
     }
 };
 
@@ -542,23 +710,61 @@ GrainTransformer<GrainT, EstimatorT>::GrainTransformer(CreateTransformerFunc cre
                 return createFunc;
             }()
         )
-    ) {
+    ),
+    _maxMaterializedBytes(std::numeric_limits<size_t>::max()),
+    _cMaterializedBytes(0) {
 }
 
 template <typename GrainT, typename EstimatorT>
 GrainTransformer<GrainT, EstimatorT>::GrainTransformer(TransformerMap transformers, CreateTransformerFunc createFunc/*=CreateTransformerFunc()*/) :
+    GrainTransformer(
+        [&transformers](void) {
+            GrainIndexType                  grains;
+
+            for(auto const &kvp : transformers)
+                grains.insert(kvp.first);
+
+            return grains;
+        }(),
+        [&transformers](void) {
+            TransformerVector               result;
+
+            result.reserve(transformers.size());
+
+            for(auto &kvp : transformers)
+                result.emplace_back(std::move(kvp.second));
+
+            return result;
+        }(),
+        std::move(createFunc)
+    ) {
+}
+
+template <typename GrainT, typename EstimatorT>
+GrainTransformer<GrainT, EstimatorT>::GrainTransformer(GrainIndexType grains, TransformerVector transformers, CreateTransformerFunc createFunc/*=CreateTransformerFunc()*/) :
     _hadTransformersWhenCreated(true),
     _createFunc(std::move(createFunc)),
+    _grains(std::move(grains)),
     _transformers(
         std::move(
-            [&transformers](void) -> TransformerMap & {
+            [this, &transformers](void) -> TransformerVector & {
                 if(transformers.empty())
                     throw std::invalid_argument("transformers");
 
+                if(transformers.size() != _grains.size())
+                    throw std::invalid_argument("'transformers' and 'grains' must have the same number of elements");
+
+                for(auto const &pTransformer : transformers) {
+                    if(!pTransformer)
+                        throw std::invalid_argument("transformers");
+                }
+
                 return transformers;
             }()
         )
-    ) {
+    ),
+    _maxMaterializedBytes(std::numeric_limits<size_t>::max()),
+    _cMaterializedBytes(0) {
 }
 
 template <typename GrainT, typename EstimatorT>
@@ -566,28 +772,75 @@ GrainTransformer<GrainT, EstimatorT>::GrainTransformer(Archive &ar) :
     GrainTransformer(
         [&ar](void) -> GrainTransformer {
             std::uint64_t                   cElements(Traits<std::uint64_t>::deserialize(ar));
-            TransformerMap                  transformers;
+            GrainIndexType                  grains;
+            TransformerVector               transformers;
+            SerializedTransformers          serialized(
+                [&ar, &cElements, &grains, &transformers](void) -> SerializedTransformers {
+                    if(cElements != IndexedLayoutMarker) {
+                        while(cElements--) {
+                            GrainT                              grain(Traits<GrainT>::deserialize(ar));
+                            GrainTransformerTypeUniquePtr       pTransformer(new typename EstimatorT::TransformerType(ar));
 
-            while(cElements--) {
-                GrainT                                  grain(Traits<GrainT>::deserialize(ar));
-                GrainTransformerTypeUniquePtr           pTransformer(new typename EstimatorT::TransformerType(ar));
+                            if(grains.insert(grain).second == false)
+                                throw std::runtime_error("Invalid insertion");
 
-                std::pair<typename TransformerMap::iterator, bool> const    result(transformers.emplace(std::make_pair(std::move(grain), std::move(pTransformer))));
+                            transformers.emplace_back(std::move(pTransformer));
+                        }
 
-                if(result.first == transformers.end() || result.second == false)
-                    throw std::runtime_error("Invalid insertion");
-            }
+                        return SerializedTransformers{ Archive(), std::vector<std::uint64_t>() };
+                    }
 
-            bool                            hasCreateFunc(Traits<bool>::deserialize(ar));
+                    // Read the grains and offsets, but don't create the Transformers until they are needed
+                    std::vector<std::uint64_t>      offsets;
 
-            if(hasCreateFunc == false) {
-                if(transformers.empty())
-                    throw std::runtime_error("A `createFunc` must be provided to the serializing object when there aren't any transformers in the transformer map");
+                    cElements = Traits<std::uint64_t>::deserialize(ar);
 
-                return GrainTransformer(std::move(transformers));
-            }
+                    while(cElements--) {
+                        GrainT                              grain(Traits<GrainT>::deserialize(ar));
+                        std::uint64_t                       offset(Traits<std::uint64_t>::deserialize(ar));
+
+                        if(grains.insert(grain).second == false)
+                            throw std::runtime_error("Invalid insertion");
+
+                        if(offsets.empty() == false && offset < offsets.back())
+                            throw std::runtime_error("Invalid offset");
+
+                        offsets.emplace_back(offset);
+                    }
 
-            return GrainTransformer(std::move(transformers), ar.clone(), UseDeserializationCtorTag());
+                    std::uint64_t const             cbData(Traits<std::uint64_t>::deserialize(ar));
+
+                    if(offsets.empty() == false) {
+                        if(offsets.back() > cbData)
+                            throw std::runtime_error("Invalid offset");
+
+                        offsets.emplace_back(cbData);
+                    }
+
+                    if(cbData > std::numeric_limits<size_t>::max())
+                        throw std::runtime_error("Invalid offset");
+
+                    transformers.resize(grains.size());
+
+                    return SerializedTransformers{
+                        cbData != 0 ? ar.extract(static_cast<size_t>(cbData)) : Archive(),
+                        std::move(offsets)
+                    };
+                }()
+            );
+
+            bool                            hasCreateFunc(Traits<bool>::deserialize(ar));
+
+            if(hasCreateFunc == false && grains.empty())
+                throw std::runtime_error("A `createFunc` must be provided to the serializing object when there aren't any transformers in the transformer map");
+
+            return GrainTransformer(
+                std::move(grains),
+                std::move(transformers),
+                std::move(serialized),
+                hasCreateFunc ? ar.clone() : Archive(),
+                UseDeserializationCtorTag()
+            );
         }()
     )
 {}
@@ -604,21 +857,72 @@ GrainTransformer<GrainT, EstimatorT>::GrainTransformer(GrainTransformer && other
             return [this](void) { return CreateTransformerFromArchive(); };
         }()
     ),
-    _transformers(std::move(make_mutable(other._transformers)))
-{}
+    _grains(std::move(make_mutable(other._grains))),
+    _transformers(std::move(make_mutable(other._transformers))),
+    _serialized(std::move(make_mutable(other._serialized))),
+    _maxMaterializedBytes(std::numeric_limits<size_t>::max()),
+    _cMaterializedBytes(0) {
+    // Positions in the other object's list aren't valid for this object, so
+    // recreate the list (recency information is lost, which is OK).
+    if(other._maxMaterializedBytes != std::numeric_limits<size_t>::max())
+        set_max_materialized_bytes(other._maxMaterializedBytes);
+}
 
 template <typename GrainT, typename EstimatorT>
 void GrainTransformer<GrainT, EstimatorT>::save(Archive &ar) const /*override*/ {
+    std::uint64_t const                     marker(IndexedLayoutMarker);
+
+    Traits<std::uint64_t>::serialize(ar, marker);
+
     if(_hadTransformersWhenCreated) {
-        Traits<std::uint64_t>::serialize(ar, _transformers.size());
+        // Serialize in grain order so that the archive doesn't depend on the order in
+        // which grains were encountered.
+        typename GrainIndexType::IdVector const         ids(_grains.sorted_ids());
+        Archive::ByteArray                              data;
+        std::vector<std::uint64_t>                      offsets;
+
+        offsets.reserve(ids.size());
+
+        for(GrainIdType id : ids) {
+            offsets.emplace_back(data.size());
+
+            if(_transformers[id]) {
+                Archive                     transformerArchive;
+
+                _transformers[id]->save(transformerArchive);
 
-        for(auto const &kvp: _transformers) {
-            Traits<GrainT>::serialize(ar, kvp.first);
-            kvp.second->save(ar);
+                Archive::ByteArray const    transformerData(transformerArchive.commit());
+
+                data.insert(data.end(), transformerData.begin(), transformerData.end());
+            }
+            else {
+                // The Transformer hasn't been materialized, so its serialized state is still current
+                size_t const                cbTransformer(GetSerializedSize(id));
+
+                if(cbTransformer != 0) {
+                    unsigned char const * const             pTransformerData(GetSerializedData(id));
+
+                    data.insert(data.end(), pTransformerData, pTransformerData + cbTransformer);
+                }
+            }
         }
+
+        Traits<std::uint64_t>::serialize(ar, ids.size());
+
+        for(size_t index = 0; index < ids.size(); ++index) {
+            Traits<GrainT>::serialize(ar, _grains[ids[index]]);
+            Traits<std::uint64_t>::serialize(ar, offsets[index]);
+        }
+
+        Traits<std::uint64_t>::serialize(ar, data.size());
+
+        if(data.empty() == false)
+            ar.serialize(data.data(), data.size());
     }
-    else
+    else {
+        Traits<std::uint64_t>::serialize(ar, 0);
         Traits<std::uint64_t>::serialize(ar, 0);
+    }
 
     // If there is a _createFunc, create a Transformer based on that func and then
     // serialize it. This will serve as a template for the function created when
@@ -629,27 +933,246 @@ void GrainTransformer<GrainT, EstimatorT>::save(Archive &ar) const /*override*/
         _createFunc()->save(ar);
 }
 
+template <typename GrainT, typename EstimatorT>
+typename GrainTransformer<GrainT, EstimatorT>::GrainIdType GrainTransformer<GrainT, EstimatorT>::get_grain_id(GrainT const &grain) {
+    GrainIdType const                       id(_grains.find(grain));
+
+    if(id != GrainIndexType::InvalidId)
+        return id;
+
+    if(!_createFunc)
+        throw std::runtime_error("Grain not found");
+
+    _transformers.emplace_back(_createFunc());
+
+    try {
+        std::pair<GrainIdType, bool> const  result(_grains.insert(grain));
+
+        assert(result.second && result.first == _transformers.size() - 1);
+        return result.first;
+    }
+    catch(...) {
+        _transformers.pop_back();
+        throw;
+    }
+}
+
+template <typename GrainT, typename EstimatorT>
+void GrainTransformer<GrainT, EstimatorT>::execute(GrainIdType const *pGrainIds, typename EstimatorT::InputType const *pItems, size_t cItems, typename BaseType::CallbackFunction const &callback) {
+    if(pGrainIds == nullptr)
+        throw std::invalid_argument("pGrainIds");
+    if(pItems == nullptr)
+        throw std::invalid_argument("pItems");
+    if(cItems == 0)
+        throw std::invalid_argument("cItems");
+    if(!callback)
+        throw std::invalid_argument("callback");
+
+    // Create the callback once rather than once per item
+    GrainT const *                          pGrain(nullptr);
+    typename GrainTransformerType::CallbackFunction const               grainCallback(
+        [&callback, &pGrain](typename EstimatorT::TransformedType output) {
+            assert(pGrain);
+            callback(typename TheseGrainFeaturizerTraits::TransformedType(*pGrain, std::move(output)));
+        }
+    );
+
+    GrainIdType const * const               pEndGrainIds(pGrainIds + cItems);
+
+    while(pGrainIds != pEndGrainIds) {
+        GrainIdType const                   id(*pGrainIds);
+
+        if(id >= _transformers.size())
+            throw std::invalid_argument("Invalid grain id");
+
+        pGrain = &_grains[id];
+        GetTransformer(id).execute(*pItems, grainCallback);
+
+        ++pGrainIds;
+        ++pItems;
+    }
+}
+
+template <typename GrainT, typename EstimatorT>
+void GrainTransformer<GrainT, EstimatorT>::execute_parallel(
+    ThreadPool &pool,
+    typename BaseType::InputType const *pItems,
+    size_t cItems,
+    typename BaseType::CallbackFunction const &callback,
+    GrainOutputOrder order/*=GrainOutputOrder::Input*/
+) {
+    // ----------------------------------------------------------------------
+    using GrainRow                          = std::pair<GrainIdType, size_t>;
+    using GrainRows                         = std::vector<GrainRow>;
+    using RowOutput                         = std::pair<size_t, typename EstimatorT::TransformedType>;
+    using RowOutputs                        = std::vector<RowOutput>;
+
+    struct Group {
+        GrainIdType                         Id;
+        GrainTransformerType *              pTransformer;
+        size_t                              BeginRow;
+        size_t                              EndRow;
+        RowOutputs                          Outputs;
+    };
+
+    using Groups                            = std::vector<Group>;
+    // ----------------------------------------------------------------------
+
+    if(pItems == nullptr)
+        throw std::invalid_argument("pItems");
+    if(cItems == 0)
+        throw std::invalid_argument("cItems");
+    if(!callback)
+        throw std::invalid_argument("callback");
+
+    // Resolve the grains (creating Transformers as necessary) on this thread
+    GrainRows                               rows;
+
+    rows.reserve(cItems);
+
+    for(size_t row = 0; row < cItems; ++row)
+        rows.emplace_back(get_grain_id(std::get<0>(pItems[row])), row);
+
+    // Group the rows by grain; rows for a grain remain in their original order
+    std::sort(rows.begin(), rows.end());
+
+    Groups                                  groups;
+
+    for(size_t index = 0; index < rows.size(); ++index) {
+        if(index != 0 && rows[index].first == rows[index - 1].first)
+            continue;
+
+        if(groups.empty() == false)
+            groups.back().EndRow = index;
+
+        // Transformers aren't evicted until all of the groups have been processed
+        GrainTransformerType &              transformer(GetTransformer(rows[index].first, false));
+
+        groups.emplace_back(Group{ rows[index].first, &transformer, index, 0, RowOutputs() });
+    }
+
+    groups.back().EndRow = rows.size();
+
+    pool.run(
+        groups.size(),
+        [pItems, &rows, &groups](size_t, size_t groupIndex) {
+            Group &                         group(groups[groupIndex]);
+            size_t                          row(0);
+            typename GrainTransformerType::CallbackFunction const           groupCallback(
+                [&group, &row](typename EstimatorT::TransformedType output) {
+                    group.Outputs.emplace_back(row, std::move(output));
+                }
+            );
+
+            for(size_t index = group.BeginRow; index < group.EndRow; ++index) {
+                row = rows[index].second;
+                group.pTransformer->execute(std::get<1>(pItems[row]), groupCallback);
+            }
+        }
+    );
+
+    if(_maxMaterializedBytes != std::numeric_limits<size_t>::max())
+        EvictTransformers(GrainIndexType::InvalidId);
+
+    if(order == GrainOutputOrder::Grain) {
+        std::sort(
+            groups.begin(),
+            groups.end(),
+            [this](Group const &a, Group const &b) {
+                return _grains[a.Id] < _grains[b.Id];
+            }
+        );
+
+        for(Group &group : groups) {
+            GrainT const &                  grain(_grains[group.Id]);
+
+            for(RowOutput &output : group.Outputs)
+                callback(typename TheseGrainFeaturizerTraits::TransformedType(grain, std::move(output.second)));
+        }
+
+        return;
+    }
+
+    // Stitch the output back together in input order; a Transformer may produce
+    // any number of outputs for an input item, and those outputs remain in the
+    // order in which they were produced.
+    std::vector<size_t>                     rowStarts(cItems + 1, 0);
+
+    for(Group const &group : groups) {
+        for(RowOutput const &output : group.Outputs)
+            ++rowStarts[output.first + 1];
+    }
+
+    for(size_t row = 0; row < cItems; ++row)
+        rowStarts[row + 1] += rowStarts[row];
+
+    std::vector<std::pair<Group *, RowOutput *>>                    sortedOutputs(rowStarts.back());
+
+    for(Group &group : groups) {
+        for(RowOutput &output : group.Outputs)
+            sortedOutputs[rowStarts[output.first]++] = std::make_pair(&group, &output);
+    }
+
+    for(auto const &sortedOutput : sortedOutputs)
+        callback(typename TheseGrainFeaturizerTraits::TransformedType(_grains[sortedOutput.first->Id], std::move(sortedOutput.second->second)));
+}
+
+template <typename GrainT, typename EstimatorT>
+void GrainTransformer<GrainT, EstimatorT>::set_max_materialized_bytes(size_t maxBytes) {
+    _maxMaterializedBytes = maxBytes;
+    _cMaterializedBytes = 0;
+    _lruIds.clear();
+    _lruPositions.assign(GetNumSerializedTransformers(), _lruIds.end());
+
+    if(_maxMaterializedBytes == std::numeric_limits<size_t>::max())
+        return;
+
+    for(GrainIdType id = 0; id < _lruPositions.size(); ++id) {
+        if(_transformers[id]) {
+            _lruPositions[id] = _lruIds.insert(_lruIds.end(), id);
+            _cMaterializedBytes += GetSerializedSize(id);
+        }
+    }
+
+    EvictTransformers(GrainIndexType::InvalidId);
+}
+
+template <typename GrainT, typename EstimatorT>
+size_t GrainTransformer<GrainT, EstimatorT>::num_materialized_transformers(void) const {
+    return static_cast<size_t>(
+        std::count_if(
+            _transformers.begin(),
+            _transformers.end(),
+            [](GrainTransformerTypeUniquePtr const &pTransformer) {
+                return static_cast<bool>(pTransformer);
+            }
+        )
+    );
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 template <typename GrainT, typename EstimatorT>
-GrainTransformer<GrainT, EstimatorT>::GrainTransformer(TransformerMap transformers, Archive createFuncArchive, UseDeserializationCtorTag) :
-    _hadTransformersWhenCreated(transformers.empty()),
-    _createFuncArchive(
-        std::move(
-            [&createFuncArchive](void) -> Archive & {
-                if(createFuncArchive.Mode != Archive::ModeValue::Deserializing)
-                    throw std::invalid_argument("Invalid serialization mode");
-
-                return createFuncArchive;
-            }()
-        )
-    ),
+GrainTransformer<GrainT, EstimatorT>::GrainTransformer(GrainIndexType grains, TransformerVector transformers, SerializedTransformers serialized, Archive createFuncArchive, UseDeserializationCtorTag) :
+    _hadTransformersWhenCreated(grains.empty() == false),
+    // A `createFuncArchive` in serialization mode indicates that there isn't a createFunc
+    _createFuncArchive(std::move(createFuncArchive)),
     _createFunc(
-        [this](void) { return CreateTransformerFromArchive(); }
+        [this](void) -> CreateTransformerFunc {
+            if(_createFuncArchive.Mode == Archive::ModeValue::Serializing)
+                return CreateTransformerFunc();
+
+            return [this](void) { return CreateTransformerFromArchive(); };
+        }()
     ),
-    _transformers(std::move(transformers))
-{}
+    _grains(std::move(grains)),
+    _transformers(std::move(transformers)),
+    _serialized(std::move(serialized)),
+    _maxMaterializedBytes(std::numeric_limits<size_t>::max()),
+    _cMaterializedBytes(0) {
+    assert(_transformers.size() == _grains.size());
+}
 
 template <typename GrainT, typename EstimatorT>
 typename GrainTransformer<GrainT, EstimatorT>::GrainTransformerTypeUniquePtr
@@ -662,6 +1185,71 @@ GrainTransformer<GrainT, EstimatorT>::CreateTransformerFromArchive(void) const {
     return GrainTransformerTypeUniquePtr(new typename EstimatorT::TransformerType(ar));
 }
 
+template <typename GrainT, typename EstimatorT>
+size_t GrainTransformer<GrainT, EstimatorT>::GetNumSerializedTransformers(void) const {
+    return _serialized.Offsets.empty() ? 0 : _serialized.Offsets.size() - 1;
+}
+
+template <typename GrainT, typename EstimatorT>
+size_t GrainTransformer<GrainT, EstimatorT>::GetSerializedSize(GrainIdType id) const {
+    assert(id < GetNumSerializedTransformers());
+    return static_cast<size_t>(_serialized.Offsets[id + 1] - _serialized.Offsets[id]);
+}
+
+template <typename GrainT, typename EstimatorT>
+unsigned char const * GrainTransformer<GrainT, EstimatorT>::GetSerializedData(GrainIdType id) const {
+    assert(GetSerializedSize(id) != 0);
+    return _serialized.Data.get_buffer_ptr() + _serialized.Offsets[id];
+}
+
+template <typename GrainT, typename EstimatorT>
+typename GrainTransformer<GrainT, EstimatorT>::GrainTransformerType &
+GrainTransformer<GrainT, EstimatorT>::GetTransformer(GrainIdType id, bool evict/*=true*/) {
+    assert(id < _transformers.size());
+
+    GrainTransformerTypeUniquePtr &         pTransformer(_transformers[id]);
+    bool const                              isEvictionEnabled(_maxMaterializedBytes != std::numeric_limits<size_t>::max());
+
+    if(pTransformer) {
+        // Mark the Transformer as recently used (Transformers created by `createFunc`
+        // aren't tracked, as they can't be evicted)
+        if(isEvictionEnabled && id < _lruPositions.size() && _lruPositions[id] != _lruIds.end())
+            _lruIds.splice(_lruIds.begin(), _lruIds, _lruPositions[id]);
+
+        return *pTransformer;
+    }
+
+    size_t const                            cbTransformer(GetSerializedSize(id));
+    Archive                                 ar(
+        cbTransformer ? GetSerializedData(id) : nullptr,
+        cbTransformer
+    );
+
+    pTransformer.reset(new typename EstimatorT::TransformerType(ar));
+
+    if(isEvictionEnabled) {
+        _lruPositions[id] = _lruIds.insert(_lruIds.begin(), id);
+        _cMaterializedBytes += cbTransformer;
+
+        if(evict)
+            EvictTransformers(id);
+    }
+
+    return *pTransformer;
+}
+
+template <typename GrainT, typename EstimatorT>
+void GrainTransformer<GrainT, EstimatorT>::EvictTransformers(GrainIdType keepId) {
+    while(_cMaterializedBytes > _maxMaterializedBytes && _lruIds.empty() == false && _lruIds.back() != keepId) {
+        GrainIdType const                   id(_lruIds.back());
+
+        _lruIds.pop_back();
+        _lruPositions[id] = _lruIds.end();
+        _cMaterializedBytes -= GetSerializedSize(id);
+        _transformers[id].reset();
+    }
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  Impl::GrainEstimatorImplBase
@@ -718,6 +1306,19 @@ Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::g
     return BaseT::template get_annotation_impl<GrainEstimatorAnnotation>(columnAnnotations, colIndex, name);
 }
 
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::set_num_training_threads(size_t numThreads) {
+    if(BaseT::get_state() != TrainingState::Pending)
+        throw std::runtime_error("The number of training threads must be set before training begins");
+
+    if(numThreads == 1) {
+        _pThreadPool.reset();
+        return;
+    }
+
+    _pThreadPool.reset(new ThreadPool(numThreads));
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -729,37 +1330,16 @@ bool Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItems
 template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
 FitResult Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::fit_impl(InputType const *pItems, size_t cItems) /*override*/ {
     size_t const                            cRemainingItems(std::min(_cRemainingTrainingItems, cItems));
-    InputType const * const                 pEndItems(pItems + cRemainingItems);
-
-    while(pItems != pEndItems) {
-        EstimatorT &                        estimator(
-            [this, pItems](void) -> EstimatorT & {
-                GrainT const &                          grain(std::get<0>(*pItems));
-                typename EstimatorMap::iterator const   iter(_estimators.find(grain));
-
-                if(iter != _estimators.end())
-                    return iter->second;
-
-                std::pair<typename EstimatorMap::iterator, bool> const      result(_estimators.emplace(std::make_pair(grain, _createFunc(_pAllColumnAnnotations))));
-
-                result.first->second.begin_training();
 
-                return result.first->second;
-            }()
-        );
-
-        if(estimator.get_state() == TrainingState::Training) {
-            typename EstimatorT::InputType const &      input(std::get<1>(*pItems));
-            FitResult const                             result(estimator.fit(input));
+    if(_pThreadPool)
+        FitParallel(pItems, cRemainingItems);
+    else {
+        InputType const * const             pEndItems(pItems + cRemainingItems);
 
-            // Don't allow resetting, as we don't have a good way to reset all of the estimators associated with
-            // each of the unique grains.
-
-            if(result == FitResult::Reset)
-                throw std::runtime_error("Resetting estimators can not be used as GrainEstimators");
+        while(pItems != pEndItems) {
+            FitGrainEstimator(_estimators[GetEstimatorId(std::get<0>(*pItems))], std::get<1>(*pItems));
+            ++pItems;
         }
-
-        ++pItems;
     }
 
     _cRemainingTrainingItems -= cRemainingItems;
@@ -768,11 +1348,6 @@ FitResult Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTraining
 
 template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
 void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::complete_training_impl(void) /*override*/ {
-    // ----------------------------------------------------------------------
-    using GrainEstimatorAnnotationMap       = typename GrainEstimatorAnnotation::AnnotationMap;
-    using Sizes                             = std::vector<size_t>;
-    // ----------------------------------------------------------------------
-
     // This code is admittedly strange. We don't know if the per-grain `Estimator` creates `Annotations`.
     // We are making the assumption that `Annotations` will only be created when `complete_training` is called
     // (I believe that that is a reasonable assumption).
@@ -789,71 +1364,206 @@ void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItems
     // TODO: All of this code needs to change when we switch from using `AnnotationMaps` in favor of graph
     //       contexts.
 
-    Sizes const                             sizes(
-        [this](void) {
-            Sizes                           result;
+    GrainEstimatorAnnotationMap             newAnnotations;
+    size_t                                  colIndex(0);
+    typename GrainIndexType::IdVector const ids(_grains.sorted_ids());
 
-            result.reserve(_pAllColumnAnnotations->size());
+    if(_pThreadPool) {
+        // Each per-grain `Estimator` has its own `AnnotationMaps`, so the `Estimators` can be
+        // completed concurrently and their `Annotations` collected afterwards (in grain order).
+        std::vector<Sizes>                  grainSizes;
 
-            for(AnnotationMap const &map: *_pAllColumnAnnotations)
-                result.emplace_back(map.size());
+        grainSizes.reserve(_grainColumnAnnotations.size());
 
-            return result;
-        }()
+        for(AnnotationMapsPtr const &pColumnAnnotations : _grainColumnAnnotations)
+            grainSizes.emplace_back(GetSizes(*pColumnAnnotations));
+
+        _pThreadPool->run(
+            ids.size(),
+            [this, &ids](size_t, size_t taskIndex) {
+                _estimators[ids[taskIndex]].complete_training();
+            }
+        );
+
+        for(GrainIdType id : ids)
+            ExtractGrainAnnotation(_grains[id], _estimators[id], *_grainColumnAnnotations[id], grainSizes[id], newAnnotations, colIndex);
+
+        // The threads aren't needed once training has completed
+        _pThreadPool.reset();
+    }
+    else {
+        Sizes const                         sizes(GetSizes(*_pAllColumnAnnotations));
+
+        for(GrainIdType id : ids) {
+            EstimatorT &                    estimator(_estimators[id]);
+
+            estimator.complete_training();
+            ExtractGrainAnnotation(_grains[id], estimator, *_pAllColumnAnnotations, sizes, newAnnotations, colIndex);
+        }
+    }
+
+    if(newAnnotations.empty() == false)
+        BaseT::add_annotation(std::make_shared<GrainEstimatorAnnotation>(std::move(newAnnotations)), std::move(colIndex));
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+typename Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::GrainIdType
+Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::GetEstimatorId(GrainT const &grain) {
+    GrainIdType const                       id(_grains.find(grain));
+
+    if(id != GrainIndexType::InvalidId)
+        return id;
+
+    // With multi-threaded training, each per-grain Estimator gets its own copy of the
+    // AnnotationMaps so that Estimators can add Annotations concurrently.
+    AnnotationMapsPtr                       pColumnAnnotations(
+        _pThreadPool ? std::make_shared<AnnotationMaps>(*_pAllColumnAnnotations) : _pAllColumnAnnotations
     );
 
-    GrainEstimatorAnnotationMap             newAnnotations;
-    size_t                                  colIndex(0);
+    _estimators.emplace_back(_createFunc(pColumnAnnotations));
 
-    for(auto & kvp : _estimators) {
-        kvp.second.complete_training();
+    try {
+        if(_pThreadPool)
+            _grainColumnAnnotations.emplace_back(std::move(pColumnAnnotations));
 
-        bool                                addedNewAnnotation(false);
+        _grains.insert(grain);
+    }
+    catch(...) {
+        if(_grainColumnAnnotations.size() > _grains.size())
+            _grainColumnAnnotations.pop_back();
 
-        for(size_t i = 0; i < _pAllColumnAnnotations->size(); ++i) {
-            assert(_pAllColumnAnnotations->size() == sizes.size());
-            assert(i < _pAllColumnAnnotations->size());
+        _estimators.pop_back();
+        throw;
+    }
 
-            AnnotationMap &                 map((*_pAllColumnAnnotations)[i]);
-            size_t const &                  size(sizes[i]);
+    _estimators.back().begin_training();
 
-            if(map.size() != size) {
-                assert(map.size() == size + 1);
+    return static_cast<GrainIdType>(_estimators.size() - 1);
+}
 
-                if(addedNewAnnotation)
-                    throw std::runtime_error("Unexpected AnnotationMap insertion (duplicate)");
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::FitParallel(InputType const *pItems, size_t cItems) {
+    // ----------------------------------------------------------------------
+    using GrainRow                          = std::pair<GrainIdType, size_t>;
+    using GrainRows                         = std::vector<GrainRow>;
+    // ----------------------------------------------------------------------
 
-                if(newAnnotations.empty() == false && colIndex != i)
-                    throw std::runtime_error("Unexpected AnnotationMap insertion (different column)");
+    // Estimators are created on this thread so that grain ids (and everything
+    // that depends on them) are assigned in the same order as single-threaded
+    // training.
+    GrainRows                               rows;
 
-                colIndex = i;
+    rows.reserve(cItems);
 
-                // If here, something was added. We expect that Annotation to be associated with the grain-based Estimator.
-                AnnotationMap::iterator     iter(map.find(kvp.second.Name));
+    for(size_t row = 0; row < cItems; ++row)
+        rows.emplace_back(GetEstimatorId(std::get<0>(pItems[row])), row);
 
-                if(iter == map.end())
-                    throw std::runtime_error("Unexpected AnnotationMap insertion (different Estimator)");
+    // Group the rows by grain; rows for a grain remain in their original order
+    std::sort(rows.begin(), rows.end());
 
-                // There should be only one entry
-                if(iter->second.size() != 1)
-                    throw std::runtime_error("Unexpected AnnotationMap size");
+    std::vector<size_t>                     groupStarts;
 
-                // Insert this value into our working map
-                std::pair<typename GrainEstimatorAnnotationMap::iterator, bool> const   result(newAnnotations.emplace(std::make_pair(kvp.first, std::move(iter->second[0]))));
+    for(size_t index = 0; index < rows.size(); ++index) {
+        if(index == 0 || rows[index].first != rows[index - 1].first)
+            groupStarts.emplace_back(index);
+    }
 
-                if(result.first == newAnnotations.end() || result.second == false)
-                    throw std::runtime_error("Invalid AnnotationMap insertion");
+    groupStarts.emplace_back(rows.size());
 
-                addedNewAnnotation = true;
+    _pThreadPool->run(
+        groupStarts.size() - 1,
+        [this, pItems, &rows, &groupStarts](size_t, size_t groupIndex) {
+            size_t const                    begin(groupStarts[groupIndex]);
+            size_t const                    end(groupStarts[groupIndex + 1]);
+            EstimatorT &                    estimator(_estimators[rows[begin].first]);
 
-                // Remove the value from the global map (which should restore the original sizes)
-                map.erase(iter);
-            }
+            for(size_t index = begin; index < end; ++index)
+                FitGrainEstimator(estimator, std::get<1>(pItems[rows[index].second]));
         }
-    }
+    );
+}
 
-    if(newAnnotations.empty() == false)
-        BaseT::add_annotation(std::make_shared<GrainEstimatorAnnotation>(std::move(newAnnotations)), std::move(colIndex));
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+/*static*/ void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::FitGrainEstimator(EstimatorT &estimator, typename EstimatorT::InputType const &input) {
+    if(estimator.get_state() != TrainingState::Training)
+        return;
+
+    FitResult const                         result(estimator.fit(input));
+
+    // Don't allow resetting, as we don't have a good way to reset all of the estimators associated with
+    // each of the unique grains.
+
+    if(result == FitResult::Reset)
+        throw std::runtime_error("Resetting estimators can not be used as GrainEstimators");
+}
+
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+/*static*/ typename Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::Sizes
+Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::GetSizes(AnnotationMaps const &columnAnnotations) {
+    Sizes                                   result;
+
+    result.reserve(columnAnnotations.size());
+
+    for(AnnotationMap const &map: columnAnnotations)
+        result.emplace_back(map.size());
+
+    return result;
+}
+
+template <typename BaseT, typename GrainT, typename EstimatorT, size_t MaxNumTrainingItemsV>
+/*static*/ void Impl::GrainEstimatorImplBase<BaseT, GrainT, EstimatorT, MaxNumTrainingItemsV>::ExtractGrainAnnotation(
+    GrainT const &grain,
+    EstimatorT const &estimator,
+    AnnotationMaps &columnAnnotations,
+    Sizes const &sizes,
+    GrainEstimatorAnnotationMap &newAnnotations,
+    size_t &colIndex
+) {
+    bool                                    addedNewAnnotation(false);
+
+    for(size_t i = 0; i < columnAnnotations.size(); ++i) {
+        assert(columnAnnotations.size() == sizes.size());
+        assert(i < columnAnnotations.size());
+
+        AnnotationMap &                     map(columnAnnotations[i]);
+        size_t const &                      size(sizes[i]);
+
+        if(map.size() != size) {
+            assert(map.size() == size + 1);
+
+            if(addedNewAnnotation)
+                throw std::runtime_error("Unexpected AnnotationMap insertion (duplicate)");
+
+            if(newAnnotations.empty() == false && colIndex != i)
+                throw std::runtime_error("Unexpected AnnotationMap insertion (different column)");
+
+            colIndex = i;
+
+            // If here, something was added. We expect that Annotation to be associated with the grain-based Estimator.
+            AnnotationMap::iterator         iter(map.find(estimator.Name));
+
+            if(iter == map.end())
+                throw std::runtime_error("Unexpected AnnotationMap insertion (different Estimator)");
+
+            // There should be only one entry
+            if(iter->second.size() != 1)
+                throw std::runtime_error("Unexpected AnnotationMap size");
+
+            // Insert this value into our working map
+            std::pair<typename GrainEstimatorAnnotationMap::iterator, bool> const   result(newAnnotations.emplace(std::make_pair(grain, std::move(iter->second[0]))));
+
+            if(result.first == newAnnotations.end() || result.second == false)
+                throw std::runtime_error("Invalid AnnotationMap insertion");
+
+            addedNewAnnotation = true;
+
+            // Remove the value from the map (which should restore the original sizes)
+            map.erase(iter);
+        }
+    }
 }
 
 } // namespace Components
@@ -0,0 +1,268 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "../../Traits.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         GrainHash
+///  \brief         Hash function used for grains; containers (the most
+///                 common grain type is `std::vector<std::string>`) are
+///                 hashed with `ContainerHash`.
+///
+template <typename GrainT>
+struct GrainHash : public std::hash<GrainT> {};
+
+template <typename T, typename AllocatorT>
+struct GrainHash<std::vector<T, AllocatorT>> : public ContainerHash<std::vector<T, AllocatorT>> {};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         GrainIndex
+///  \brief         Interns grains, assigning a dense id to each unique grain
+///                 in the order in which it was first encountered. Per-grain
+///                 state can then be stored in a vector indexed by id rather
+///                 than in a map keyed by grain.
+///
+///                 Grains are stored in an open-addressing hash table along
+///                 with their hash values, so the hash of a grain is calculated
+///                 once per lookup and grains are only compared when their
+///                 hash values match. References to grains remain valid as
+///                 new grains are added.
+///
+template <typename GrainT, typename HashT=GrainHash<GrainT>>
+class GrainIndex {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using GrainType                         = GrainT;
+    using IdType                            = std::uint32_t;
+    using IdVector                          = std::vector<IdType>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr IdType                 InvalidId = std::numeric_limits<IdType>::max();
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    GrainIndex(void);
+    ~GrainIndex(void) = default;
+
+    GrainIndex(GrainIndex const &) = default;
+    GrainIndex(GrainIndex &&) = default;
+
+    GrainIndex & operator =(GrainIndex const &) = delete;
+    GrainIndex & operator =(GrainIndex &&) = delete;
+
+    size_t size(void) const;
+    bool empty(void) const;
+
+    /// Returns the grain associated with the id.
+    GrainT const & operator[](IdType id) const;
+
+    /// Returns the id associated with the grain or `InvalidId` if the grain
+    /// hasn't been encountered.
+    IdType find(GrainT const &grain) const;
+
+    /// Returns the id associated with the grain and a bool that indicates if the
+    /// grain was added.
+    std::pair<IdType, bool> insert(GrainT const &grain);
+
+    /// Returns the ids sorted by grain.
+    IdVector sorted_ids(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+
+    // Grains and their hash values, indexed by id; a deque is used so that
+    // references to grains are stable.
+    std::deque<GrainT>                      _grains;
+    std::vector<size_t>                     _hashes;
+
+    // Open-addressing table (with linear probing) whose size is always a power
+    // of 2; each slot contains (id + 1) or 0 if the slot is empty.
+    IdVector                                _slots;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    static size_t CalculateHash(GrainT const &grain);
+
+    /// Returns the id of the grain (or `InvalidId`) and updates `slot` with the
+    /// slot where the grain is (or should be) located.
+    IdType FindImpl(GrainT const &grain, size_t hash, size_t &slot) const;
+
+    void Grow(void);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename GrainT, typename HashT>
+GrainIndex<GrainT, HashT>::GrainIndex(void) :
+    _slots(16, 0) {
+}
+
+template <typename GrainT, typename HashT>
+size_t GrainIndex<GrainT, HashT>::size(void) const {
+    return _grains.size();
+}
+
+template <typename GrainT, typename HashT>
+bool GrainIndex<GrainT, HashT>::empty(void) const {
+    return _grains.empty();
+}
+
+template <typename GrainT, typename HashT>
+GrainT const & GrainIndex<GrainT, HashT>::operator[](IdType id) const {
+    assert(id < _grains.size());
+    return _grains[id];
+}
+
+template <typename GrainT, typename HashT>
+typename GrainIndex<GrainT, HashT>::IdType GrainIndex<GrainT, HashT>::find(GrainT const &grain) const {
+    size_t                                  slot;
+
+    return FindImpl(grain, CalculateHash(grain), slot);
+}
+
+template <typename GrainT, typename HashT>
+std::pair<typename GrainIndex<GrainT, HashT>::IdType, bool> GrainIndex<GrainT, HashT>::insert(GrainT const &grain) {
+    size_t const                            hash(CalculateHash(grain));
+    size_t                                  slot;
+    IdType const                            id(FindImpl(grain, hash, slot));
+
+    if(id != InvalidId)
+        return std::make_pair(id, false);
+
+    if(_grains.size() >= InvalidId - 1)
+        throw std::runtime_error("Too many grains");
+
+    IdType const                            newId(static_cast<IdType>(_grains.size()));
+
+    _grains.emplace_back(grain);
+    _hashes.emplace_back(hash);
+    _slots[slot] = newId + 1;
+
+    // Keep the load factor at or below 0.5
+    if(_grains.size() * 2 > _slots.size())
+        Grow();
+
+    return std::make_pair(newId, true);
+}
+
+template <typename GrainT, typename HashT>
+typename GrainIndex<GrainT, HashT>::IdVector GrainIndex<GrainT, HashT>::sorted_ids(void) const {
+    IdVector                                result;
+
+    result.reserve(_grains.size());
+
+    for(IdType id = 0; id < _grains.size(); ++id)
+        result.emplace_back(id);
+
+    std::sort(
+        result.begin(),
+        result.end(),
+        [this](IdType a, IdType b) {
+            return _grains[a] < _grains[b];
+        }
+    );
+
+    return result;
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename GrainT, typename HashT>
+/*static*/ size_t GrainIndex<GrainT, HashT>::CalculateHash(GrainT const &grain) {
+    // Some hash functions (for example, std::hash for integers) return the value
+    // itself; mix the bits so that the low bits used to select a slot are well
+    // distributed.
+    std::uint64_t                           value(static_cast<std::uint64_t>(HashT()(grain)));
+
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+
+    return static_cast<size_t>(value);
+}
+
+template <typename GrainT, typename HashT>
+typename GrainIndex<GrainT, HashT>::IdType GrainIndex<GrainT, HashT>::FindImpl(GrainT const &grain, size_t hash, size_t &slot) const {
+    size_t const                            mask(_slots.size() - 1);
+
+    slot = hash & mask;
+
+    while(true) {
+        IdType const                        value(_slots[slot]);
+
+        if(value == 0)
+            return InvalidId;
+
+        IdType const                        id(value - 1);
+
+        if(_hashes[id] == hash && _grains[id] == grain)
+            return id;
+
+        slot = (slot + 1) & mask;
+    }
+}
+
+template <typename GrainT, typename HashT>
+void GrainIndex<GrainT, HashT>::Grow(void) {
+    IdVector                                slots(_slots.size() * 2, 0);
+    size_t const                            mask(slots.size() - 1);
+
+    for(IdType id = 0; id < _grains.size(); ++id) {
+        size_t                              slot(_hashes[id] & mask);
+
+        while(slots[slot] != 0)
+            slot = (slot + 1) & mask;
+
+        slots[slot] = id + 1;
+    }
+
+    _slots = std::move(slots);
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
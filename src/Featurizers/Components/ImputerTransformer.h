@@ -66,6 +66,9 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(InputType const *pInput, size_t cInput, TransformedType *pOutput) override;
+
+    TransformedType transform(InputType const &input) const;
 };
 
 // ----------------------------------------------------------------------
@@ -133,14 +136,25 @@ void ImputerTransformer<InputT, TransformedT>::save(Archive &ar) const /*overrid
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
 void ImputerTransformer<InputT, TransformedT>::execute_impl(InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+    callback(transform(input));
+}
+
+template <typename InputT, typename TransformedT>
+void ImputerTransformer<InputT, TransformedT>::execute_batch_impl(InputType const *pInput, size_t cInput, TransformedType *pOutput) /*override*/ {
+    for(size_t index = 0; index < cInput; ++index)
+        pOutput[index] = transform(pInput[index]);
+}
+
+template <typename InputT, typename TransformedT>
+typename ImputerTransformer<InputT, TransformedT>::TransformedType ImputerTransformer<InputT, TransformedT>::transform(InputType const &input) const {
     // ----------------------------------------------------------------------
     using TheseTraits                       = Traits<InputType>;
     // ----------------------------------------------------------------------
 
     if(TheseTraits::IsNull(input))
-        callback(Value);
-    else
-        callback(static_cast<TransformedT>(TheseTraits::GetNullableValue(input)));
+        return Value;
+
+    return static_cast<TransformedT>(TheseTraits::GetNullableValue(input));
 }
 
 } // namespace Components
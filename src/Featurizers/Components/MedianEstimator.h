@@ -4,8 +4,10 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <memory>
 #include <queue>
 
+#include "QuantileSketch.h"
 #include "TrainingOnlyEstimatorImpl.h"
 
 namespace Microsoft {
@@ -47,6 +49,13 @@ namespace Details {
 ///  \class         MedianTrainingOnlyPolicy
 ///  \brief         `MedianEstimator` implementation details.
 ///
+///                 By default, every training value is kept in memory so that
+///                 the exact median can be calculated. When a `rankError` is
+///                 provided, values are added to a `QuantileSketch` instead,
+///                 which uses a bounded amount of memory and produces a value
+///                 whose rank is within `rankError` (as a fraction of the number
+///                 of values) of the median's rank.
+///
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
 class MedianTrainingOnlyPolicy {
 public:
@@ -71,6 +80,8 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
+    MedianTrainingOnlyPolicy(float rankError=Traits<std::float_t>::CreateNullValue());
+
     void fit(InputType const &input);
     MedianAnnotationData<TransformedT> complete_training(void);
 
@@ -87,6 +98,9 @@ private:
     using MaxHeapType                       = std::priority_queue<TransformedT>;
     using MinHeapType                       = std::priority_queue<TransformedT, std::vector<TransformedT>, std::greater<TransformedT>>;
 
+    using SketchType                        = QuantileSketch<TransformedT>;
+    using SketchUniquePtr                   = std::unique_ptr<SketchType>;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
@@ -95,6 +109,9 @@ private:
     MaxHeapType                             _smaller;
     MinHeapType                             _larger;
 
+    // Only used when a rank error was provided
+    SketchUniquePtr                         _pSketch;
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
@@ -108,6 +125,11 @@ private:
 
     TransformedT _get_interpolated_value(std::true_type /*supports Interpolated values*/);
     TransformedT _get_interpolated_value(std::false_type /*supports Interpolated values*/);
+
+    MedianAnnotationData<TransformedT> complete_training_sketch(void);
+
+    TransformedT _get_interpolated_sketch_value(std::true_type /*supports Interpolated values*/);
+    TransformedT _get_interpolated_sketch_value(std::false_type /*supports Interpolated values*/);
 };
 
 } // namespace Details
@@ -117,6 +139,11 @@ private:
 ///  \brief         An `Estimator` that computes the median value encountered
 ///                 during training.
 ///
+///                 The approximate (bounded memory) median is calculated when a
+///                 rank error is provided as the estimator policy argument:
+///
+///                     MedianEstimator<float>(pAllColumnAnnotations, colIndex, true, 0.01f);
+///
 template <
     typename InputT,
     typename TransformedT=InputT,
@@ -150,6 +177,21 @@ MedianAnnotationData<T>::MedianAnnotationData(T median) :
 // |  Details::MedianTrainingOnlyPolicy
 // |
 // ----------------------------------------------------------------------
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::MedianTrainingOnlyPolicy(float rankError) :
+    _pSketch(
+        [&rankError](void) {
+            if(Traits<std::float_t>::IsNull(rankError))
+                return SketchUniquePtr();
+
+            if(rankError <= 0.0f || rankError >= 1.0f)
+                throw std::invalid_argument("rankError");
+
+            return SketchUniquePtr(new SketchType(SketchType::CalculateK(static_cast<double>(rankError))));
+        }()
+    ) {
+}
+
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
 void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::fit(InputType const &input) {
     fit_impl(input, std::integral_constant<bool, Traits<InputT>::IsNullableType>());
@@ -157,6 +199,9 @@ void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>
 
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
 MedianAnnotationData<TransformedT> Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::complete_training(void) {
+    if(_pSketch)
+        return complete_training_sketch();
+
     size_t const                            numElements(_smaller.size() + _larger.size());
 
     if(numElements == 0)
@@ -208,6 +253,11 @@ void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>
 template <typename InputT, typename TransformedT, bool InterpolateValuesV>
 template <typename U>
 void Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::fit_impl(U const &input) {
+    if(_pSketch) {
+        _pSketch->update(static_cast<TransformedT>(input));
+        return;
+    }
+
     if(_smaller.empty() || static_cast<TransformedT>(input) <= _smaller.top()) {
 #if (defined __apple_build_version__ || defined __GNUC__ && (__GNUC__ < 4 || (__GNUC__ == 4 && __GNUC_MINOR__ <= 8)))
         _smaller.push(static_cast<TransformedT>(input));
@@ -265,6 +315,62 @@ TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, Interpolate
     throw std::runtime_error("This should never be called");
 }
 
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+MedianAnnotationData<TransformedT> Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::complete_training_sketch(void) {
+    std::uint64_t const                     numElements(_pSketch->size());
+
+    if(numElements == 0)
+        throw std::runtime_error("No elements were provided during training");
+
+    TransformedT                            median;
+
+#if (defined _MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable: 4127) // conditional expression is constant
+#endif
+
+    // These ranks match the values selected by the exact implementation
+    if(InterpolateValuesV == false || numElements & 1)
+        median = _pSketch->get_item((numElements - 1) / 2);
+    else
+        median = this->_get_interpolated_sketch_value(std::integral_constant<bool, InterpolateValuesV>());
+
+#if (defined _MSC_VER)
+#   pragma warning(pop)
+#endif
+
+    // Clean up after ourselves
+    _pSketch.reset(new SketchType(_pSketch->k()));
+
+    return median;
+}
+
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::_get_interpolated_sketch_value(std::true_type /*supports Interpolated values*/) {
+    std::uint64_t const                     numElements(_pSketch->size());
+
+    assert(numElements >= 2 && (numElements & 1) == 0);
+
+    TransformedT const                      smaller(_pSketch->get_item(numElements / 2 - 1));
+    TransformedT const                      greater(_pSketch->get_item(numElements / 2));
+
+#if (defined __clang__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wdouble-promotion"
+#endif
+
+    return static_cast<TransformedT>((static_cast<double>(smaller) + greater) / 2);
+
+#if (defined __clang__)
+#   pragma clang diagnostic pop
+#endif
+}
+
+template <typename InputT, typename TransformedT, bool InterpolateValuesV>
+TransformedT Details::MedianTrainingOnlyPolicy<InputT, TransformedT, InterpolateValuesV>::_get_interpolated_sketch_value(std::false_type /*supports Interpolated values*/) {
+    throw std::runtime_error("This should never be called");
+}
+
 } // namespace Components
 } // namespace Featurizers
 } // namespace Featurizer
@@ -86,6 +86,38 @@ public:
         return execute(temp);
     }
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_batch
+    ///  \brief         Transforms `cInput` items into `pOutput`, which must
+    ///                 reference `cInput` constructed items. The batch is forwarded
+    ///                 to the `StandardTransformer` when it is the only `Transformer`
+    ///                 in the pipeline.
+    ///
+    void execute_batch(typename BaseType::InputType const *pInput, size_t cInput, typename BaseType::TransformedType *pOutput) {
+        if(pInput == nullptr && cInput != 0)
+            throw std::invalid_argument("pInput");
+
+        if(pOutput == nullptr && cInput != 0)
+            throw std::invalid_argument("pOutput");
+
+        if(cInput == 0)
+            return;
+
+        _transformerChain.execute_batch(pInput, cInput, pOutput);
+    }
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \fn            execute_into
+    ///  \brief         Forwards to the `execute_into` method of the `Transformer`,
+    ///                 which writes the result to caller-provided buffers. Only
+    ///                 available when the `Transformer` is the last element in the
+    ///                 pipeline.
+    ///
+    template <typename... ArgTs>
+    size_t execute_into(ArgTs &&... args) {
+        return _transformerChain.execute_into(std::forward<ArgTs>(args)...);
+    }
+
 private:
     // ----------------------------------------------------------------------
     // |  Private Types
@@ -0,0 +1,442 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../../Archive.h"
+#include "../../Traits.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         QuantileSketch
+///  \brief         A KLL sketch that approximates the rank of values in a
+///                 stream while using memory proportional to `k` (rather
+///                 than to the number of values in the stream).
+///
+///                 Values are stored in a hierarchy of compactors, where a value
+///                 at level `h` represents 2^h values of the original stream.
+///                 When a level is full, it is sorted and every other value is
+///                 promoted to the next level. The results are exact until more
+///                 than `k` values have been added.
+///
+///                 Sketches with the same `k` can be merged, so sketches built
+///                 over different shards of data (and serialized with `save`)
+///                 can be combined into a sketch that describes all of the data.
+///
+template <typename T>
+class QuantileSketch {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using ValueType                         = T;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Data
+    // |
+    // ----------------------------------------------------------------------
+    static constexpr std::uint16_t const    MinK = 8;
+    static constexpr std::uint16_t const    DefaultK = 200;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /// Returns the smallest `k` where the normalized rank error of a single
+    /// quantile is expected to be no larger than `rankError` (for example, 0.01
+    /// for 1%).
+    static std::uint16_t CalculateK(double rankError);
+
+    QuantileSketch(std::uint16_t k=DefaultK);
+    QuantileSketch(Archive &ar);
+
+    ~QuantileSketch(void) = default;
+
+    QuantileSketch(QuantileSketch const &) = default;
+    QuantileSketch(QuantileSketch &&) = default;
+
+    QuantileSketch & operator =(QuantileSketch const &) = delete;
+    QuantileSketch & operator =(QuantileSketch &&) = delete;
+
+    bool operator==(QuantileSketch const &other) const;
+
+    void save(Archive &ar) const;
+
+    std::uint16_t k(void) const;
+
+    /// Returns the number of values added to the sketch.
+    std::uint64_t size(void) const;
+    bool empty(void) const;
+
+    /// Returns the number of values currently stored by the sketch.
+    size_t num_retained(void) const;
+
+    void update(T value);
+
+    /// Adds the values described by `other` to this sketch.
+    void merge(QuantileSketch const &other);
+
+    /// Returns the value whose 0-based rank (in sorted order) is approximately
+    /// `rank`; `rank` must be less than `size()`.
+    T get_item(std::uint64_t rank) const;
+
+    /// Returns the value at the specified fraction (in [0.0, 1.0]) of the sorted
+    /// values.
+    T get_quantile(double fraction) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    using Level                             = std::vector<T>;
+    using Levels                            = std::vector<Level>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::uint16_t const                     _k;
+
+    std::uint64_t                           _n;
+    Levels                                  _levels;
+
+    // The number of values that can be retained before a level must be compacted
+    size_t                                  _maxRetained;
+    size_t                                  _numRetained;
+
+    // State of the generator used to choose which half of a level is promoted;
+    // a fixed seed keeps the results deterministic.
+    std::uint64_t                           _randomState;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    QuantileSketch(std::uint16_t k, std::uint64_t n, Levels levels, std::uint64_t randomState);
+
+    size_t GetLevelCapacity(size_t level) const;
+    void UpdateMaxRetained(void);
+
+    bool NextRandomBit(void);
+
+    /// Compacts levels until the number of retained values is within the capacity
+    /// of the sketch.
+    void Compress(void);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename T>
+/*static*/ std::uint16_t QuantileSketch<T>::CalculateK(double rankError) {
+    if(rankError <= 0.0 || rankError >= 1.0)
+        throw std::invalid_argument("rankError");
+
+    // Empirical relationship between `k` and the single-quantile rank error
+    // (at 99% confidence) of KLL sketches: rankError ~= 2.296 / k^0.9723
+    double const                            k(std::ceil(std::pow(2.296 / rankError, 1.0 / 0.9723)));
+
+    if(k <= static_cast<double>(MinK))
+        return MinK;
+
+    if(k >= static_cast<double>(std::numeric_limits<std::uint16_t>::max()))
+        throw std::invalid_argument("rankError");
+
+    return static_cast<std::uint16_t>(k);
+}
+
+template <typename T>
+QuantileSketch<T>::QuantileSketch(std::uint16_t k) :
+    QuantileSketch(k, 0, Levels(1), 0x9E3779B97F4A7C15ULL) {
+}
+
+template <typename T>
+QuantileSketch<T>::QuantileSketch(Archive &ar) :
+    QuantileSketch(
+        [&ar](void) {
+            // Version
+            std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
+            std::uint16_t                   minorVersion(Traits<std::uint16_t>::deserialize(ar));
+
+            if(majorVersion != 1 || minorVersion != 0)
+                throw std::runtime_error("Unsupported archive version");
+
+            // Data
+            std::uint16_t                   k(Traits<std::uint16_t>::deserialize(ar));
+            std::uint64_t                   n(Traits<std::uint64_t>::deserialize(ar));
+            std::uint64_t                   randomState(Traits<std::uint64_t>::deserialize(ar));
+            Levels                          levels(Traits<Levels>::deserialize(ar));
+
+            return QuantileSketch(k, n, std::move(levels), randomState);
+        }()
+    ) {
+}
+
+template <typename T>
+bool QuantileSketch<T>::operator==(QuantileSketch const &other) const {
+    return _k == other._k
+        && _n == other._n
+        && _randomState == other._randomState
+        && _levels == other._levels;
+}
+
+template <typename T>
+void QuantileSketch<T>::save(Archive &ar) const {
+    // Version
+    Traits<std::uint16_t>::serialize(ar, 1); // Major
+    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+
+    // Data
+    Traits<std::uint16_t>::serialize(ar, _k);
+    Traits<std::uint64_t>::serialize(ar, _n);
+    Traits<std::uint64_t>::serialize(ar, _randomState);
+    Traits<Levels>::serialize(ar, _levels);
+}
+
+template <typename T>
+std::uint16_t QuantileSketch<T>::k(void) const {
+    return _k;
+}
+
+template <typename T>
+std::uint64_t QuantileSketch<T>::size(void) const {
+    return _n;
+}
+
+template <typename T>
+bool QuantileSketch<T>::empty(void) const {
+    return _n == 0;
+}
+
+template <typename T>
+size_t QuantileSketch<T>::num_retained(void) const {
+    return _numRetained;
+}
+
+template <typename T>
+void QuantileSketch<T>::update(T value) {
+    _levels[0].emplace_back(std::move(value));
+
+    ++_n;
+    ++_numRetained;
+
+    if(_numRetained > _maxRetained)
+        Compress();
+}
+
+template <typename T>
+void QuantileSketch<T>::merge(QuantileSketch const &other) {
+    if(other._k != _k)
+        throw std::invalid_argument("other");
+
+    if(&other == this) {
+        QuantileSketch const                copy(other);
+
+        merge(copy);
+        return;
+    }
+
+    if(_levels.size() < other._levels.size()) {
+        _levels.resize(other._levels.size());
+        UpdateMaxRetained();
+    }
+
+    for(size_t level = 0; level < other._levels.size(); ++level)
+        _levels[level].insert(_levels[level].end(), other._levels[level].begin(), other._levels[level].end());
+
+    _n += other._n;
+    _numRetained += other._numRetained;
+
+    Compress();
+}
+
+template <typename T>
+T QuantileSketch<T>::get_item(std::uint64_t rank) const {
+    if(rank >= _n)
+        throw std::invalid_argument("rank");
+
+    // Sort the retained values along with their weights
+    std::vector<std::pair<T const *, std::uint64_t>>    items;
+
+    items.reserve(_numRetained);
+
+    for(size_t level = 0; level < _levels.size(); ++level) {
+        std::uint64_t const                 weight(static_cast<std::uint64_t>(1) << level);
+
+        for(auto const &value : _levels[level])
+            items.emplace_back(&value, weight);
+    }
+
+    std::sort(
+        items.begin(),
+        items.end(),
+        [](std::pair<T const *, std::uint64_t> const &a, std::pair<T const *, std::uint64_t> const &b) {
+            return *a.first < *b.first;
+        }
+    );
+
+    std::uint64_t                           cumulative(0);
+
+    for(auto const &item : items) {
+        cumulative += item.second;
+
+        if(cumulative > rank)
+            return *item.first;
+    }
+
+    // The weights always sum to `_n`
+    assert(false);
+    return *items.back().first;
+}
+
+template <typename T>
+T QuantileSketch<T>::get_quantile(double fraction) const {
+    if(fraction < 0.0 || fraction > 1.0)
+        throw std::invalid_argument("fraction");
+
+    if(_n == 0)
+        throw std::runtime_error("The sketch is empty");
+
+    return get_item(static_cast<std::uint64_t>(fraction * static_cast<double>(_n - 1)));
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename T>
+QuantileSketch<T>::QuantileSketch(std::uint16_t k, std::uint64_t n, Levels levels, std::uint64_t randomState) :
+    _k(
+        [&k](void) {
+            if(k < MinK)
+                throw std::invalid_argument("k");
+
+            return k;
+        }()
+    ),
+    _n(n),
+    _levels(std::move(levels)),
+    _maxRetained(0),
+    _numRetained(0),
+    _randomState(randomState) {
+    if(_levels.empty() || _levels.size() >= 64 || _randomState == 0)
+        throw std::runtime_error("Invalid sketch data");
+
+    // The weights of the retained values must account for every value in the stream
+    std::uint64_t                           total(0);
+
+    for(size_t level = 0; level < _levels.size(); ++level) {
+        total += static_cast<std::uint64_t>(_levels[level].size()) << level;
+        _numRetained += _levels[level].size();
+    }
+
+    if(total != _n)
+        throw std::runtime_error("Invalid sketch data");
+
+    UpdateMaxRetained();
+    Compress();
+}
+
+template <typename T>
+size_t QuantileSketch<T>::GetLevelCapacity(size_t level) const {
+    // Capacities decrease geometrically (by a factor of 2/3) from the top level
+    // down, which bounds the total size of the sketch to O(k).
+    size_t const                            depth(_levels.size() - level - 1);
+
+    return std::max(
+        static_cast<size_t>(MinK),
+        static_cast<size_t>(static_cast<double>(_k) * std::pow(2.0 / 3.0, static_cast<double>(depth)))
+    );
+}
+
+template <typename T>
+void QuantileSketch<T>::UpdateMaxRetained(void) {
+    _maxRetained = 0;
+
+    for(size_t level = 0; level < _levels.size(); ++level)
+        _maxRetained += GetLevelCapacity(level);
+}
+
+template <typename T>
+bool QuantileSketch<T>::NextRandomBit(void) {
+    // xorshift64
+    _randomState ^= _randomState << 13;
+    _randomState ^= _randomState >> 7;
+    _randomState ^= _randomState << 17;
+
+    return (_randomState & 1) != 0;
+}
+
+template <typename T>
+void QuantileSketch<T>::Compress(void) {
+    while(_numRetained > _maxRetained) {
+        // Find the lowest level that is full
+        size_t                              level(0);
+
+        // Because the total exceeds the sum of the level capacities, at least one
+        // level must be full.
+        while(_levels[level].size() < GetLevelCapacity(level))
+            ++level;
+
+        assert(level < _levels.size());
+
+        if(level + 1 == _levels.size()) {
+            if(_levels.size() + 1 >= 64)
+                throw std::runtime_error("The sketch has too many levels");
+
+            _levels.emplace_back();
+            UpdateMaxRetained();
+        }
+
+        Level &                             current(_levels[level]);
+        Level &                             next(_levels[level + 1]);
+
+        std::sort(current.begin(), current.end());
+
+        // If the number of values is odd, keep the first one at this level so that
+        // the total weight doesn't change.
+        size_t const                        start(current.size() & 1);
+        size_t const                        offset(NextRandomBit() ? 1 : 0);
+
+        for(size_t index = start + offset; index < current.size(); index += 2)
+            next.emplace_back(std::move(current[index]));
+
+        size_t const                        numPromoted((current.size() - start) / 2);
+
+        current.erase(current.begin() + static_cast<std::ptrdiff_t>(start), current.end());
+        _numRetained -= numPromoted;
+    }
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,281 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ThreadPool
+///  \brief         A fixed set of worker threads that execute batches of
+///                 independent tasks.
+///
+///                 Tasks in a batch are partitioned across per-worker shards
+///                 (task `i` belongs to shard `i % size()`). Each worker
+///                 processes its own shard first and then steals unclaimed
+///                 tasks from the other shards, so a few expensive tasks
+///                 don't leave the remaining workers idle.
+///
+///                 The thread that invokes `run` acts as worker 0, which means
+///                 that a pool of size 1 doesn't create any threads.
+///
+class ThreadPool {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using TaskFunc                          = std::function<void (size_t workerIndex, size_t taskIndex)>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    // A `numThreads` value of 0 creates one worker per hardware thread.
+    ThreadPool(size_t numThreads);
+    ~ThreadPool(void);
+
+    ThreadPool(ThreadPool const &) = delete;
+    ThreadPool(ThreadPool &&) = delete;
+
+    ThreadPool & operator =(ThreadPool const &) = delete;
+    ThreadPool & operator =(ThreadPool &&) = delete;
+
+    /// Returns the number of workers (including the calling thread).
+    size_t size(void) const;
+
+    /// Invokes `func` for each task in [0, cTasks) and returns once all of the
+    /// tasks have completed. If a task throws, tasks that haven't started are
+    /// skipped and the first exception is rethrown on the calling thread.
+    /// `run` must not be invoked concurrently or from within a task.
+    void run(size_t cTasks, TaskFunc const &func);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    size_t const                            _numWorkers;
+
+    std::mutex                              _mutex;
+    std::condition_variable                 _startCondition;
+    std::condition_variable                 _doneCondition;
+
+    // The following values are guarded by `_mutex`
+    size_t                                  _generation;
+    bool                                    _stopping;
+    size_t                                  _cActiveThreads;
+    std::exception_ptr                      _exception;
+
+    // The following values are written before a batch starts and read by the
+    // workers while it is running
+    TaskFunc const *                        _pFunc;
+    size_t                                  _cTasks;
+
+    // The number of tasks claimed in each shard
+    std::unique_ptr<std::atomic<size_t> []> _claimed;
+    std::atomic<bool>                       _failed;
+
+    std::vector<std::thread>                _threads;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void ThreadProc(size_t workerIndex);
+
+    /// Executes tasks until every shard has been exhausted.
+    void Work(size_t workerIndex);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+inline ThreadPool::ThreadPool(size_t numThreads) :
+    _numWorkers(
+        [&numThreads](void) -> size_t {
+            if(numThreads != 0)
+                return numThreads;
+
+            unsigned int const              hardwareThreads(std::thread::hardware_concurrency());
+
+            return hardwareThreads != 0 ? hardwareThreads : 1;
+        }()
+    ),
+    _generation(0),
+    _stopping(false),
+    _cActiveThreads(0),
+    _pFunc(nullptr),
+    _cTasks(0),
+    _claimed(new std::atomic<size_t>[_numWorkers]),
+    _failed(false) {
+    _threads.reserve(_numWorkers - 1);
+
+    try {
+        for(size_t workerIndex = 1; workerIndex < _numWorkers; ++workerIndex)
+            _threads.emplace_back([this, workerIndex](void) { ThreadProc(workerIndex); });
+    }
+    catch(...) {
+        {
+            std::unique_lock<std::mutex>    lock(_mutex);
+
+            _stopping = true;
+        }
+
+        _startCondition.notify_all();
+
+        for(auto &thread : _threads)
+            thread.join();
+
+        throw;
+    }
+}
+
+inline ThreadPool::~ThreadPool(void) {
+    {
+        std::unique_lock<std::mutex>        lock(_mutex);
+
+        _stopping = true;
+    }
+
+    _startCondition.notify_all();
+
+    for(auto &thread : _threads)
+        thread.join();
+}
+
+inline size_t ThreadPool::size(void) const {
+    return _numWorkers;
+}
+
+inline void ThreadPool::run(size_t cTasks, TaskFunc const &func) {
+    if(!func)
+        throw std::invalid_argument("func");
+
+    if(cTasks == 0)
+        return;
+
+    _pFunc = &func;
+    _cTasks = cTasks;
+    _failed = false;
+
+    for(size_t shard = 0; shard < _numWorkers; ++shard)
+        _claimed[shard] = 0;
+
+    {
+        std::unique_lock<std::mutex>        lock(_mutex);
+
+        _exception = std::exception_ptr();
+        _cActiveThreads = _threads.size();
+        ++_generation;
+    }
+
+    _startCondition.notify_all();
+
+    Work(0);
+
+    std::exception_ptr                      exception;
+
+    {
+        std::unique_lock<std::mutex>        lock(_mutex);
+
+        _doneCondition.wait(lock, [this](void) { return _cActiveThreads == 0; });
+
+        exception = std::move(_exception);
+        _exception = std::exception_ptr();
+    }
+
+    _pFunc = nullptr;
+
+    if(exception)
+        std::rethrow_exception(exception);
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+inline void ThreadPool::ThreadProc(size_t workerIndex) {
+    size_t                                  generation(0);
+
+    while(true) {
+        {
+            std::unique_lock<std::mutex>    lock(_mutex);
+
+            _startCondition.wait(lock, [this, &generation](void) { return _stopping || _generation != generation; });
+
+            if(_stopping)
+                return;
+
+            generation = _generation;
+        }
+
+        Work(workerIndex);
+
+        {
+            std::unique_lock<std::mutex>    lock(_mutex);
+
+            if(--_cActiveThreads != 0)
+                continue;
+        }
+
+        _doneCondition.notify_one();
+    }
+}
+
+inline void ThreadPool::Work(size_t workerIndex) {
+    for(size_t offset = 0; offset < _numWorkers; ++offset) {
+        size_t const                        shard((workerIndex + offset) % _numWorkers);
+
+        while(true) {
+            size_t const                    taskIndex(shard + _claimed[shard].fetch_add(1) * _numWorkers);
+
+            if(taskIndex >= _cTasks)
+                break;
+
+            if(_failed)
+                continue;
+
+            try {
+                (*_pFunc)(workerIndex, taskIndex);
+            }
+            catch(...) {
+                std::unique_lock<std::mutex>    lock(_mutex);
+
+                if(!_exception)
+                    _exception = std::current_exception();
+
+                _failed = true;
+            }
+        }
+    }
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,721 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../Featurizer.h"
+#include "GrainIndex.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Featurizers {
+namespace Components {
+
+enum class TimeSeriesImputeStrategy : uint8_t {
+    Forward = 1,                            ///< Nulls are replaced with the most recent valid value in the grain
+    Backward,                               ///< Nulls are replaced with the next valid value in the grain; rows are held until it is seen
+    Median,                                 ///< Nulls are replaced with the grain's median from training (for the median columns)
+    Interpolate,                            ///< Reserved; not supported by the engine
+
+    NumValues
+};
+
+inline bool IsValid(TimeSeriesImputeStrategy value) {
+    return value == TimeSeriesImputeStrategy::Forward
+        || value == TimeSeriesImputeStrategy::Backward
+        || value == TimeSeriesImputeStrategy::Median
+        || value == TimeSeriesImputeStrategy::Interpolate;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         ValidityBitmap
+///  \brief         A packed sequence of bits where each bit indicates if the
+///                 corresponding value in a column is valid (not null).
+///
+class ValidityBitmap {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    ValidityBitmap(void);
+    ~ValidityBitmap(void) = default;
+
+    ValidityBitmap(ValidityBitmap const &) = default;
+    ValidityBitmap(ValidityBitmap &&) = default;
+
+    ValidityBitmap & operator =(ValidityBitmap const &) = default;
+    ValidityBitmap & operator =(ValidityBitmap &&) = default;
+
+    size_t size(void) const;
+    bool operator[](size_t index) const;
+
+    void set(size_t index, bool value=true);
+    void push_back(bool value);
+
+    /// Removes the first `count` bits.
+    void erase_front(size_t count);
+    void clear(void);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::vector<std::uint64_t>              _words;
+    size_t                                  _size;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         TimeSeriesImputerEngine
+///  \brief         Column-oriented implementation of time series imputation.
+///
+///                 Rows are stored column by column, where each column is a
+///                 vector of values and a validity bitmap, and grains are
+///                 interned so that per-grain state is stored in vectors
+///                 indexed by grain id.
+///
+///                 `ValueT` is `std::double_t` for numeric data; the string-
+///                 based `TimeSeriesImputerEstimator::Transformer` uses
+///                 `std::string` values so that the text of observed values
+///                 is preserved when they are used to impute other rows.
+///
+template <typename ValueT>
+class TimeSeriesImputerEngine {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using ValueType                         = ValueT;
+    using TimePointType                     = std::chrono::system_clock::time_point;
+    using FrequencyType                     = std::chrono::system_clock::duration;
+    using GrainType                         = std::vector<std::string>;
+    using GrainIndexType                    = GrainIndex<GrainType>;
+    using GrainIdType                       = typename GrainIndexType::IdType;
+    using MedianMap                         = std::map<GrainType, std::vector<ValueT>>;
+
+    /////////////////////////////////////////////////////////////////////////
+    ///  \class         RowBuffer
+    ///  \brief         Rows stored column by column.
+    ///
+    class RowBuffer {
+    public:
+        // ----------------------------------------------------------------------
+        // |
+        // |  Public Data
+        // |
+        // ----------------------------------------------------------------------
+        std::vector<TimePointType>          TimePoints;
+        std::vector<GrainIdType>            GrainIds;
+
+        /// Indicates if the row was added by the imputer
+        ValidityBitmap                      Added;
+
+        /// Values and validity, indexed by column and then by row
+        std::vector<std::vector<ValueT>>    Values;
+        std::vector<ValidityBitmap>         Valid;
+
+        // ----------------------------------------------------------------------
+        // |
+        // |  Public Methods
+        // |
+        // ----------------------------------------------------------------------
+        RowBuffer(size_t cColumns);
+        ~RowBuffer(void) = default;
+
+        RowBuffer(RowBuffer const &) = default;
+        RowBuffer(RowBuffer &&) = default;
+
+        RowBuffer & operator =(RowBuffer const &) = delete;
+        RowBuffer & operator =(RowBuffer &&) = delete;
+
+        size_t num_columns(void) const;
+        size_t size(void) const;
+
+        /// Appends a row where every value is null.
+        void push_back(TimePointType timePoint, GrainIdType grainId, bool added);
+
+        /// Moves the first `count` rows in `source` to the end of this buffer.
+        void splice_front(RowBuffer &source, size_t count);
+
+        void clear(void);
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /// `medianColumns` indicates which columns can be imputed with median
+    /// values and determines the number of columns; `medians` contains a
+    /// value for each column per grain.
+    TimeSeriesImputerEngine(
+        FrequencyType frequency,
+        TimeSeriesImputeStrategy strategy,
+        std::vector<bool> medianColumns,
+        MedianMap const &medians,
+        bool suppressError
+    );
+
+    ~TimeSeriesImputerEngine(void) = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimeSeriesImputerEngine);
+
+    size_t num_columns(void) const;
+
+    /// Returns the id associated with the grain, adding it if necessary.
+    GrainIdType get_grain_id(GrainType const &grain);
+    GrainType const & get_grain(GrainIdType id) const;
+
+    /// Imputes the rows in `input` (in order); rows that are ready are appended
+    /// to `output`. Valid values are moved out of `input`.
+    void execute(RowBuffer &input, RowBuffer &output);
+
+    /// Appends any rows that are still pending to `output` (ordered by grain)
+    /// and resets the per-grain state.
+    void flush(RowBuffer &output);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Types
+    // |
+    // ----------------------------------------------------------------------
+    struct GrainState {
+        bool                                HasRows;
+        TimePointType                       LastTimePoint;
+
+        // Forward: the most recent valid value in each column
+        std::vector<ValueT>                 LastValues;
+        ValidityBitmap                      LastValid;
+
+        // Backward: rows that contain null values which haven't been resolved
+        // by a subsequent row yet (along with the rows that follow them)
+        RowBuffer                           Pending;
+
+        // The number of null values in each pending row
+        std::vector<size_t>                 PendingNulls;
+
+        // The positions of pending rows that have a null value, indexed by column.
+        // Positions are relative to the first row ever added to `Pending`.
+        std::vector<std::vector<size_t>>    NullPositions;
+        size_t                              PendingBase;
+
+        GrainState(size_t cColumns);
+    };
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    FrequencyType const                     _frequency;
+    TimeSeriesImputeStrategy const          _strategy;
+    std::vector<bool> const                 _medianColumns;
+    bool const                              _suppressError;
+
+    GrainIndexType                          _grains;
+
+    // Median values indexed by grain id; grains without median values have an
+    // empty vector.
+    std::vector<std::vector<ValueT>>        _medians;
+    std::vector<GrainState>                 _states;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    GrainState & GetState(GrainIdType id);
+
+    /// Returns the number of rows that must be added before a row at `timePoint`.
+    size_t GetNumAddedRows(GrainState const &state, TimePointType timePoint) const;
+
+    /// Appends the added rows followed by a row for `timePoint` (with null values)
+    /// to `dest` and updates the time tracked by `state`.
+    void AppendRows(GrainState &state, GrainIdType id, TimePointType timePoint, size_t cAddedRows, RowBuffer &dest) const;
+
+    void ExecuteForward(GrainState &state, RowBuffer &input, size_t row, RowBuffer &output);
+    void ExecuteBackward(GrainState &state, RowBuffer &input, size_t row, RowBuffer &output);
+    void ExecuteMedian(GrainState &state, RowBuffer &input, size_t row, RowBuffer &output);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  ValidityBitmap
+// |
+// ----------------------------------------------------------------------
+inline ValidityBitmap::ValidityBitmap(void) :
+    _size(0) {
+}
+
+inline size_t ValidityBitmap::size(void) const {
+    return _size;
+}
+
+inline bool ValidityBitmap::operator[](size_t index) const {
+    assert(index < _size);
+    return (_words[index / 64] >> (index % 64)) & 1;
+}
+
+inline void ValidityBitmap::set(size_t index, bool value) {
+    assert(index < _size);
+
+    std::uint64_t const                     mask(static_cast<std::uint64_t>(1) << (index % 64));
+
+    if(value)
+        _words[index / 64] |= mask;
+    else
+        _words[index / 64] &= ~mask;
+}
+
+inline void ValidityBitmap::push_back(bool value) {
+    if(_size % 64 == 0)
+        _words.emplace_back(0);
+
+    ++_size;
+    set(_size - 1, value);
+}
+
+inline void ValidityBitmap::erase_front(size_t count) {
+    assert(count <= _size);
+
+    if(count == 0)
+        return;
+
+    size_t const                            newSize(_size - count);
+
+    if(count % 64 == 0)
+        _words.erase(_words.begin(), _words.begin() + static_cast<std::ptrdiff_t>(count / 64));
+    else {
+        for(size_t index = 0; index < newSize; ++index)
+            set(index, (*this)[index + count]);
+
+        _words.resize((newSize + 63) / 64);
+    }
+
+    _size = newSize;
+
+    // Keep the bits beyond the end clear so that `push_back` can rely on them
+    if(_size % 64 != 0)
+        _words.back() &= (static_cast<std::uint64_t>(1) << (_size % 64)) - 1;
+}
+
+inline void ValidityBitmap::clear(void) {
+    _words.clear();
+    _size = 0;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  TimeSeriesImputerEngine::RowBuffer
+// |
+// ----------------------------------------------------------------------
+template <typename ValueT>
+TimeSeriesImputerEngine<ValueT>::RowBuffer::RowBuffer(size_t cColumns) :
+    Values(cColumns),
+    Valid(cColumns) {
+}
+
+template <typename ValueT>
+size_t TimeSeriesImputerEngine<ValueT>::RowBuffer::num_columns(void) const {
+    return Values.size();
+}
+
+template <typename ValueT>
+size_t TimeSeriesImputerEngine<ValueT>::RowBuffer::size(void) const {
+    return TimePoints.size();
+}
+
+template <typename ValueT>
+void TimeSeriesImputerEngine<ValueT>::RowBuffer::push_back(TimePointType timePoint, GrainIdType grainId, bool added) {
+    TimePoints.emplace_back(timePoint);
+    GrainIds.emplace_back(grainId);
+    Added.push_back(added);
+
+    for(size_t column = 0; column < Values.size(); ++column) {
+        Values[column].emplace_back();
+        Valid[column].push_back(false);
+    }
+}
+
+template <typename ValueT>
+void TimeSeriesImputerEngine<ValueT>::RowBuffer::splice_front(RowBuffer &source, size_t count) {
+    if(source.num_columns() != num_columns())
+        throw std::invalid_argument("source");
+    if(count > source.size())
+        throw std::invalid_argument("count");
+
+    if(count == 0)
+        return;
+
+    std::ptrdiff_t const                    offset(static_cast<std::ptrdiff_t>(count));
+
+    TimePoints.insert(TimePoints.end(), source.TimePoints.begin(), source.TimePoints.begin() + offset);
+    source.TimePoints.erase(source.TimePoints.begin(), source.TimePoints.begin() + offset);
+
+    GrainIds.insert(GrainIds.end(), source.GrainIds.begin(), source.GrainIds.begin() + offset);
+    source.GrainIds.erase(source.GrainIds.begin(), source.GrainIds.begin() + offset);
+
+    for(size_t row = 0; row < count; ++row)
+        Added.push_back(source.Added[row]);
+
+    source.Added.erase_front(count);
+
+    for(size_t column = 0; column < Values.size(); ++column) {
+        std::vector<ValueT> &               sourceValues(source.Values[column]);
+        ValidityBitmap &                    sourceValid(source.Valid[column]);
+
+        Values[column].insert(
+            Values[column].end(),
+            std::make_move_iterator(sourceValues.begin()),
+            std::make_move_iterator(sourceValues.begin() + offset)
+        );
+        sourceValues.erase(sourceValues.begin(), sourceValues.begin() + offset);
+
+        for(size_t row = 0; row < count; ++row)
+            Valid[column].push_back(sourceValid[row]);
+
+        sourceValid.erase_front(count);
+    }
+}
+
+template <typename ValueT>
+void TimeSeriesImputerEngine<ValueT>::RowBuffer::clear(void) {
+    TimePoints.clear();
+    GrainIds.clear();
+    Added.clear();
+
+    for(size_t column = 0; column < Values.size(); ++column) {
+        Values[column].clear();
+        Valid[column].clear();
+    }
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  TimeSeriesImputerEngine
+// |
+// ----------------------------------------------------------------------
+template <typename ValueT>
+TimeSeriesImputerEngine<ValueT>::TimeSeriesImputerEngine(
+    FrequencyType frequency,
+    TimeSeriesImputeStrategy strategy,
+    std::vector<bool> medianColumns,
+    MedianMap const &medians,
+    bool suppressError
+) :
+    _frequency(std::move(frequency)),
+    _strategy(
+        [&strategy](void) {
+            if(IsValid(strategy) == false)
+                throw std::invalid_argument("strategy");
+
+            return strategy;
+        }()
+    ),
+    _medianColumns(
+        std::move(
+            [&medianColumns](void) -> std::vector<bool> & {
+                if(medianColumns.empty())
+                    throw std::invalid_argument("medianColumns");
+
+                return medianColumns;
+            }()
+        )
+    ),
+    _suppressError(suppressError) {
+    for(auto const &kvp : medians) {
+        if(kvp.second.size() != _medianColumns.size())
+            throw std::invalid_argument("medians");
+
+        GrainIdType const                   id(_grains.insert(kvp.first).first);
+
+        assert(id == _medians.size());
+        _medians.emplace_back(kvp.second);
+    }
+}
+
+template <typename ValueT>
+size_t TimeSeriesImputerEngine<ValueT>::num_columns(void) const {
+    return _medianColumns.size();
+}
+
+template <typename ValueT>
+typename TimeSeriesImputerEngine<ValueT>::GrainIdType TimeSeriesImputerEngine<ValueT>::get_grain_id(GrainType const &grain) {
+    return _grains.insert(grain).first;
+}
+
+template <typename ValueT>
+typename TimeSeriesImputerEngine<ValueT>::GrainType const & TimeSeriesImputerEngine<ValueT>::get_grain(GrainIdType id) const {
+    if(id >= _grains.size())
+        throw std::invalid_argument("Invalid grain id");
+
+    return _grains[id];
+}
+
+template <typename ValueT>
+void TimeSeriesImputerEngine<ValueT>::execute(RowBuffer &input, RowBuffer &output) {
+    if(input.num_columns() != num_columns())
+        throw std::invalid_argument("input");
+    if(output.num_columns() != num_columns())
+        throw std::invalid_argument("output");
+
+    for(size_t row = 0; row < input.size(); ++row) {
+        GrainIdType const                   id(input.GrainIds[row]);
+
+        if(id >= _grains.size())
+            throw std::invalid_argument("Invalid grain id");
+
+        GrainState &                        state(GetState(id));
+
+        // Ensure that this row is in chronological order
+        if(state.HasRows && input.TimePoints[row] < state.LastTimePoint)
+            throw std::runtime_error("Input stream not in chronological order.");
+
+        // Invoke the specified impute strategy
+        if(_strategy == TimeSeriesImputeStrategy::Forward)
+            ExecuteForward(state, input, row, output);
+        else if(_strategy == TimeSeriesImputeStrategy::Median)
+            ExecuteMedian(state, input, row, output);
+        else if(_strategy == TimeSeriesImputeStrategy::Backward)
+            ExecuteBackward(state, input, row, output);
+        else
+            throw std::runtime_error("Unsupported Impute Strategy");
+    }
+}
+
+template <typename ValueT>
+void TimeSeriesImputerEngine<ValueT>::flush(RowBuffer &output) {
+    if(output.num_columns() != num_columns())
+        throw std::invalid_argument("output");
+
+    for(GrainIdType id : _grains.sorted_ids()) {
+        if(id >= _states.size())
+            continue;
+
+        RowBuffer &                         pending(_states[id].Pending);
+
+        output.splice_front(pending, pending.size());
+    }
+
+    // Clear the working state
+    _states.clear();
+}
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+template <typename ValueT>
+TimeSeriesImputerEngine<ValueT>::GrainState::GrainState(size_t cColumns) :
+    HasRows(false),
+    LastValues(cColumns),
+    Pending(cColumns),
+    NullPositions(cColumns),
+    PendingBase(0) {
+    for(size_t column = 0; column < cColumns; ++column)
+        LastValid.push_back(false);
+}
+
+template <typename ValueT>
+typename TimeSeriesImputerEngine<ValueT>::GrainState & TimeSeriesImputerEngine<ValueT>::GetState(GrainIdType id) {
+    while(_states.size() <= id)
+        _states.emplace_back(num_columns());
+
+    return _states[id];
+}
+
+template <typename ValueT>
+size_t TimeSeriesImputerEngine<ValueT>::GetNumAddedRows(GrainState const &state, TimePointType timePoint) const {
+    if(state.HasRows == false)
+        return 0;
+
+    size_t                                  result(0);
+
+    for(TimePointType tp = state.LastTimePoint + _frequency; tp < timePoint; tp += _frequency)
+        ++result;
+
+    return result;
+}
+
+template <typename ValueT>
+void TimeSeriesImputerEngine<ValueT>::AppendRows(GrainState &state, GrainIdType id, TimePointType timePoint, size_t cAddedRows, RowBuffer &dest) const {
+    TimePointType                           tp(state.LastTimePoint);
+
+    while(cAddedRows--) {
+        tp += _frequency;
+        dest.push_back(tp, id, true);
+    }
+
+    dest.push_back(timePoint, id, false);
+
+    state.HasRows = true;
+    state.LastTimePoint = timePoint;
+}
+
+template <typename ValueT>
+void TimeSeriesImputerEngine<ValueT>::ExecuteForward(GrainState &state, RowBuffer &input, size_t row, RowBuffer &output) {
+    size_t const                            firstRow(output.size());
+
+    AppendRows(state, input.GrainIds[row], input.TimePoints[row], GetNumAddedRows(state, input.TimePoints[row]), output);
+
+    size_t const                            inputRow(output.size() - 1);
+
+    for(size_t column = 0; column < num_columns(); ++column) {
+        std::vector<ValueT> &               values(output.Values[column]);
+        ValidityBitmap &                    valid(output.Valid[column]);
+
+        if(state.LastValid[column]) {
+            for(size_t outputRow = firstRow; outputRow < inputRow; ++outputRow) {
+                values[outputRow] = state.LastValues[column];
+                valid.set(outputRow);
+            }
+        }
+
+        if(input.Valid[column][row]) {
+            state.LastValues[column] = input.Values[column][row];
+            state.LastValid.set(column);
+
+            values[inputRow] = std::move(input.Values[column][row]);
+            valid.set(inputRow);
+        }
+        else if(state.LastValid[column]) {
+            values[inputRow] = state.LastValues[column];
+            valid.set(inputRow);
+        }
+    }
+}
+
+template <typename ValueT>
+void TimeSeriesImputerEngine<ValueT>::ExecuteBackward(GrainState &state, RowBuffer &input, size_t row, RowBuffer &output) {
+    RowBuffer &                             pending(state.Pending);
+    size_t const                            firstRow(pending.size());
+
+    AppendRows(state, input.GrainIds[row], input.TimePoints[row], GetNumAddedRows(state, input.TimePoints[row]), pending);
+
+    size_t const                            inputRow(pending.size() - 1);
+
+    state.PendingNulls.resize(pending.size(), num_columns());
+
+    for(size_t column = 0; column < num_columns(); ++column) {
+        std::vector<ValueT> &               values(pending.Values[column]);
+        ValidityBitmap &                    valid(pending.Valid[column]);
+        std::vector<size_t> &               nullPositions(state.NullPositions[column]);
+
+        if(input.Valid[column][row] == false) {
+            for(size_t pendingRow = firstRow; pendingRow <= inputRow; ++pendingRow)
+                nullPositions.emplace_back(state.PendingBase + pendingRow);
+
+            continue;
+        }
+
+        // This value is the next valid value for every null that is pending in
+        // this column.
+        ValueT &                            value(input.Values[column][row]);
+
+        for(size_t position : nullPositions) {
+            size_t const                    pendingRow(position - state.PendingBase);
+
+            values[pendingRow] = value;
+            valid.set(pendingRow);
+            --state.PendingNulls[pendingRow];
+        }
+
+        nullPositions.clear();
+
+        for(size_t pendingRow = firstRow; pendingRow < inputRow; ++pendingRow) {
+            values[pendingRow] = value;
+            valid.set(pendingRow);
+            --state.PendingNulls[pendingRow];
+        }
+
+        values[inputRow] = std::move(value);
+        valid.set(inputRow);
+        --state.PendingNulls[inputRow];
+    }
+
+    // Output the leading rows that don't have any nulls
+    size_t                                  cReady(0);
+
+    while(cReady < pending.size() && state.PendingNulls[cReady] == 0)
+        ++cReady;
+
+    if(cReady == 0)
+        return;
+
+    output.splice_front(pending, cReady);
+    state.PendingNulls.erase(state.PendingNulls.begin(), state.PendingNulls.begin() + static_cast<std::ptrdiff_t>(cReady));
+    state.PendingBase += cReady;
+}
+
+template <typename ValueT>
+void TimeSeriesImputerEngine<ValueT>::ExecuteMedian(GrainState &state, RowBuffer &input, size_t row, RowBuffer &output) {
+    GrainIdType const                       id(input.GrainIds[row]);
+    size_t const                            cAddedRows(GetNumAddedRows(state, input.TimePoints[row]));
+    bool const                              hasMedians(id < _medians.size() && _medians[id].empty() == false);
+
+    if(hasMedians == false && _suppressError == false) {
+        for(size_t column = 0; column < num_columns(); ++column) {
+            if(_medianColumns[column] && (cAddedRows != 0 || input.Valid[column][row] == false))
+                throw std::runtime_error("Invalid key");
+        }
+    }
+
+    size_t const                            firstRow(output.size());
+
+    AppendRows(state, id, input.TimePoints[row], cAddedRows, output);
+
+    size_t const                            inputRow(output.size() - 1);
+
+    for(size_t column = 0; column < num_columns(); ++column) {
+        std::vector<ValueT> &               values(output.Values[column]);
+        ValidityBitmap &                    valid(output.Valid[column]);
+        bool const                          isImputed(hasMedians && _medianColumns[column]);
+
+        if(isImputed) {
+            for(size_t outputRow = firstRow; outputRow < inputRow; ++outputRow) {
+                values[outputRow] = _medians[id][column];
+                valid.set(outputRow);
+            }
+        }
+
+        if(input.Valid[column][row]) {
+            values[inputRow] = std::move(input.Values[column][row]);
+            valid.set(inputRow);
+        }
+        else if(isImputed) {
+            values[inputRow] = _medians[id][column];
+            valid.set(inputRow);
+        }
+    }
+}
+
+} // namespace Components
+} // namespace Featurizers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -9,6 +9,7 @@
 #include "../../Traits.h"
 #include "PipelineExecutionEstimatorImpl.h"
 #include "TimeSeriesFrequencyEstimator.h"
+#include "TimeSeriesImputerEngine.h"
 #include "TimeSeriesMedianEstimator.h"
 
 namespace Microsoft {
@@ -16,22 +17,6 @@ namespace Featurizer {
 namespace Featurizers {
 namespace Components {
 
-enum class TimeSeriesImputeStrategy : uint8_t {
-    Forward = 1,                            ///< TODO: Document this
-    Backward,                               ///< TODO: Document this
-    Median,                                 ///< TODO: Document this
-    Interpolate,                            ///< TODO: Document this
-
-    NumValues
-};
-
-inline bool IsValid(TimeSeriesImputeStrategy value) {
-    return value == TimeSeriesImputeStrategy::Forward
-        || value == TimeSeriesImputeStrategy::Backward
-        || value == TimeSeriesImputeStrategy::Median
-        || value == TimeSeriesImputeStrategy::Interpolate;
-}
-
 using TimeSeriesImputerEstimatorInputType = std::tuple<
     std::chrono::system_clock::time_point,
     std::vector<std::string>,
@@ -68,11 +53,18 @@ public:
     using SerDeDurationType = std::chrono::duration<int64_t, std::ratio<1,1000000000>>;
 
 
+    /////////////////////////////////////////////////////////////////////////
+    ///  \class         Transformer
+    ///  \brief         Adapts rows of optional strings to a `TimeSeriesImputerEngine`
+    ///                 that works with string values; median values are converted
+    ///                 to strings once rather than each time that they are used.
+    ///
     class Transformer : public Microsoft::Featurizer::Transformer<typename BaseType::InputType,typename BaseType::TransformedType> {
     public:
 
         using StrTraits                     = Traits<nonstd::optional<std::string>>;
         using ThisBaseType                  = Microsoft::Featurizer::Transformer<typename BaseType::InputType,typename BaseType::TransformedType>;
+        using EngineType                    = TimeSeriesImputerEngine<std::string>;
 
         // ----------------------------------------------------------------------
         // |
@@ -106,8 +98,11 @@ public:
         // |  Private Data
         // |
         // ----------------------------------------------------------------------
-        std::map<KeyType,OutputRowType>                                     _lastRowtracker;
-        std::map<KeyType,std::vector<BaseType::TransformedType>>            _buffer;
+        EngineType                                      _engine;
+
+        // Scratch buffers used when invoking the engine
+        EngineType::RowBuffer                           _input;
+        EngineType::RowBuffer                           _output;
 
         // ----------------------------------------------------------------------
         // |
@@ -117,11 +112,8 @@ public:
         void execute_impl(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) override;
         void flush_impl(typename ThisBaseType::CallbackFunction const &callback) override;
 
-        std::vector<typename BaseType::TransformedType> generate_rows(typename ThisBaseType::InputType const &input, TimePointType const & lastObservedTP);
-        void impute(ColsToImputeType & prev, ColsToImputeType & current);
-        bool no_nulls(ColsToImputeType const & input);
-        void bfill(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback);
-        void ffill_or_median(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback);
+        /// Invokes the callback for each row in `_output` and clears it.
+        void OutputRows(typename ThisBaseType::CallbackFunction const &callback);
     };
 
     using TransformerType                   = Transformer;
@@ -246,10 +238,48 @@ inline TimeSeriesImputerEstimator::Transformer::Transformer(TimeSeriesImputerEst
     _colsToImputeDataTypes(std::move(colsToImputeDataTypes)),
     _tsImputeStrategy(std::move(tsImputeStrategy)),
     _medianValues(std::move(medianValues)),
-    _supressError(std::move(supressError)) {
+    _supressError(std::move(supressError)),
+    _engine(
+        _frequency,
+        _tsImputeStrategy,
+        [this](void) {
+            if(_colsToImputeDataTypes.size() == 0)
+                throw std::runtime_error("Column metadata can't be empty.");
+
+            std::vector<bool>               result;
+
+            result.reserve(_colsToImputeDataTypes.size());
+
+            for(auto const &colType : _colsToImputeDataTypes)
+                result.push_back(TimeSeriesMedianEstimator::DoesColTypeSupportMedian(colType));
+
+            return result;
+        }(),
+        [this](void) {
+            EngineType::MedianMap           result;
+
+            for(auto const &kvp : _medianValues) {
+                std::vector<std::string>    values(_colsToImputeDataTypes.size());
+
+                for(std::size_t colIndex = 0; colIndex < _colsToImputeDataTypes.size(); ++colIndex) {
+                    if(TimeSeriesMedianEstimator::DoesColTypeSupportMedian(_colsToImputeDataTypes[colIndex]) == false)
+                        continue;
+
+                    if(colIndex >= kvp.second.size())
+                        throw std::runtime_error("Invalid median values");
+
+                    values[colIndex] = Traits<std::double_t>::ToString(kvp.second[colIndex]);
+                }
+
+                result.emplace(kvp.first, std::move(values));
+            }
 
-    if(_colsToImputeDataTypes.size() == 0)
-        throw std::runtime_error("Column metadata can't be empty.");
+            return result;
+        }(),
+        _supressError
+    ),
+    _input(_colsToImputeDataTypes.size()),
+    _output(_colsToImputeDataTypes.size()) {
 
     if(_frequency == std::chrono::system_clock::duration::max())
         throw std::runtime_error("Frequency couldn't be inferred from training data.");
@@ -363,163 +393,55 @@ inline void TimeSeriesImputerEstimator::Transformer::save(Archive & ar) const {
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 inline void TimeSeriesImputerEstimator::Transformer::execute_impl(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) /*override*/ {
-    // Ensure that this row is in chronological order
-    KeyType const &                                                         key(std::get<1>(input));
-    std::map<KeyType, OutputRowType>::const_iterator const                  iterLastRow(_lastRowtracker.find(key));
+    ColsToImputeType const &                                                colValues(std::get<2>(input));
 
-    if(iterLastRow != _lastRowtracker.end()) {
-        std::chrono::system_clock::time_point const &   lastRowTimePoint(std::get<1>(iterLastRow->second));
-        std::chrono::system_clock::time_point const &   inputTimePoint(std::get<0>(input));
+    if(colValues.size() != _colsToImputeDataTypes.size())
+        throw std::runtime_error("Invalid number of columns.");
 
-        if(inputTimePoint < lastRowTimePoint)
-            throw std::runtime_error("Input stream not in chronological order.");
-    }
-
-    // Invoke the specified impute strategy
-    if(_tsImputeStrategy == TimeSeriesImputeStrategy::Forward || _tsImputeStrategy == TimeSeriesImputeStrategy::Median)
-        ffill_or_median(input, callback);
-    else if(_tsImputeStrategy == TimeSeriesImputeStrategy::Backward)
-        bfill(input, callback);
-    else
-        throw std::runtime_error("Unsupported Impute Strategy");
-}
+    _input.clear();
+    _input.push_back(std::get<0>(input), _engine.get_grain_id(std::get<1>(input)), false);
 
-inline void TimeSeriesImputerEstimator::Transformer::flush_impl(typename ThisBaseType::CallbackFunction const &callback) /*override*/ {
-    std::vector<typename TimeSeriesImputerEstimator::BaseType::TransformedType> output;
+    for(std::size_t colIndex = 0; colIndex < colValues.size(); ++colIndex) {
+        if(StrTraits::IsNull(colValues[colIndex]))
+            continue;
 
-    for (auto it = _buffer.begin(); it != _buffer.end(); ++it)
-        output.insert(output.end(), it->second.begin(), it->second.end());
-
-    // Clear the working state
-    _lastRowtracker.clear();
-    _buffer.clear();
-
-    // TODO: This can be implemented more efficiently, but we are just going for functional parity during this refactor
-    for(auto & addedRow : output)
-        callback(std::move(addedRow));
-}
-
-inline std::vector<typename TimeSeriesImputerEstimator::Transformer::ThisBaseType::TransformedType> TimeSeriesImputerEstimator::Transformer::generate_rows(typename ThisBaseType::InputType const &input, typename TimeSeriesImputerEstimator::TimePointType const & lastObservedTP) {
-
-    std::vector<typename TimeSeriesImputerEstimator::Transformer::ThisBaseType::TransformedType> output;
-    typename TimeSeriesImputerEstimator::TimePointType tempTP = lastObservedTP + _frequency;
-    typename TimeSeriesImputerEstimator::TimePointType inputTP = std::get<0>(input);
-
-    while(tempTP < inputTP) {
-        output.push_back(std::make_tuple(true, tempTP, std::get<1>(input), ColsToImputeType(std::get<2>(input).size())));
-        tempTP = tempTP + _frequency;
+        _input.Values[colIndex][0] = StrTraits::GetNullableValue(colValues[colIndex]);
+        _input.Valid[colIndex].set(0);
     }
 
-    output.push_back(std::tuple_cat(std::make_tuple(false), input));
-
-    return output;
+    _engine.execute(_input, _output);
+    OutputRows(callback);
 }
 
-inline void TimeSeriesImputerEstimator::Transformer::impute(typename TimeSeriesImputerEstimator::ColsToImputeType & prev, typename TimeSeriesImputerEstimator::ColsToImputeType & current) {
-
-    for(std::size_t i=0; i< current.size(); ++i)
-        if(StrTraits::IsNull(current[i]))
-            current[i] = prev[i];
-}
-
-inline bool TimeSeriesImputerEstimator::Transformer::no_nulls(typename TimeSeriesImputerEstimator::ColsToImputeType const & input) {
-
-    for(std::size_t i=0; i< input.size(); ++i)
-        if(StrTraits::IsNull(input[i]))
-            return false;
-
-    return true;
-}
-
-inline void TimeSeriesImputerEstimator::Transformer::bfill(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) {
-
-    typename TimeSeriesImputerEstimator::KeyType const & key = std::get<1>(input);
-
-    if ( _lastRowtracker.find(key) == _lastRowtracker.end() )
-            _lastRowtracker.insert(std::make_pair(key, std::tuple_cat(std::make_tuple(false), input)));
-
-    typename TimeSeriesImputerEstimator::OutputRowType  & lastRow = _lastRowtracker[key];
-    std::vector<TimeSeriesImputerEstimator::BaseType::TransformedType> addedRowsResultset = generate_rows(input, std::get<1>(lastRow));
-
-    if ( _buffer.find(key) != _buffer.end() )
-            _buffer[key].insert(_buffer[key].end(), addedRowsResultset.begin(), addedRowsResultset.end());
-    else
-        _buffer.insert(std::make_pair(key, addedRowsResultset));
-
-    lastRow = _buffer[key].back();
-
-    for (auto it = _buffer[key].rbegin(); it != _buffer[key].rend(); it++) {
-        impute(std::get<3>(lastRow), std::get<3>(*it));
-        lastRow = *it;
-    }
-    _lastRowtracker[key] = _buffer[key].back();
-
-    std::vector<typename TimeSeriesImputerEstimator::BaseType::TransformedType> results;
-    int count = 0;
-    for(std::size_t i=0; i< _buffer[key].size(); ++i)
-    {
-        if(no_nulls(std::get<3>(_buffer[key][i]))){
-            results.push_back(_buffer[key][i]);
-            count++;
-        }
-        else
-            break;
-    }
-
-    if(count > 0)
-        _buffer[key].erase(_buffer[key].begin(),_buffer[key].begin()+count);
-
-    // TODO: This can be implemented more efficiently, but we are just going for functional parity during this refactor
-    for(auto & addedRow : results)
-        callback(std::move(addedRow));
+inline void TimeSeriesImputerEstimator::Transformer::flush_impl(typename ThisBaseType::CallbackFunction const &callback) /*override*/ {
+    _engine.flush(_output);
+    OutputRows(callback);
 }
 
-inline void TimeSeriesImputerEstimator::Transformer::ffill_or_median(typename ThisBaseType::InputType const &input, typename ThisBaseType::CallbackFunction const &callback) {
-
-    typename TimeSeriesImputerEstimator::KeyType const & key = std::get<1>(input);
-    if ( _lastRowtracker.find(key) == _lastRowtracker.end() )
-            _lastRowtracker.insert(std::make_pair(key, std::tuple_cat(std::make_tuple(false), input)));
-
-    typename TimeSeriesImputerEstimator::OutputRowType  & lastRow = _lastRowtracker[key];
-    std::vector<TimeSeriesImputerEstimator::BaseType::TransformedType> addedRowsResultset = generate_rows(input, std::get<1>(lastRow));
-
-    for(auto &addedRow : addedRowsResultset) {
-        if(_tsImputeStrategy == TimeSeriesImputeStrategy::Forward)
-            impute(std::get<3>(lastRow) , std::get<3>(addedRow));
-        else {
-            std::map<KeyType,std::vector<double_t>>::const_iterator const   iterMedian(_medianValues.find(key));
-            typename TimeSeriesImputerEstimator::ColsToImputeType &         addedRowData(std::get<3>(addedRow));
+inline void TimeSeriesImputerEstimator::Transformer::OutputRows(typename ThisBaseType::CallbackFunction const &callback) {
+    for(std::size_t row = 0; row < _output.size(); ++row) {
+        ColsToImputeType                                                    colValues;
 
-            for(std::size_t addedRowColIndex = 0; addedRowColIndex < addedRowData.size(); ++addedRowColIndex) {
-
-                if(TimeSeriesMedianEstimator::DoesColTypeSupportMedian(_colsToImputeDataTypes[addedRowColIndex]) == false)
-                    continue;
-
-                if(StrTraits::IsNull(addedRowData[addedRowColIndex])) {
-                    if(iterMedian == _medianValues.end())
-                    {
-                        if(_supressError)
-                            continue;
-                        else
-                            throw std::runtime_error("Invalid key");
-                    }
-
-					assert(addedRowColIndex < _colsToImputeDataTypes.size());
-                    assert(addedRowColIndex < iterMedian->second.size());
-                    addedRowData[addedRowColIndex] = Traits<std::double_t>::ToString(iterMedian->second[addedRowColIndex]);
-                }
-            }
+        colValues.reserve(_output.num_columns());
 
+        for(std::size_t colIndex = 0; colIndex < _output.num_columns(); ++colIndex) {
+            if(_output.Valid[colIndex][row])
+                colValues.emplace_back(std::move(_output.Values[colIndex][row]));
+            else
+                colValues.emplace_back();
         }
 
-        lastRow = addedRow;
+        callback(
+            std::make_tuple(
+                _output.Added[row],
+                _output.TimePoints[row],
+                _engine.get_grain(_output.GrainIds[row]),
+                std::move(colValues)
+            )
+        );
     }
 
-    _lastRowtracker[key] = lastRow;
-
-    // TODO: This can be implemented more efficiently, but we are just going for functional parity during this refactor
-    for(auto & addedRow : addedRowsResultset)
-        callback(std::move(addedRow));
+    _output.clear();
 }
 
 } // namespace Components
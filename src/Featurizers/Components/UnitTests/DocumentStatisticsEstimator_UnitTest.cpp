@@ -8,6 +8,7 @@
 #include "../../../3rdParty/optional.h"
 #include "../DocumentStatisticsEstimator.h"
 #include "../../TestHelpers.h"
+#include "DocumentTestHelpers.h"
 #include "../../../Traits.h"
 
 namespace NS = Microsoft::Featurizer;
@@ -93,7 +94,7 @@ void TestGeneratingParseFunc(std::string input,
                              std::string const & regexToken,
                              std::uint32_t const & ngramRangeMin,
                              std::uint32_t const & ngramRangeMax) {
-    ParseFunctionType parseFunc(NS::Featurizers::Components::DocumentParseFuncGenerator(analyzer, regexToken, ngramRangeMin, ngramRangeMax));
+    ParseFunctionType parseFunc(NS::TestHelpers::DocumentParseFuncGenerator(analyzer, regexToken, ngramRangeMin, ngramRangeMax));
 
     std::vector<std::string> output;
     parseFunc(
@@ -115,19 +116,19 @@ TEST_CASE("TestGeneratingParseFunc") {
 
 TEST_CASE("DocumentDecorator functionality") {
     //  with lower, analyze word, empty regex, ngram_min == 1 and ngram_max == 1
-    CHECK(NS::Featurizers::Components::DocumentDecorator("   This ,is a document", true, AnalyzerMethod::Word, "", 1, 1) == "   this ,is a document");
+    CHECK(NS::TestHelpers::DocumentDecorator("   This ,is a document", true, AnalyzerMethod::Word, "", 1, 1) == "   this ,is a document");
     //  without lower, analyze word, empty regex, ngram_min == 1 and ngram_max == 1
-    CHECK(NS::Featurizers::Components::DocumentDecorator("   This ,is a document", false, AnalyzerMethod::Word, "", 1, 1) == "   This ,is a document");
+    CHECK(NS::TestHelpers::DocumentDecorator("   This ,is a document", false, AnalyzerMethod::Word, "", 1, 1) == "   This ,is a document");
     //  without lower, analyze word, non-empty regex, ngram_min == 1 and ngram_max == 1
-    CHECK(NS::Featurizers::Components::DocumentDecorator("   This ,is a document", false, AnalyzerMethod::Word, "abc", 1, 1) == "   This ,is a document");
+    CHECK(NS::TestHelpers::DocumentDecorator("   This ,is a document", false, AnalyzerMethod::Word, "abc", 1, 1) == "   This ,is a document");
     //  without lower, analyze word, empty regex, ngram_min == 0 and ngram_max == 0
-    CHECK(NS::Featurizers::Components::DocumentDecorator("    This, is      a document", false, AnalyzerMethod::Word, "", 0, 0) == " This is a document");
+    CHECK(NS::TestHelpers::DocumentDecorator("    This, is      a document", false, AnalyzerMethod::Word, "", 0, 0) == " This is a document");
     //  without lower, analyze word, non-empty regex, ngram_min == 0 and ngram_max == 0
-    CHECK(NS::Featurizers::Components::DocumentDecorator("   This, is      a document", false, AnalyzerMethod::Word, "abc", 0, 0) == "   This, is      a document");
+    CHECK(NS::TestHelpers::DocumentDecorator("   This, is      a document", false, AnalyzerMethod::Word, "abc", 0, 0) == "   This, is      a document");
     //  without lower, analyze char, non-empty regex, ngram_min == 0 and ngram_max == 0
-    CHECK(NS::Featurizers::Components::DocumentDecorator("  This, is      a document", false, AnalyzerMethod::Char, "abc", 0, 0) == " This is a document");
+    CHECK(NS::TestHelpers::DocumentDecorator("  This, is      a document", false, AnalyzerMethod::Char, "abc", 0, 0) == " This is a document");
     //  without lower, analyze charwb, non-empty regex, ngram_min == 0 and ngram_max == 0
-    CHECK(NS::Featurizers::Components::DocumentDecorator("  This, is      a document", false, AnalyzerMethod::Charwb, "abc", 0, 0) == " This is a document ");
+    CHECK(NS::TestHelpers::DocumentDecorator("  This, is      a document", false, AnalyzerMethod::Charwb, "abc", 0, 0) == " This is a document ");
 }
 
 TEST_CASE("string_idf") {
@@ -200,6 +201,36 @@ TEST_CASE("string_idf_custom_decorator") {
                    ngramRangeMax);
 }
 
+TEST_CASE("string_custom_decorator") {
+    // Decorators other than `Strings::ToLower` are applied to each term
+    FrequencyMap const                         termFreqLabel({{"ORANGE", 2}, {"APPLE", 1}, {"PEACH", 1}});
+    IndexMap const                             termIndexLabel({{"APPLE", 0}, {"ORANGE", 1}, {"PEACH", 2}});
+    FrequencyAndIndexMap const                 termFreqAndIndexLabel = NS::Featurizers::Components::MergeTwoMapsWithSameKeys(termFreqLabel, termIndexLabel);
+    std::uint32_t const                        docuNumsLabel(2);
+
+    std::vector<std::vector<std::string>> const
+                                               inputBatches({{"orange Apple apple"},
+                                                            {"ORANGE peach"}});
+
+    StringDecorator decorator = [](std::string input) {
+        std::transform(input.begin(), input.end(), input.begin(), [](char c) { return static_cast<char>(std::toupper(c)); });
+        return input;
+    };
+
+    DSRTestWrapper(inputBatches,
+                   termFreqAndIndexLabel,
+                   docuNumsLabel,
+                   decorator,
+                   AnalyzerMethod::Word,
+                   "",
+                   nonstd::optional<IndexMap>(),
+                   nonstd::optional<std::uint32_t>(),
+                   0.0f,
+                   1.0f,
+                   1,
+                   1);
+}
+
 TEST_CASE("string_idf_regex_no_decorator") {
     FrequencyMap const                         termFreqLabel({{"jumpy", 1}, {"fox", 1}});
     IndexMap const                             termIndexLabel({{"fox", 0}, {"jumpy", 1}});
@@ -0,0 +1,107 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cassert>
+
+#include "../DocumentTokenizer.h"
+#include "../../../Strings.h"
+
+namespace Microsoft {
+namespace Featurizer {
+namespace TestHelpers {
+
+// ----------------------------------------------------------------------
+// |
+// |  Reference implementation of document tokenization, used to validate
+// |  `DocumentTokenizer`: `DocumentDecorator` normalizes the whole document
+// |  and the function created by `DocumentParseFuncGenerator` splits it
+// |  into terms.
+// |
+// ----------------------------------------------------------------------
+using AnalyzerMethod                        = Featurizers::Components::AnalyzerMethod;
+using StringIterator                        = std::string::const_iterator;
+using ParseFunctionType                     = std::function<void (std::string const &, std::function<void (StringIterator, StringIterator)> const &)>;
+
+inline ParseFunctionType DocumentParseFuncGenerator(AnalyzerMethod const &analyzer, std::string const & regexToken, std::uint32_t const & ngramRangeMin, std::uint32_t const & ngramRangeMax) {
+    if (analyzer == AnalyzerMethod::Word) {
+        if (!regexToken.empty()) {
+            // Compile the pattern once rather than each time that the function is invoked
+            std::shared_ptr<re2::RE2 const> pRegex(std::make_shared<re2::RE2>(regexToken));
+
+            return [pRegex] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
+                Microsoft::Featurizer::Strings::ParseRegex(
+                    input,
+                    *pRegex,
+                    callback
+                );
+            };
+        } else if (ngramRangeMin == 1 && ngramRangeMax == 1) {
+            return [] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
+                Microsoft::Featurizer::Strings::Parse<std::string::const_iterator, std::function<bool (char)>>(
+                    input,
+                    [] (char c) {return std::isspace(c);},
+                    callback
+                );
+            };
+        } else {
+            return [ngramRangeMin, ngramRangeMax] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
+                Microsoft::Featurizer::Strings::ParseNgramWord<std::string::const_iterator, std::function<bool (char)>>(
+                    input,
+                    [] (char c) {return std::isspace(c);},
+                    ngramRangeMin,
+                    ngramRangeMax,
+                    callback
+                );
+            };
+        }
+    } else if (analyzer == AnalyzerMethod::Char) {
+        return [ngramRangeMin, ngramRangeMax] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
+            Microsoft::Featurizer::Strings::ParseNgramChar<std::string::const_iterator>(
+                input,
+                ngramRangeMin,
+                ngramRangeMax,
+                callback
+            );
+        };
+    } else {
+        assert(analyzer == AnalyzerMethod::Charwb);
+        return [ngramRangeMin, ngramRangeMax] (std::string const & input, std::function<void (StringIterator, StringIterator)> const &callback) {
+            Microsoft::Featurizer::Strings::ParseNgramCharwb<std::string::const_iterator, std::function<bool (char)>>(
+                input,
+                [] (char c) {return std::isspace(c);},
+                ngramRangeMin,
+                ngramRangeMax,
+                callback
+            );
+        };
+    }
+}
+
+inline std::string DocumentDecorator(std::string const& input, bool const& lower, AnalyzerMethod const& analyzer, std::string const& regex, std::uint32_t const& ngram_min, std::uint32_t const& ngram_max) {
+
+    std::string decoratedInput = lower ? Strings::ToLower(input) : input;
+    std::string processedInput;
+
+    if (analyzer == AnalyzerMethod::Word) {
+        if (regex.empty() && !(ngram_min == 1 && ngram_max == 1)) {
+            processedInput = Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(decoratedInput);
+        } else {
+            processedInput = decoratedInput;
+        }
+    } else if (analyzer == AnalyzerMethod::Char) {
+        processedInput = Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(decoratedInput);
+    } else {
+        assert(analyzer == AnalyzerMethod::Charwb);
+        auto predicate = [] (char c) {return std::isspace(c);};
+        std::string processedString(Microsoft::Featurizer::Strings::Details::ReplaceAndDeDuplicate<std::function<bool (char)>>(decoratedInput));
+        processedInput = Microsoft::Featurizer::Strings::Details::StringPadding<std::function<bool (char)>>(processedString, predicate);
+    }
+    return processedInput;
+}
+
+} // namespace TestHelpers
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../DocumentTokenizer.h"
+#include "DocumentTestHelpers.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using AnalyzerMethod                        = NS::Featurizers::Components::AnalyzerMethod;
+using DocumentTokenizer                     = NS::Featurizers::Components::DocumentTokenizer;
+using StringIterator                        = DocumentTokenizer::StringIterator;
+
+std::vector<std::string> Tokenize(DocumentTokenizer &tokenizer, std::string const &input) {
+    std::vector<std::string>                result;
+
+    tokenizer.Tokenize(
+        input,
+        [&result](StringIterator begin, StringIterator end) {
+            result.emplace_back(begin, end);
+        }
+    );
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+std::vector<std::string> TokenizeExpected(std::string const &input, bool lowercase, AnalyzerMethod analyzer, std::string const &regexToken, std::uint32_t ngramRangeMin, std::uint32_t ngramRangeMax) {
+    std::vector<std::string>                result;
+
+    NS::TestHelpers::DocumentParseFuncGenerator(analyzer, regexToken, ngramRangeMin, ngramRangeMax)(
+        NS::TestHelpers::DocumentDecorator(input, lowercase, analyzer, regexToken, ngramRangeMin, ngramRangeMax),
+        [&result](StringIterator begin, StringIterator end) {
+            result.emplace_back(begin, end);
+        }
+    );
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+/// Compares the tokenizer with `DocumentDecorator` followed by the function created
+/// by `DocumentParseFuncGenerator`, including the exceptions thrown by each.
+void Test(std::string const &input, bool lowercase, AnalyzerMethod analyzer, std::string const &regexToken, std::uint32_t ngramRangeMin, std::uint32_t ngramRangeMax) {
+    DocumentTokenizer                       tokenizer(lowercase, analyzer, regexToken, ngramRangeMin, ngramRangeMax);
+    std::vector<std::string>                expected;
+    std::string                             expectedException;
+
+    try {
+        expected = TokenizeExpected(input, lowercase, analyzer, regexToken, ngramRangeMin, ngramRangeMax);
+    }
+    catch(std::exception const &ex) {
+        expectedException = ex.what();
+    }
+
+    // Invoke the tokenizer twice to ensure that the scratch buffers are reused correctly
+    for(int iteration = 0; iteration < 2; ++iteration) {
+        INFO("'" << input << "', " << static_cast<int>(analyzer) << ", [" << ngramRangeMin << ", " << ngramRangeMax << "], " << iteration);
+
+        if(expectedException.empty())
+            CHECK(Tokenize(tokenizer, input) == expected);
+        else if(analyzer == AnalyzerMethod::Charwb && input.empty())
+            CHECK_THROWS_AS(Tokenize(tokenizer, input), std::out_of_range);
+        else
+            CHECK_THROWS_WITH(Tokenize(tokenizer, input), expectedException);
+    }
+}
+
+std::vector<std::string> const              Inputs{
+    "",
+    " ",
+    "a",
+    "This is a test",
+    "  Leading and trailing whitespace  ",
+    "Punctuation, punctuation; and more punctuation!!!",
+    "!!Hello!!",
+    "Tabs\tand\nnewlines\r\n\v\fhere",
+    "UPPER lower MiXeD",
+    "The quick brown fox jumps over the lazy dog. THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG!",
+    "A string that is long enough to use the vectorized path, with punctuation... and    runs of whitespace",
+    "Non-ASCII characters: caf\xc3\xa9 na\xc3\xafve \xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e"
+};
+
+TEST_CASE("Word") {
+    for(auto const &input : Inputs) {
+        for(bool lowercase : { false, true }) {
+            Test(input, lowercase, AnalyzerMethod::Word, "", 1, 1);
+            Test(input, lowercase, AnalyzerMethod::Word, "", 1, 2);
+            Test(input, lowercase, AnalyzerMethod::Word, "", 2, 3);
+        }
+    }
+}
+
+TEST_CASE("Word - regex") {
+    for(auto const &input : Inputs) {
+        for(bool lowercase : { false, true }) {
+            Test(input, lowercase, AnalyzerMethod::Word, "[a-z]+", 1, 1);
+            Test(input, lowercase, AnalyzerMethod::Word, "[^ ]+", 1, 1);
+        }
+    }
+}
+
+TEST_CASE("Char") {
+    for(auto const &input : Inputs) {
+        for(bool lowercase : { false, true }) {
+            Test(input, lowercase, AnalyzerMethod::Char, "", 1, 1);
+            Test(input, lowercase, AnalyzerMethod::Char, "", 2, 4);
+            Test(input, lowercase, AnalyzerMethod::Char, "", 3, 3);
+        }
+    }
+}
+
+TEST_CASE("Charwb") {
+    for(auto const &input : Inputs) {
+        for(bool lowercase : { false, true }) {
+            Test(input, lowercase, AnalyzerMethod::Charwb, "", 1, 1);
+            Test(input, lowercase, AnalyzerMethod::Charwb, "", 1, 3);
+            Test(input, lowercase, AnalyzerMethod::Charwb, "", 2, 4);
+            Test(input, lowercase, AnalyzerMethod::Charwb, "", 5, 5);
+        }
+    }
+}
+
+TEST_CASE("Invalid ngram range") {
+    Test("This is a test", false, AnalyzerMethod::Word, "", 0, 2);
+    Test("This is a test", false, AnalyzerMethod::Word, "", 3, 2);
+    Test("This is a test", false, AnalyzerMethod::Char, "", 0, 2);
+    Test("This is a test", false, AnalyzerMethod::Charwb, "", 3, 2);
+}
@@ -0,0 +1,123 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../FrozenIndexMap.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using FrozenIndexMap                        = NS::Featurizers::Components::FrozenIndexMap;
+using IndexMap                              = FrozenIndexMap::IndexMap;
+
+static std::uint32_t const                  InvalidIndex = FrozenIndexMap::InvalidIndex;
+
+void Test(IndexMap const &map) {
+    FrozenIndexMap const                    frozen(map);
+
+    CHECK(frozen.size() == map.size());
+
+    for(auto const & kvp : map) {
+        CHECK(frozen.find(kvp.first) == kvp.second);
+        CHECK(frozen.find(kvp.first.data(), kvp.first.size()) == kvp.second);
+
+        // Prefixes and extensions of the string shouldn't be found (unless
+        // they are in the map as well)
+        if(kvp.first.empty() == false && map.find(kvp.first.substr(1)) == map.end())
+            CHECK(frozen.find(kvp.first.substr(1)) == InvalidIndex);
+
+        if(map.find(kvp.first + "!") == map.end())
+            CHECK(frozen.find(kvp.first + "!") == InvalidIndex);
+    }
+
+    // Enumeration returns every item exactly once
+    IndexMap                                enumerated;
+
+    frozen.enumerate(
+        [&enumerated](char const *pData, size_t cData, std::uint32_t index) {
+            CHECK(enumerated.emplace(std::string(pData, cData), index).second);
+        }
+    );
+
+    CHECK(enumerated == map);
+
+    // Serialization
+    NS::Archive                             out;
+
+    frozen.save(out);
+
+    NS::Archive                             in(out.commit());
+    FrozenIndexMap const                    other(in);
+
+    CHECK(in.AtEnd());
+    CHECK(other == frozen);
+}
+
+TEST_CASE("Empty") {
+    FrozenIndexMap const                    frozen((IndexMap()));
+
+    CHECK(frozen.size() == 0);
+    CHECK(frozen.find("") == InvalidIndex);
+    CHECK(frozen.find("foo") == InvalidIndex);
+
+    Test(IndexMap());
+}
+
+TEST_CASE("Standard") {
+    Test(IndexMap{ {"one", 0}, {"two", 1}, {"three", 2} });
+    Test(IndexMap{ {"", 10}, {"a", 20}, {"ab", 30}, {"abc", 40}, {"b", 50} });
+    Test(IndexMap{ {"only", 0} });
+}
+
+TEST_CASE("Large") {
+    IndexMap                                map;
+
+    for(std::uint32_t index = 0; index < 100000; ++index)
+        map.emplace("term" + std::to_string(index * 7), index);
+
+    Test(map);
+}
+
+TEST_CASE("Deterministic") {
+    // The frozen map shouldn't depend on the order in which items were inserted
+    IndexMap                                map1;
+    IndexMap                                map2;
+
+    for(std::uint32_t index = 0; index < 1000; ++index) {
+        map1.emplace(std::to_string(index), index);
+        map2.emplace(std::to_string(999 - index), 999 - index);
+    }
+
+    CHECK(FrozenIndexMap(map1) == FrozenIndexMap(map2));
+    CHECK((FrozenIndexMap(map1) == FrozenIndexMap(IndexMap{ {"0", 0} })) == false);
+}
+
+TEST_CASE("Errors") {
+    CHECK_THROWS_WITH(FrozenIndexMap(IndexMap{ {"foo", InvalidIndex} }), "'map' contains an invalid index");
+
+    NS::Archive                             out;
+
+    out.serialize(static_cast<std::uint32_t>(3));
+    out.serialize(static_cast<std::uint32_t>(2));
+    out.serialize(static_cast<std::uint32_t>(0));
+    out.serialize(static_cast<std::uint32_t>(0));
+
+    NS::Archive                             in(out.commit());
+
+    CHECK_THROWS_WITH(FrozenIndexMap(in), "Invalid FrozenIndexMap data");
+
+    // A word count that is larger than the archive is detected before any
+    // memory is allocated for it
+    NS::Archive                             truncatedOut;
+
+    truncatedOut.serialize(std::numeric_limits<std::uint32_t>::max());
+    truncatedOut.serialize(static_cast<std::uint32_t>(0));
+    truncatedOut.serialize(static_cast<std::uint32_t>(0));
+    truncatedOut.serialize(static_cast<std::uint32_t>(0));
+
+    NS::Archive                             truncatedIn(truncatedOut.commit());
+
+    CHECK_THROWS_WITH(FrozenIndexMap(truncatedIn), "Invalid delta");
+}
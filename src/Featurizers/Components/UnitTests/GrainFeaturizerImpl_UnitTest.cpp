@@ -626,6 +626,95 @@ TEST_CASE("Estimator - limited individual training items") {
     }
 }
 
+TEST_CASE("Estimator - multiple training threads") {
+    // ----------------------------------------------------------------------
+    using ThisSumTrainingOnlyEstimator      = SumTrainingOnlyEstimator<>;
+    using Estimator                         = Components::GrainEstimatorImpl<std::string, ThisSumTrainingOnlyEstimator>;
+    // ----------------------------------------------------------------------
+
+    std::vector<std::string>                grains;
+    std::vector<std::uint32_t>              values;
+    std::vector<Estimator::InputType>       inputs;
+
+    for(std::uint32_t index = 0; index < 100; ++index)
+        grains.emplace_back(std::to_string(index));
+
+    for(std::uint32_t index = 0; index < 5000; ++index)
+        values.emplace_back(index);
+
+    for(std::uint32_t index = 0; index < 5000; ++index)
+        inputs.emplace_back(grains[(index * 7) % grains.size()], values[index]);
+
+    auto const                              train(
+        [&inputs](size_t numThreads) {
+            Estimator                       estimator(
+                NS::CreateTestAnnotationMapsPtr(1),
+                [](NS::AnnotationMapsPtr pAllColumnAnnotationsParam) {
+                    return ThisSumTrainingOnlyEstimator(std::move(pAllColumnAnnotationsParam), 0);
+                }
+            );
+
+            estimator.set_num_training_threads(numThreads);
+
+            // Train in multiple batches
+            estimator.begin_training();
+            estimator.fit(inputs.data(), 1234);
+            estimator.fit(inputs.data() + 1234, inputs.size() - 1234);
+            estimator.complete_training();
+
+            CHECK_THROWS_WITH(estimator.set_num_training_threads(1), "The number of training threads must be set before training begins");
+
+            std::map<std::string, std::uint64_t>                results;
+
+            for(auto const &kvp : Estimator::get_annotation(estimator.get_column_annotations(), 0, estimator.Name).Annotations)
+                results.emplace(kvp.first, ThisSumTrainingOnlyEstimator::get_annotation_data(*kvp.second).Value);
+
+            return results;
+        }
+    );
+
+    std::map<std::string, std::uint64_t> const                  expected(train(1));
+
+    CHECK(expected.size() == 100);
+    CHECK(train(2) == expected);
+    CHECK(train(4) == expected);
+    CHECK(train(0) == expected);
+}
+
+TEST_CASE("Transformer - multiple training threads") {
+    // ----------------------------------------------------------------------
+    using Estimator                         = Components::GrainEstimatorImpl<int, DeltaEstimator>;
+    // ----------------------------------------------------------------------
+
+    std::vector<int>                        grains;
+    std::vector<std::uint64_t>              values;
+    std::vector<Estimator::InputType>       inputs;
+
+    for(int index = 0; index < 1000; ++index) {
+        grains.emplace_back(index % 37);
+        values.emplace_back(static_cast<std::uint64_t>(index));
+    }
+
+    for(size_t index = 0; index < grains.size(); ++index)
+        inputs.emplace_back(grains[index], values[index]);
+
+    auto const                              getArchive(
+        [&inputs](size_t numThreads) {
+            Estimator                       estimator(NS::CreateTestAnnotationMapsPtr(1));
+
+            estimator.set_num_training_threads(numThreads);
+            Test(estimator, inputs, false);
+
+            NS::Archive                     out;
+
+            estimator.create_transformer()->save(out);
+            return out.commit();
+        }
+    );
+
+    CHECK(getArchive(3) == getArchive(1));
+}
+
 TEST_CASE("Estimator - no training items") {
     // ----------------------------------------------------------------------
     using Estimator                         = Components::GrainEstimatorImpl<std::string, DeltaEstimator>;
@@ -814,6 +903,414 @@ TEST_CASE("Transformer") {
     }
 }
 
+TEST_CASE("Transformer - grain ids") {
+    // ----------------------------------------------------------------------
+    using GrainTransformer                  = Components::GrainTransformer<std::string, DeltaEstimator>;
+    using GrainIdType                       = GrainTransformer::GrainIdType;
+    using TransformerMap                    = GrainTransformer::TransformerMap;
+    // ----------------------------------------------------------------------
+
+    std::string const                       grain1("one");
+    std::string const                       grain2("two");
+    std::string const                       grain3("three");
+
+    TransformerMap                          transformers;
+
+    transformers.emplace(grain1, GrainTransformer::GrainTransformerTypeUniquePtr(new DeltaTransformer(10)));
+    transformers.emplace(grain2, GrainTransformer::GrainTransformerTypeUniquePtr(new DeltaTransformer(20)));
+
+    SECTION("Known grains") {
+        GrainTransformer                    transformer(std::move(transformers));
+        GrainIdType const                   id1(transformer.get_grain_id(grain1));
+        GrainIdType const                   id2(transformer.get_grain_id(grain2));
+
+        CHECK(id1 != id2);
+        CHECK(transformer.get_grain_id(grain1) == id1);
+        CHECK_THROWS_WITH(transformer.get_grain_id(grain3), "Grain not found");
+
+        std::vector<GrainIdType> const      ids{ id2, id1, id1, id2 };
+        std::vector<std::uint64_t> const    inputs{ 1, 2, 3, 4 };
+        std::vector<std::string>            grains;
+        std::vector<std::uint64_t>          outputs;
+
+        transformer.execute(
+            ids.data(),
+            inputs.data(),
+            inputs.size(),
+            [&grains, &outputs](std::tuple<std::string const &, std::uint64_t> value) {
+                grains.emplace_back(std::get<0>(value));
+                outputs.emplace_back(std::get<1>(value));
+            }
+        );
+
+        CHECK(grains == std::vector<std::string>{ grain2, grain1, grain1, grain2 });
+        CHECK(outputs == std::vector<std::uint64_t>{ 21, 12, 13, 24 });
+
+        std::vector<GrainIdType> const      invalidIds{ 2 };
+
+        CHECK_THROWS_WITH(
+            transformer.execute(invalidIds.data(), inputs.data(), 1, [](std::tuple<std::string const &, std::uint64_t>) {}),
+            "Invalid grain id"
+        );
+    }
+
+    SECTION("New grains") {
+        GrainTransformer                    transformer(
+            std::move(transformers),
+            [](void) {
+                return GrainTransformer::GrainTransformerTypeUniquePtr(new DeltaTransformer(100));
+            }
+        );
+
+        GrainIdType const                   id3(transformer.get_grain_id(grain3));
+
+        CHECK(transformer.get_grain_id(grain3) == id3);
+
+        std::uint64_t const                 input(1);
+
+        transformer.execute(
+            &id3,
+            &input,
+            1,
+            [&grain3](std::tuple<std::string const &, std::uint64_t> value) {
+                CHECK(std::get<0>(value) == grain3);
+                CHECK(std::get<1>(value) == 101);
+            }
+        );
+
+        Execute(transformer, grain3, 2, 102);
+    }
+}
+
+TEST_CASE("Transformer - archive doesn't depend on grain order") {
+    // ----------------------------------------------------------------------
+    using Estimator                         = Components::GrainEstimatorImpl<int, DeltaEstimator>;
+    // ----------------------------------------------------------------------
+
+    auto const                              getArchive(
+        [](std::vector<int> const &grains) {
+            Estimator                       estimator(NS::CreateTestAnnotationMapsPtr(1));
+            std::uint64_t const             value(10);
+            std::vector<Estimator::InputType>           inputs;
+
+            for(int const &grain : grains)
+                inputs.emplace_back(grain, value);
+
+            Test(estimator, inputs, false);
+
+            NS::Archive                     out;
+
+            estimator.create_transformer()->save(out);
+            return out.commit();
+        }
+    );
+
+    CHECK(getArchive({ 1, 2, 3, 2 }) == getArchive({ 2, 3, 2, 1 }));
+}
+
+TEST_CASE("Transformer - lazy deserialization") {
+    // ----------------------------------------------------------------------
+    using GrainTransformer                  = Components::GrainTransformer<int, DeltaEstimator>;
+    using TransformerMap                    = GrainTransformer::TransformerMap;
+    // ----------------------------------------------------------------------
+
+    TransformerMap                          transformers;
+
+    for(int grain = 0; grain < 100; ++grain)
+        transformers.emplace(grain, GrainTransformer::GrainTransformerTypeUniquePtr(new DeltaTransformer(static_cast<std::uint64_t>(grain) * 10)));
+
+    NS::Archive                             out;
+
+    GrainTransformer(std::move(transformers)).save(out);
+
+    NS::Archive::ByteArray const            data(out.commit());
+
+    auto const                              execute(
+        [](GrainTransformer &transformer, int grain, std::uint64_t value) {
+            std::uint64_t                   result(0);
+
+            transformer.execute(
+                std::tuple<int const &, std::uint64_t const &>(grain, value),
+                [&result, &grain](std::tuple<int const &, std::uint64_t> output) {
+                    CHECK(std::get<0>(output) == grain);
+                    result = std::get<1>(output);
+                }
+            );
+
+            return result;
+        }
+    );
+
+    SECTION("Materialized on first use") {
+        NS::Archive                         in(data);
+        GrainTransformer                    transformer(in);
+
+        CHECK(in.AtEnd());
+        CHECK(transformer.num_materialized_transformers() == 0);
+
+        CHECK(execute(transformer, 5, 1) == 51);
+        CHECK(execute(transformer, 5, 2) == 52);
+        CHECK(execute(transformer, 99, 1) == 991);
+        CHECK(transformer.num_materialized_transformers() == 2);
+
+        // Transformers that haven't been materialized are saved from their serialized data
+        NS::Archive                         reserialized;
+
+        transformer.save(reserialized);
+        CHECK(reserialized.commit() == data);
+
+        // Flushing doesn't materialize the remaining Transformers
+        transformer.flush([](std::tuple<int const &, std::uint64_t>) {});
+
+        CHECK(transformer.num_materialized_transformers() == 2);
+    }
+
+    SECTION("Archive that doesn't own its buffer") {
+        std::unique_ptr<GrainTransformer>   pTransformer;
+
+        {
+            NS::Archive::ByteArray          buffer(data);
+            NS::Archive                     in(buffer.data(), buffer.size());
+
+            pTransformer.reset(new GrainTransformer(in));
+            CHECK(in.AtEnd());
+        }
+
+        // The serialized Transformers were copied before the buffer was destroyed
+        CHECK(execute(*pTransformer, 5, 1) == 51);
+        CHECK(execute(*pTransformer, 99, 1) == 991);
+    }
+
+    SECTION("Eviction") {
+        NS::Archive                         in(data);
+        GrainTransformer                    transformer(in);
+
+        // Each DeltaTransformer is serialized as a std::uint64_t
+        transformer.set_max_materialized_bytes(3 * sizeof(std::uint64_t));
+
+        for(int grain = 0; grain < 10; ++grain) {
+            CHECK(execute(transformer, grain, 1) == static_cast<std::uint64_t>(grain) * 10 + 1);
+            CHECK(transformer.num_materialized_transformers() <= 3);
+        }
+
+        // The most recently used Transformers are retained
+        CHECK(execute(transformer, 9, 2) == 92);
+        CHECK(execute(transformer, 7, 2) == 72);
+        CHECK(transformer.num_materialized_transformers() == 3);
+
+        CHECK(execute(transformer, 0, 2) == 2);
+        CHECK(transformer.num_materialized_transformers() == 3);
+
+        // Reducing the limit evicts Transformers immediately
+        transformer.set_max_materialized_bytes(0);
+        CHECK(transformer.num_materialized_transformers() == 0);
+
+        CHECK(execute(transformer, 42, 3) == 423);
+        CHECK(transformer.num_materialized_transformers() == 1);
+
+        // Removing the limit
+        transformer.set_max_materialized_bytes(std::numeric_limits<size_t>::max());
+
+        for(int grain = 0; grain < 10; ++grain)
+            execute(transformer, grain, 1);
+
+        CHECK(transformer.num_materialized_transformers() == 11);
+    }
+
+    SECTION("Original layout") {
+        NS::Archive                         original;
+
+        NS::Traits<std::uint64_t>::serialize(original, 2);
+
+        NS::Traits<int>::serialize(original, 1);
+        DeltaTransformer(10).save(original);
+
+        NS::Traits<int>::serialize(original, 2);
+        DeltaTransformer(20).save(original);
+
+        NS::Traits<bool>::serialize(original, false);
+
+        NS::Archive                         in(original.commit());
+        GrainTransformer                    transformer(in);
+
+        CHECK(transformer.num_materialized_transformers() == 2);
+        CHECK(execute(transformer, 1, 1) == 11);
+        CHECK(execute(transformer, 2, 1) == 21);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         SequenceTransformer
+///  \brief         Transformer whose output depends on the items that it
+///                 has previously transformed; it also produces an
+///                 additional output for even values.
+///
+class SequenceTransformer : public NS::Transformer<std::uint64_t, std::uint64_t> {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using BaseType                          = NS::Transformer<std::uint64_t, std::uint64_t>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    SequenceTransformer(std::uint64_t offset) :
+        _offset(std::move(offset)),
+        _cItems(0) {
+    }
+
+    ~SequenceTransformer(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(SequenceTransformer);
+
+    void save(Archive &) const override {
+        throw std::runtime_error("Not implemented");
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::uint64_t const                     _offset;
+    std::uint64_t                           _cItems;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+        callback(_offset + input * 1000 + _cItems++);
+
+        if(input % 2 == 0)
+            callback(0);
+    }
+
+    void flush_impl(typename BaseType::CallbackFunction const &) override {
+    }
+};
+
+TEST_CASE("Transformer - parallel execution") {
+    // ----------------------------------------------------------------------
+    using GrainTransformer                  = Components::GrainTransformer<int, DeltaEstimator>;
+    using TransformerMap                    = GrainTransformer::TransformerMap;
+    using InputType                         = GrainTransformer::InputType;
+    using Output                            = std::pair<int, std::uint64_t>;
+    using Outputs                           = std::vector<Output>;
+    // ----------------------------------------------------------------------
+
+    auto const                              createTransformer(
+        [](void) {
+            TransformerMap                  transformers;
+
+            for(int grain = 0; grain < 20; ++grain)
+                transformers.emplace(grain, GrainTransformer::GrainTransformerTypeUniquePtr(new SequenceTransformer(static_cast<std::uint64_t>(grain) * 1000000)));
+
+            return GrainTransformer(
+                std::move(transformers),
+                [](void) {
+                    return GrainTransformer::GrainTransformerTypeUniquePtr(new SequenceTransformer(999000000));
+                }
+            );
+        }
+    );
+
+    std::vector<int>                        grains;
+    std::vector<std::uint64_t>              values;
+
+    for(size_t index = 0; index < 500; ++index) {
+        // Grains >= 20 are created by `createFunc`
+        grains.emplace_back(static_cast<int>((index * 7) % 23));
+        values.emplace_back(index);
+    }
+
+    std::vector<InputType>                  inputs;
+
+    for(size_t index = 0; index < grains.size(); ++index)
+        inputs.emplace_back(grains[index], values[index]);
+
+    // Expected output is produced by single-threaded execution
+    Outputs                                 expected;
+
+    {
+        GrainTransformer                    transformer(createTransformer());
+
+        for(auto const &input : inputs) {
+            transformer.execute(
+                input,
+                [&expected](std::tuple<int const &, std::uint64_t> output) {
+                    expected.emplace_back(std::get<0>(output), std::get<1>(output));
+                }
+            );
+        }
+    }
+
+    for(size_t numThreads : { 1, 4 }) {
+        Components::ThreadPool              pool(numThreads);
+
+        SECTION("Input order (" + std::to_string(numThreads) + ")") {
+            GrainTransformer                transformer(createTransformer());
+            Outputs                         outputs;
+
+            // Transform in multiple batches to ensure that state is maintained across batches
+            for(size_t offset = 0; offset < inputs.size(); offset += 100) {
+                transformer.execute_parallel(
+                    pool,
+                    inputs.data() + offset,
+                    std::min(static_cast<size_t>(100), inputs.size() - offset),
+                    [&outputs](std::tuple<int const &, std::uint64_t> output) {
+                        outputs.emplace_back(std::get<0>(output), std::get<1>(output));
+                    }
+                );
+            }
+
+            CHECK(outputs == expected);
+        }
+
+        SECTION("Grain order (" + std::to_string(numThreads) + ")") {
+            GrainTransformer                transformer(createTransformer());
+            Outputs                         outputs;
+
+            transformer.execute_parallel(
+                pool,
+                inputs.data(),
+                inputs.size(),
+                [&outputs](std::tuple<int const &, std::uint64_t> output) {
+                    outputs.emplace_back(std::get<0>(output), std::get<1>(output));
+                },
+                Components::GrainOutputOrder::Grain
+            );
+
+            Outputs                         sortedExpected(expected);
+
+            std::stable_sort(
+                sortedExpected.begin(),
+                sortedExpected.end(),
+                [](Output const &a, Output const &b) {
+                    return a.first < b.first;
+                }
+            );
+
+            CHECK(outputs == sortedExpected);
+        }
+    }
+
+    SECTION("Errors") {
+        GrainTransformer                    transformer(createTransformer());
+        Components::ThreadPool              pool(2);
+
+        CHECK_THROWS_WITH(transformer.execute_parallel(pool, nullptr, 1, [](std::tuple<int const &, std::uint64_t>) {}), "pItems");
+        CHECK_THROWS_WITH(transformer.execute_parallel(pool, inputs.data(), 0, [](std::tuple<int const &, std::uint64_t>) {}), "cItems");
+    }
+}
+
 TEST_CASE("GrainTransformer - deserialization errors") {
     // ----------------------------------------------------------------------
     using GrainTransformer                  = Components::GrainTransformer<int, DeltaEstimator>;
@@ -854,6 +1351,29 @@ TEST_CASE("GrainTransformer - deserialization errors") {
             "Invalid insertion"
         );
     }
+
+    SECTION("Invalid offset") {
+        NS::Archive                         outArchive;
+
+        NS::Traits<std::uint64_t>::serialize(outArchive, std::numeric_limits<std::uint64_t>::max());
+        NS::Traits<std::uint64_t>::serialize(outArchive, 2);
+
+        NS::Traits<int>::serialize(outArchive, 1);
+        NS::Traits<std::uint64_t>::serialize(outArchive, 0);
+
+        NS::Traits<int>::serialize(outArchive, 2);
+        NS::Traits<std::uint64_t>::serialize(outArchive, 16);
+
+        NS::Traits<std::uint64_t>::serialize(outArchive, 8);
+        DeltaTransformer(10).save(outArchive);
+
+        NS::Archive                         inArchive(outArchive.commit());
+
+        CHECK_THROWS_WITH(
+            GrainTransformer(inArchive),
+            "Invalid offset"
+        );
+    }
 }
 
 TEST_CASE("GrainEstimatorAnnotation - construct errors") {
@@ -0,0 +1,123 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../GrainIndex.h"
+
+namespace NS = Microsoft::Featurizer;
+
+template <typename GrainT>
+using GrainIndex                            = NS::Featurizers::Components::GrainIndex<GrainT>;
+
+static std::uint32_t const                  InvalidId = GrainIndex<int>::InvalidId;
+
+template <typename GrainT>
+void Test(std::vector<GrainT> const &grains) {
+    GrainIndex<GrainT>                      index;
+    std::map<GrainT, std::uint32_t>         expected;
+
+    CHECK(index.empty());
+
+    for(auto const &grain : grains) {
+        std::pair<std::uint32_t, bool> const                result(index.insert(grain));
+        auto const                                          iter(expected.find(grain));
+
+        if(iter == expected.end()) {
+            CHECK(result.second);
+            CHECK(result.first == expected.size());
+            expected.emplace(grain, result.first);
+        }
+        else {
+            CHECK(result.second == false);
+            CHECK(result.first == iter->second);
+        }
+    }
+
+    CHECK(index.size() == expected.size());
+    CHECK(index.empty() == expected.empty());
+
+    for(auto const &kvp : expected) {
+        CHECK(index.find(kvp.first) == kvp.second);
+        CHECK(index[kvp.second] == kvp.first);
+    }
+
+    // Ids are sorted by grain
+    std::vector<std::uint32_t>              sortedIds;
+
+    for(auto const &kvp : expected)
+        sortedIds.emplace_back(kvp.second);
+
+    CHECK(index.sorted_ids() == sortedIds);
+
+    // Copies are independent
+    GrainIndex<GrainT>                      other(index);
+
+    CHECK(other.size() == index.size());
+
+    for(auto const &kvp : expected)
+        CHECK(other.find(kvp.first) == kvp.second);
+}
+
+TEST_CASE("int") {
+    Test(std::vector<int>());
+    Test(std::vector<int>{ 3, 1, 2, 1, 3 });
+
+    std::vector<int>                        grains;
+
+    // Values that map to the same slot when they aren't mixed
+    for(int value = 0; value < 10000; ++value)
+        grains.emplace_back(value * 1024);
+
+    Test(grains);
+}
+
+TEST_CASE("string") {
+    Test(std::vector<std::string>{ "one", "two", "three", "two", "", "one" });
+
+    std::vector<std::string>                grains;
+
+    for(int value = 0; value < 5000; ++value)
+        grains.emplace_back("grain" + std::to_string(value % 3000));
+
+    Test(grains);
+}
+
+TEST_CASE("vector<string>") {
+    Test(
+        std::vector<std::vector<std::string>>{
+            { "a", "b" },
+            { "a" },
+            { "b", "a" },
+            { "a", "b" },
+            {}
+        }
+    );
+}
+
+TEST_CASE("Not found") {
+    GrainIndex<std::string>                 index;
+
+    CHECK(index.find("foo") == InvalidId);
+
+    index.insert("foo");
+
+    CHECK(index.find("foo") == 0);
+    CHECK(index.find("bar") == InvalidId);
+}
+
+TEST_CASE("Stable references") {
+    GrainIndex<std::string>                 index;
+
+    index.insert("first");
+
+    std::string const &                     first(index[0]);
+
+    for(int value = 0; value < 1000; ++value)
+        index.insert(std::to_string(value));
+
+    CHECK(&first == &index[0]);
+    CHECK(first == "first");
+}
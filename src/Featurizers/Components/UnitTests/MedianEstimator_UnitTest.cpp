@@ -73,3 +73,47 @@ TEST_CASE("No valid elements during training") {
         "No elements were provided during training"
     );
 }
+
+template <bool InterpolateValuesV, typename InputT, typename TransformedT=InputT>
+TransformedT GetSketchMedian(std::vector<InputT> inputs, float rankError) {
+    // ----------------------------------------------------------------------
+    using MedianEstimator                   = NS::Featurizers::Components::MedianEstimator<InputT, TransformedT, InterpolateValuesV>;
+    // ----------------------------------------------------------------------
+
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+    MedianEstimator                         estimator(pAllColumnAnnotations, 0, true, rankError);
+    std::vector<std::vector<InputT>>        inputBatches{std::move(inputs)};
+
+    NS::TestHelpers::Train(estimator, inputBatches);
+
+    return estimator.get_annotation_data().Median;
+}
+
+TEST_CASE("sketch - small inputs are exact") {
+    CHECK(GetSketchMedian<true, int, double>({5, 1, 4, 2, 3}, 0.01f) == 3.0);
+    CHECK(GetSketchMedian<true, int, double>({1, 2, 3, 4}, 0.01f) == 2.5);
+    CHECK(GetSketchMedian<false, int>({1, 2, 3, 4}, 0.01f) == 2);
+    CHECK(GetSketchMedian<true, nonstd::optional<int>, double>({1, 2, nonstd::optional<int>(), 3, 4, 5}, 0.01f) == 3.0);
+    CHECK(GetSketchMedian<false, std::string>({"1", "2", "3", "4", "5"}, 0.01f) == "3");
+    CHECK(GetSketchMedian<false, std::string>({"1", "2", "3", "4"}, 0.01f) == "2");
+}
+
+TEST_CASE("sketch - large inputs") {
+    std::vector<int>                        inputs;
+
+    // A permutation of [0, 100001); the exact median is 50000
+    for(int index = 0; index < 100001; ++index)
+        inputs.emplace_back(static_cast<int>((static_cast<long long>(index) * 7919) % 100001));
+
+    double const                            median(GetSketchMedian<true, int, double>(inputs, 0.01f));
+
+    CHECK(std::abs(median - 50000.0) <= 0.01 * 100001);
+}
+
+TEST_CASE("sketch - errors") {
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+
+    CHECK_THROWS_WITH((NS::Featurizers::Components::MedianEstimator<int>(pAllColumnAnnotations, 0, true, 0.0f)), "rankError");
+    CHECK_THROWS_WITH((NS::Featurizers::Components::MedianEstimator<int>(pAllColumnAnnotations, 0, true, 1.0f)), "rankError");
+    CHECK_THROWS_WITH((GetSketchMedian<true, nonstd::optional<int>, double>({nonstd::optional<int>()}, 0.01f)), "No elements were provided during training");
+}
@@ -0,0 +1,171 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../QuantileSketch.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using Sketch                                = NS::Featurizers::Components::QuantileSketch<std::int64_t>;
+
+/// Returns a permutation of [0, count) in a deterministic order.
+std::vector<std::int64_t> GetValues(std::int64_t count) {
+    std::vector<std::int64_t>               result;
+
+    result.reserve(static_cast<size_t>(count));
+
+    // 7919 is prime, so it is relatively prime to every count used in these tests
+    for(std::int64_t index = 0; index < count; ++index)
+        result.emplace_back((index * 7919) % count);
+
+    return result;
+}
+
+/// Checks that the rank of the value at each quantile is within `maxError` of the
+/// expected rank (values are a permutation of [0, n), so a value is its own rank).
+void CheckRankError(Sketch const &sketch, double maxError) {
+    double const                            n(static_cast<double>(sketch.size()));
+
+    for(double fraction : { 0.0, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 1.0 }) {
+        INFO(fraction);
+
+        double const                        expected(fraction * (n - 1));
+        double const                        actual(static_cast<double>(sketch.get_quantile(fraction)));
+
+        CHECK(std::abs(actual - expected) / n <= maxError);
+    }
+}
+
+TEST_CASE("CalculateK") {
+    std::uint16_t const                     minK(Sketch::MinK);
+
+    CHECK(Sketch::CalculateK(0.5) == minK);
+    CHECK(Sketch::CalculateK(0.0133) > 150);
+    CHECK(Sketch::CalculateK(0.0133) < 250);
+    CHECK(Sketch::CalculateK(0.001) > Sketch::CalculateK(0.01));
+
+    CHECK_THROWS_WITH(Sketch::CalculateK(0.0), "rankError");
+    CHECK_THROWS_WITH(Sketch::CalculateK(1.0), "rankError");
+    CHECK_THROWS_WITH(Sketch::CalculateK(1e-9), "rankError");
+}
+
+TEST_CASE("Exact when small") {
+    Sketch                                  sketch(32);
+
+    CHECK(sketch.empty());
+    CHECK_THROWS_WITH(sketch.get_quantile(0.5), "The sketch is empty");
+
+    for(auto value : GetValues(32))
+        sketch.update(value);
+
+    CHECK(sketch.size() == 32);
+    CHECK(sketch.num_retained() == 32);
+
+    for(std::int64_t rank = 0; rank < 32; ++rank)
+        CHECK(sketch.get_item(static_cast<std::uint64_t>(rank)) == rank);
+
+    CHECK_THROWS_WITH(sketch.get_item(32), "rank");
+    CHECK_THROWS_WITH(sketch.get_quantile(1.5), "fraction");
+}
+
+TEST_CASE("Bounded memory") {
+    Sketch                                  sketch(Sketch::CalculateK(0.01));
+
+    for(auto value : GetValues(1000000))
+        sketch.update(value);
+
+    CHECK(sketch.size() == 1000000);
+    CHECK(sketch.num_retained() < 4 * static_cast<size_t>(sketch.k()));
+
+    CheckRankError(sketch, 0.01);
+}
+
+TEST_CASE("Merge") {
+    std::vector<std::int64_t> const         values(GetValues(300000));
+
+    // Shards of different sizes
+    Sketch                                  shard1(200);
+    Sketch                                  shard2(200);
+    Sketch                                  shard3(200);
+
+    for(size_t index = 0; index < values.size(); ++index) {
+        if(index < 10)
+            shard1.update(values[index]);
+        else if(index < 100000)
+            shard2.update(values[index]);
+        else
+            shard3.update(values[index]);
+    }
+
+    Sketch                                  merged(200);
+
+    merged.merge(shard1);
+    merged.merge(shard2);
+    merged.merge(shard3);
+
+    CHECK(merged.size() == values.size());
+    CHECK(merged.num_retained() < 4 * 200);
+    CheckRankError(merged, 0.02);
+
+    // Merging with itself doubles the weight of every value, so the quantiles
+    // don't change
+    merged.merge(merged);
+    CHECK(merged.size() == 2 * values.size());
+    CHECK(std::abs(static_cast<double>(merged.get_quantile(0.5)) - 150000.0) / 300000.0 <= 0.02);
+
+    CHECK_THROWS_WITH(merged.merge(Sketch(100)), "other");
+}
+
+TEST_CASE("Strings") {
+    NS::Featurizers::Components::QuantileSketch<std::string>    sketch(8);
+
+    for(char c = 'a'; c <= 'z'; ++c)
+        sketch.update(std::string(1, c));
+
+    CHECK(sketch.size() == 26);
+    CHECK(sketch.get_quantile(0.0) == "a");
+    CHECK(sketch.get_quantile(1.0) == "z");
+}
+
+TEST_CASE("Serialization") {
+    Sketch                                  sketch(50);
+
+    for(auto value : GetValues(10000))
+        sketch.update(value);
+
+    NS::Archive                             out;
+
+    sketch.save(out);
+
+    NS::Archive                             in(out.commit());
+    Sketch                                  other(in);
+
+    CHECK(in.AtEnd());
+    CHECK(other == sketch);
+    CHECK(other.get_quantile(0.5) == sketch.get_quantile(0.5));
+
+    // Deserialized sketches continue to work
+    other.update(5);
+    CHECK(other.size() == sketch.size() + 1);
+}
+
+TEST_CASE("Serialization errors") {
+    CHECK_THROWS_WITH(Sketch(4), "k");
+
+    // The weights don't account for every value
+    NS::Archive                             out;
+
+    NS::Traits<std::uint16_t>::serialize(out, 1);
+    NS::Traits<std::uint16_t>::serialize(out, 0);
+    NS::Traits<std::uint16_t>::serialize(out, 8);
+    NS::Traits<std::uint64_t>::serialize(out, 3);
+    NS::Traits<std::uint64_t>::serialize(out, 1);
+    NS::Traits<std::vector<std::vector<std::int64_t>>>::serialize(out, std::vector<std::vector<std::int64_t>>{ { 1, 2 } });
+
+    NS::Archive                             in(out.commit());
+
+    CHECK_THROWS_WITH(Sketch(in), "Invalid sketch data");
+}
@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../ThreadPool.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using ThreadPool                            = NS::Featurizers::Components::ThreadPool;
+
+void Test(ThreadPool &pool, size_t cTasks) {
+    std::vector<std::atomic<int>>           counts(cTasks);
+
+    for(auto &count : counts)
+        count = 0;
+
+    std::atomic<size_t>                     invalidWorkers(0);
+
+    pool.run(
+        cTasks,
+        [&pool, &counts, &invalidWorkers](size_t workerIndex, size_t taskIndex) {
+            if(workerIndex >= pool.size())
+                ++invalidWorkers;
+
+            ++counts[taskIndex];
+        }
+    );
+
+    CHECK(invalidWorkers == 0);
+
+    // Every task is executed exactly once
+    for(auto const &count : counts)
+        CHECK(count == 1);
+}
+
+TEST_CASE("Standard") {
+    for(size_t numThreads : { 1, 2, 3, 8 }) {
+        ThreadPool                          pool(numThreads);
+
+        CHECK(pool.size() == numThreads);
+
+        // Batches are executed repeatedly on the same threads
+        for(size_t cTasks : { 0, 1, 2, 7, 100, 1000 })
+            Test(pool, cTasks);
+    }
+}
+
+TEST_CASE("Hardware threads") {
+    ThreadPool                              pool(0);
+
+    CHECK(pool.size() >= 1);
+    Test(pool, 100);
+}
+
+TEST_CASE("Uneven tasks") {
+    // A single expensive task shouldn't prevent the remaining tasks from completing
+    ThreadPool                              pool(4);
+    std::atomic<size_t>                     total(0);
+
+    pool.run(
+        64,
+        [&total](size_t, size_t taskIndex) {
+            if(taskIndex == 0)
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+            total += taskIndex;
+        }
+    );
+
+    CHECK(total == 64 * 63 / 2);
+}
+
+TEST_CASE("Exceptions") {
+    ThreadPool                              pool(4);
+
+    CHECK_THROWS_WITH(
+        pool.run(
+            100,
+            [](size_t, size_t taskIndex) {
+                if(taskIndex == 42)
+                    throw std::runtime_error("Task failed");
+            }
+        ),
+        "Task failed"
+    );
+
+    // The pool remains usable
+    Test(pool, 100);
+
+    CHECK_THROWS_WITH(pool.run(10, ThreadPool::TaskFunc()), "func");
+}
@@ -0,0 +1,283 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include "../TimeSeriesImputerEngine.h"
+
+namespace NS = Microsoft::Featurizer;
+
+using Strategy                              = NS::Featurizers::Components::TimeSeriesImputeStrategy;
+using ValidityBitmap                        = NS::Featurizers::Components::ValidityBitmap;
+using Engine                                = NS::Featurizers::Components::TimeSeriesImputerEngine<double>;
+using RowBuffer                             = Engine::RowBuffer;
+using TimePoint                             = Engine::TimePointType;
+
+static TimePoint const                      Start(std::chrono::hours(24 * 365));
+
+TimePoint Day(int day) {
+    return Start + std::chrono::hours(24 * day);
+}
+
+/// A row where an empty optional represents a null value
+struct Row {
+    bool                                    Added;
+    TimePoint                               Time;
+    std::string                             Grain;
+    std::vector<nonstd::optional<double>>   Values;
+
+    bool operator==(Row const &other) const {
+        return Added == other.Added && Time == other.Time && Grain == other.Grain && Values == other.Values;
+    }
+};
+
+std::vector<Row> ToRows(Engine const &engine, RowBuffer const &buffer) {
+    std::vector<Row>                        result;
+
+    for(size_t row = 0; row < buffer.size(); ++row) {
+        std::vector<nonstd::optional<double>>   values;
+
+        for(size_t column = 0; column < buffer.num_columns(); ++column) {
+            if(buffer.Valid[column][row])
+                values.emplace_back(buffer.Values[column][row]);
+            else
+                values.emplace_back();
+        }
+
+        result.emplace_back(Row{ buffer.Added[row], buffer.TimePoints[row], engine.get_grain(buffer.GrainIds[row])[0], std::move(values) });
+    }
+
+    return result;
+}
+
+/// Executes the rows (without the `Added` flag) as a single batch and then flushes
+/// the engine.
+std::vector<Row> Test(Engine &engine, std::vector<Row> const &rows) {
+    RowBuffer                               input(engine.num_columns());
+    RowBuffer                               output(engine.num_columns());
+
+    for(auto const &row : rows) {
+        input.push_back(row.Time, engine.get_grain_id({row.Grain}), false);
+
+        for(size_t column = 0; column < row.Values.size(); ++column) {
+            if(row.Values[column].has_value() == false)
+                continue;
+
+            input.Values[column].back() = *row.Values[column];
+            input.Valid[column].set(input.size() - 1);
+        }
+    }
+
+    engine.execute(input, output);
+    engine.flush(output);
+
+    return ToRows(engine, output);
+}
+
+nonstd::optional<double> const              Null;
+
+TEST_CASE("ValidityBitmap") {
+    ValidityBitmap                          bitmap;
+
+    for(size_t index = 0; index < 200; ++index)
+        bitmap.push_back(index % 3 == 0);
+
+    CHECK(bitmap.size() == 200);
+    CHECK(bitmap[0]);
+    CHECK(bitmap[1] == false);
+    CHECK(bitmap[198]);
+
+    bitmap.set(1);
+    bitmap.set(198, false);
+    CHECK(bitmap[1]);
+    CHECK(bitmap[198] == false);
+
+    // Unaligned erase
+    bitmap.erase_front(5);
+    CHECK(bitmap.size() == 195);
+
+    for(size_t index = 0; index < bitmap.size(); ++index) {
+        INFO(index);
+        CHECK(bitmap[index] == ((index + 5) % 3 == 0 && index + 5 != 198));
+    }
+
+    // Aligned erase
+    bitmap.erase_front(128);
+    CHECK(bitmap.size() == 67);
+
+    for(size_t index = 0; index < bitmap.size(); ++index) {
+        INFO(index);
+        CHECK(bitmap[index] == ((index + 133) % 3 == 0 && index + 133 != 198));
+    }
+
+    // Bits appended after an erase are initialized correctly
+    bitmap.erase_front(66);
+    bitmap.push_back(false);
+    bitmap.push_back(true);
+    CHECK(bitmap.size() == 3);
+    CHECK(bitmap[1] == false);
+    CHECK(bitmap[2]);
+
+    bitmap.clear();
+    CHECK(bitmap.size() == 0);
+}
+
+TEST_CASE("Forward") {
+    Engine                                  engine(std::chrono::hours(24), Strategy::Forward, { true, false }, Engine::MedianMap(), false);
+
+    CHECK(
+        Test(
+            engine,
+            {
+                Row{ false, Day(0), "a", { 1.0, Null } },
+                Row{ false, Day(0), "b", { Null, 10.0 } },
+                Row{ false, Day(3), "a", { Null, 2.0 } },
+                Row{ false, Day(1), "b", { 20.0, Null } }
+            }
+        ) == std::vector<Row>{
+            Row{ false, Day(0), "a", { 1.0, Null } },
+            Row{ false, Day(0), "b", { Null, 10.0 } },
+            Row{ true, Day(1), "a", { 1.0, Null } },
+            Row{ true, Day(2), "a", { 1.0, Null } },
+            Row{ false, Day(3), "a", { 1.0, 2.0 } },
+            Row{ false, Day(1), "b", { 20.0, 10.0 } }
+        }
+    );
+
+    // Flushing resets the state
+    CHECK(
+        Test(engine, { Row{ false, Day(0), "a", { Null, Null } } })
+        == std::vector<Row>{ Row{ false, Day(0), "a", { Null, Null } } }
+    );
+}
+
+TEST_CASE("Backward") {
+    Engine                                  engine(std::chrono::hours(24), Strategy::Backward, { true, false }, Engine::MedianMap(), false);
+
+    RowBuffer                               input(2);
+    RowBuffer                               output(2);
+    Engine::GrainIdType const               id(engine.get_grain_id({"a"}));
+
+    // Rows are held until all of their nulls have been resolved
+    input.push_back(Day(0), id, false);
+    input.Values[1][0] = 5.0;
+    input.Valid[1].set(0);
+
+    engine.execute(input, output);
+    CHECK(output.size() == 0);
+
+    input.clear();
+    input.push_back(Day(2), id, false);
+    input.Values[0][0] = 3.0;
+    input.Valid[0].set(0);
+
+    engine.execute(input, output);
+    CHECK(
+        ToRows(engine, output) == std::vector<Row>{
+            Row{ false, Day(0), "a", { 3.0, 5.0 } }
+        }
+    );
+
+    engine.flush(output);
+    CHECK(
+        ToRows(engine, output) == std::vector<Row>{
+            Row{ false, Day(0), "a", { 3.0, 5.0 } },
+            Row{ true, Day(1), "a", { 3.0, Null } },
+            Row{ false, Day(2), "a", { 3.0, Null } }
+        }
+    );
+}
+
+TEST_CASE("Backward - multiple grains") {
+    Engine                                  engine(std::chrono::hours(24), Strategy::Backward, { true, true }, Engine::MedianMap(), false);
+
+    // Pending rows are flushed in grain order
+    CHECK(
+        Test(
+            engine,
+            {
+                Row{ false, Day(0), "b", { Null, 1.0 } },
+                Row{ false, Day(0), "a", { 1.0, Null } },
+                Row{ false, Day(1), "b", { 2.0, Null } },
+                Row{ false, Day(2), "a", { Null, 4.0 } },
+                Row{ false, Day(3), "a", { 5.0, Null } }
+            }
+        ) == std::vector<Row>{
+            Row{ false, Day(0), "b", { 2.0, 1.0 } },
+            Row{ false, Day(0), "a", { 1.0, 4.0 } },
+            Row{ true, Day(1), "a", { 5.0, 4.0 } },
+            Row{ false, Day(2), "a", { 5.0, 4.0 } },
+            Row{ false, Day(3), "a", { 5.0, Null } },
+            Row{ false, Day(1), "b", { 2.0, Null } }
+        }
+    );
+}
+
+TEST_CASE("Median") {
+    Engine                                  engine(
+        std::chrono::hours(24),
+        Strategy::Median,
+        { true, false },
+        Engine::MedianMap{ { {"a"}, { 1.5, 0.0 } } },
+        false
+    );
+
+    CHECK(
+        Test(
+            engine,
+            {
+                Row{ false, Day(0), "a", { Null, Null } },
+                Row{ false, Day(2), "a", { 3.0, 4.0 } }
+            }
+        ) == std::vector<Row>{
+            Row{ false, Day(0), "a", { 1.5, Null } },
+            Row{ true, Day(1), "a", { 1.5, Null } },
+            Row{ false, Day(2), "a", { 3.0, 4.0 } }
+        }
+    );
+
+    // Grains without median values
+    CHECK(Test(engine, { Row{ false, Day(0), "b", { 1.0, Null } } }).size() == 1);
+    CHECK_THROWS_WITH(Test(engine, { Row{ false, Day(0), "b", { Null, 1.0 } } }), "Invalid key");
+
+    Engine                                  suppressed(
+        std::chrono::hours(24),
+        Strategy::Median,
+        { true, false },
+        Engine::MedianMap{ { {"a"}, { 1.5, 0.0 } } },
+        true
+    );
+
+    CHECK(
+        Test(suppressed, { Row{ false, Day(0), "b", { Null, 1.0 } } })
+        == std::vector<Row>{ Row{ false, Day(0), "b", { Null, 1.0 } } }
+    );
+}
+
+TEST_CASE("Errors") {
+    CHECK_THROWS_WITH(Engine(std::chrono::hours(24), static_cast<Strategy>(0), { true }, Engine::MedianMap(), false), "strategy");
+    CHECK_THROWS_WITH(Engine(std::chrono::hours(24), Strategy::Forward, {}, Engine::MedianMap(), false), "medianColumns");
+    CHECK_THROWS_WITH(Engine(std::chrono::hours(24), Strategy::Median, { true }, Engine::MedianMap{ { {"a"}, { 1.0, 2.0 } } }, false), "medians");
+
+    Engine                                  engine(std::chrono::hours(24), Strategy::Forward, { true }, Engine::MedianMap(), false);
+    RowBuffer                               output(1);
+
+    CHECK_THROWS_WITH(Test(engine, { Row{ false, Day(1), "a", { Null } }, Row{ false, Day(0), "a", { Null } } }), "Input stream not in chronological order.");
+    CHECK_THROWS_WITH(engine.get_grain(100), "Invalid grain id");
+
+    RowBuffer                               wrongColumns(2);
+
+    CHECK_THROWS_WITH(engine.execute(wrongColumns, output), "input");
+    CHECK_THROWS_WITH(engine.flush(wrongColumns), "output");
+
+    RowBuffer                               invalidGrain(1);
+
+    invalidGrain.push_back(Day(0), 100, false);
+    CHECK_THROWS_WITH(engine.execute(invalidGrain, output), "Invalid grain id");
+
+    Engine                                  interpolate(std::chrono::hours(24), Strategy::Interpolate, { true }, Engine::MedianMap(), false);
+
+    CHECK_THROWS_WITH(Test(interpolate, { Row{ false, Day(0), "a", { 1.0 } } }), "Unsupported Impute Strategy");
+}
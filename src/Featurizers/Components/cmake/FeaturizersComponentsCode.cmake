@@ -10,13 +10,18 @@ function(Impl)
 
     include(${_this_path}/../../../3rdParty/cmake/Featurizer3rdParty.cmake)
 
+    find_package(Threads REQUIRED)
+
     add_library(FeaturizersComponentsCode STATIC
         ${_this_path}/../Components.h
         ${_this_path}/../DocumentStatisticsEstimator.h
         ${_this_path}/../DocumentStatisticsEstimator.cpp
+        ${_this_path}/../DocumentTokenizer.h
         ${_this_path}/../FilterFeaturizerImpl.h
         ${_this_path}/../FilterDecoratorFeaturizer.h
+        ${_this_path}/../FrozenIndexMap.h
         ${_this_path}/../GrainFeaturizerImpl.h
+        ${_this_path}/../GrainIndex.h
         ${_this_path}/../HistogramEstimator.h
         ${_this_path}/../ImputerTransformer.h
         ${_this_path}/../IndexMapEstimator.h
@@ -28,9 +33,12 @@ function(Impl)
         ${_this_path}/../NormUpdaters.h
         ${_this_path}/../OrderEstimator.h
         ${_this_path}/../PipelineExecutionEstimatorImpl.h
+        ${_this_path}/../QuantileSketch.h
         ${_this_path}/../StandardDeviationEstimator.h
         ${_this_path}/../StatisticalMetricsEstimator.h
+        ${_this_path}/../ThreadPool.h
         ${_this_path}/../TimeSeriesFrequencyEstimator.h
+        ${_this_path}/../TimeSeriesImputerEngine.h
         ${_this_path}/../TimeSeriesImputerTransformer.h
         ${_this_path}/../TimeSeriesMedianEstimator.h
         ${_this_path}/../TrainingOnlyEstimatorImpl.h
@@ -49,6 +57,7 @@ function(Impl)
     target_link_libraries(
         FeaturizersComponentsCode PUBLIC
         Featurizer3rdParty
+        Threads::Threads
     )
 endfunction()
 
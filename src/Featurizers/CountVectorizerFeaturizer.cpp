@@ -37,6 +37,17 @@ void CountVectorizerTransformer::save(Archive &ar) const {
     _pTfidfTransformer->save(ar);
 }
 
+size_t CountVectorizerTransformer::execute_into(char const *pInput, size_t cInput, std::uint64_t &numElements, std::uint32_t *pValues, std::uint64_t *pIndexes, size_t cValues) {
+    // The transformer is a `TfidfVectorizerTransformer` when deserialized and a pipeline
+    // when created by the estimator
+    TfidfVectorizerTransformer *            pTransformer(dynamic_cast<TfidfVectorizerTransformer *>(_pTfidfTransformer.get()));
+
+    if(pTransformer)
+        return pTransformer->execute_into(pInput, cInput, numElements, pValues, pIndexes, cValues);
+
+    return static_cast<TfidfEstimator::TransformerType &>(*_pTfidfTransformer).execute_into(pInput, cInput, numElements, pValues, pIndexes, cValues);
+}
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -44,6 +44,10 @@ public:
 
     bool operator==(CountVectorizerTransformer const &other) const;
 
+    /// Writes the counts and indexes of the result to the caller's buffers
+    /// (see `TfidfVectorizerTransformer::execute_into`).
+    size_t execute_into(char const *pInput, size_t cInput, std::uint64_t &numElements, std::uint32_t *pValues, std::uint64_t *pIndexes, size_t cValues);
+
 private:
     // ----------------------------------------------------------------------
     // |
@@ -3,6 +3,8 @@
 // Licensed under the MIT License
 // ----------------------------------------------------------------------
 #include "DateTimeFeaturizer.h"
+#include "../MappedFile.h"
+
 #ifdef _WIN32
     #include <direct.h>
     #include <Windows.h>
@@ -15,6 +17,9 @@
 #   include <unistd.h>
 #endif
 
+#include <mutex>
+#include <unordered_map>
+
 #ifdef _MSC_VER
 inline struct tm *gmtime_r(time_t const* const timer, struct tm* const  result) {
     return gmtime_s(result, timer) == 0 ? result : nullptr;
@@ -105,6 +110,8 @@ bool EnumCountries(
     return result;
 }
 
+static char const * const                   BinaryDataDirectory = "Binary\\";
+
 #else
 
 bool IsValidDirectory(std::string const &dirname) {
@@ -192,6 +199,8 @@ bool EnumCountries(
     return result;
 }
 
+static char const * const                   BinaryDataDirectory = "Binary/";
+
 #endif
 
 // ----------------------------------------------------------------------
@@ -244,13 +253,148 @@ bool DoesCountryMatch(std::string const &country, std::string query) {
     return false;
 }
 
+static constexpr std::int64_t const         SecondsPerDay = 60 * 60 * 24;
+
+// Binary holiday table format; see `DateTimeFeaturizerData/Tools/BinaryGenerator.py`
+static char const                           HolidayTableMagic[8] = { 'H', 'O', 'L', 'I', 'D', 'A', 'Y', 'S' };
+static constexpr std::uint32_t const        HolidayTableVersion = 1;
+static constexpr size_t const               HolidayTableHeaderSize = sizeof(HolidayTableMagic) + sizeof(std::uint32_t) * 4;
+
+inline size_t GetHolidayTableNameOffsetsPosition(size_t numDates) {
+    size_t const                            position(HolidayTableHeaderSize + numDates * (sizeof(std::int32_t) + sizeof(std::uint16_t)));
+
+    // Name offsets are aligned on a 4-byte boundary
+    return (position + 3) & ~static_cast<size_t>(3);
+}
+
+inline std::uint32_t ReadHolidayTableHeaderValue(unsigned char const *pData, size_t index) {
+    std::uint32_t                           result;
+
+    std::memcpy(&result, pData + sizeof(HolidayTableMagic) + index * sizeof(std::uint32_t), sizeof(result));
+    return result;
+}
+
+/// Floor division for positive divisors without any branches.
+inline std::int64_t FloorDiv(std::int64_t value, std::int64_t divisor) {
+    return value / divisor - static_cast<std::int64_t>(value % divisor < 0);
+}
+
+struct CivilDate {
+    std::int64_t                            year;
+    std::int64_t                            month;          // 1 through 12
+    std::int64_t                            day;            // 1 through 31
+    std::int64_t                            dayOfYear;      // 0 through 365
+    std::int64_t                            isLeapYear;     // 0 or 1
+};
+
+/// Converts days since the Unix epoch to a proleptic Gregorian date. This is
+/// the `civil_from_days` algorithm described at
+/// http://howardhinnant.github.io/date_algorithms.html, written with arithmetic
+/// selects rather than conditionals.
+inline CivilDate CivilFromDays(std::int64_t days) {
+    std::int64_t const                      z(days + 719468);
+    std::int64_t const                      era(FloorDiv(z, 146097));
+    std::int64_t const                      dayOfEra(z - era * 146097);                                                         // [0, 146096]
+    std::int64_t const                      yearOfEra((dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365);  // [0, 399]
+    std::int64_t const                      marchDayOfYear(dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100));     // [0, 365], starting on March 1
+    std::int64_t const                      marchMonth((5 * marchDayOfYear + 2) / 153);                                         // [0, 11], starting with March
+    std::int64_t const                      isJanuaryOrFebruary(static_cast<std::int64_t>(marchMonth >= 10));
+
+    CivilDate                               result;
+
+    result.year = yearOfEra + era * 400 + isJanuaryOrFebruary;
+    result.month = marchMonth + 3 - 12 * isJanuaryOrFebruary;
+    result.day = marchDayOfYear - (153 * marchMonth + 2) / 5 + 1;
+    result.isLeapYear = static_cast<std::int64_t>((result.year % 4 == 0) & ((result.year % 100 != 0) | (result.year % 400 == 0)));
+
+    // Convert the day of the year so that it is based on January 1
+    result.dayOfYear = marchDayOfYear + 59 + result.isLeapYear - isJanuaryOrFebruary * (365 + result.isLeapYear);
+
+    return result;
+}
+
 } // anonymous namespace
 
+// ----------------------------------------------------------------------
+// |
+// |  TimePointLabel
+// |
+// ----------------------------------------------------------------------
+TimePointLabel::TimePointLabel(void) :
+    TimePointLabel("", 0) {
+}
+
+TimePointLabel::TimePointLabel(char const *value) :
+    TimePointLabel(value, value ? std::strlen(value) : 0) {
+}
+
+TimePointLabel::TimePointLabel(char const *value, size_t size) :
+    _value(value ? value : ""),
+    _size(value ? size : 0) {
+}
+
+TimePointLabel::TimePointLabel(std::string const &value) :
+    TimePointLabel(value.c_str(), value.size()) {
+}
+
+char const * TimePointLabel::c_str(void) const {
+    return _value;
+}
+
+size_t TimePointLabel::size(void) const {
+    return _size;
+}
+
+bool TimePointLabel::empty(void) const {
+    return _size == 0;
+}
+
+char const * TimePointLabel::begin(void) const {
+    return _value;
+}
+
+char const * TimePointLabel::end(void) const {
+    return _value + _size;
+}
+
+TimePointLabel::operator std::string(void) const {
+    return std::string(_value, _size);
+}
+
+bool operator==(TimePointLabel const &a, TimePointLabel const &b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+}
+
+bool operator!=(TimePointLabel const &a, TimePointLabel const &b) {
+    return (a == b) == false;
+}
+
+std::ostream & operator<<(std::ostream &os, TimePointLabel const &label) {
+    return os.write(label.c_str(), static_cast<std::streamsize>(label.size()));
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  TimePoint
 // |
 // ----------------------------------------------------------------------
+/*static*/ TimePointLabel const TimePoint::MonthLabels[12] = {
+    TimePointLabel("January", 7), TimePointLabel("February", 8), TimePointLabel("March", 5),
+    TimePointLabel("April", 5), TimePointLabel("May", 3), TimePointLabel("June", 4),
+    TimePointLabel("July", 4), TimePointLabel("August", 6), TimePointLabel("September", 9),
+    TimePointLabel("October", 7), TimePointLabel("November", 8), TimePointLabel("December", 8)
+};
+
+/*static*/ TimePointLabel const TimePoint::DayOfWeekLabels[7] = {
+    TimePointLabel("Sunday", 6), TimePointLabel("Monday", 6), TimePointLabel("Tuesday", 7),
+    TimePointLabel("Wednesday", 9), TimePointLabel("Thursday", 8), TimePointLabel("Friday", 6),
+    TimePointLabel("Saturday", 8)
+};
+
+/*static*/ TimePointLabel const TimePoint::AmPmLabels[2] = {
+    TimePointLabel("am", 2), TimePointLabel("pm", 2)
+};
+
 TimePoint::TimePoint(const std::chrono::system_clock::time_point& sysTime) {
     // Get to a tm to get what we need.
     // Eventually C++202x will have expanded chrono support that might
@@ -297,10 +441,10 @@ TimePoint::TimePoint(const std::chrono::system_clock::time_point& sysTime) {
 
         weekIso = static_cast<std::uint8_t>(iso_date.weeknum().operator unsigned());
         yearIso = iso_date.year().operator int();
-        monthLabel = _months[month - 1];
-        amPmLabel = amPm ? "pm" : "am";
-        dayOfWeekLabel = _weekDays[dayOfWeek];
-        holidayName = "";
+        monthLabel = MonthLabels[month - 1];
+        amPmLabel = AmPmLabels[amPm];
+        dayOfWeekLabel = DayOfWeekLabels[dayOfWeek];
+        holidayName = TimePointLabel();
         isPaidTimeOff = 0;               // TODO
     }
     else
@@ -314,6 +458,243 @@ TimePoint::TimePoint(const std::chrono::system_clock::time_point& sysTime) {
     }
 }
 
+// ----------------------------------------------------------------------
+// |
+// |  HolidayTable
+// |
+// ----------------------------------------------------------------------
+/*static*/ HolidayTable::HolidayTablePtr HolidayTable::Get(std::string const &countryName, std::string const &optionalDataRootDir) {
+    static std::mutex                                                   tablesMutex;
+    static std::unordered_map<std::string, HolidayTablePtr>             tables;
+
+    std::string const                       dataDirectory(GetDateTimeFeaturizerDataDirectory(optionalDataRootDir));
+    std::string const                       key(dataDirectory + "\n" + countryName);
+
+    std::lock_guard<std::mutex> const       lock(tablesMutex);
+
+    std::ignore = lock;
+
+    auto const                              iter(tables.find(key));
+
+    if(iter != tables.end())
+        return iter->second;
+
+    // Get the corresponding file
+    std::string                             filename;
+
+    if(
+        EnumCountries(
+            [&countryName, &filename](std::string country) {
+                if(DoesCountryMatch(countryName, country)) {
+                    filename = std::move(country);
+
+                    // Don't continue processing
+                    return false;
+                }
+
+                return true;
+            },
+            optionalDataRootDir
+        )
+    ) {
+        // A true return value means that we have enumerated through all of the country names and didn't find a match
+        throw std::invalid_argument(countryName);
+    }
+
+    size_t                                  cData(0);
+    DataPtr                                 pData(MapFile(dataDirectory + BinaryDataDirectory + RemoveCountryExtension(filename) + ".bin", cData));
+
+    if(!pData) {
+        // The binary data isn't available, so create it from the JSON file.
+        // Note that the map keys are generated with "Date" and "Holiday" so no need to check existence
+        nlohmann::json const                holidaysByCountry(GetJsonStream(dataDirectory + filename));
+        std::vector<unsigned char> const    data(
+            CreateData(
+                holidaysByCountry.at("Date").get<std::vector<std::int64_t>>(),
+                holidaysByCountry.at("Holiday").get<std::vector<std::string>>()
+            )
+        );
+        unsigned char *                     pBuffer(new unsigned char[data.size()]);
+
+        pData = DataPtr(pBuffer, std::default_delete<unsigned char []>());
+        std::copy(data.begin(), data.end(), pBuffer);
+
+        cData = data.size();
+    }
+
+    HolidayTablePtr                         result(std::make_shared<HolidayTable>(std::move(pData), cData));
+
+    tables.emplace(key, result);
+    return result;
+}
+
+/*static*/ std::vector<unsigned char> HolidayTable::CreateData(std::vector<std::int64_t> const &dates, std::vector<std::string> const &names) {
+    if(dates.size() != names.size())
+        throw std::invalid_argument("dates and names must have the same number of elements");
+
+    if(dates.size() > std::numeric_limits<std::uint32_t>::max())
+        throw std::invalid_argument("dates");
+
+    // Assign indexes to the names in the order in which they are first encountered
+    std::unordered_map<std::string, std::uint16_t>  nameIndexMap;
+    std::vector<std::string const *>        uniqueNames;
+    std::vector<std::uint16_t>              nameIndexes;
+
+    nameIndexes.reserve(names.size());
+
+    for(auto const & name : names) {
+        auto const                          iter(nameIndexMap.find(name));
+
+        if(iter != nameIndexMap.end()) {
+            nameIndexes.emplace_back(iter->second);
+            continue;
+        }
+
+        if(uniqueNames.size() > std::numeric_limits<std::uint16_t>::max())
+            throw std::invalid_argument("Too many holiday names");
+
+        std::uint16_t const                 nameIndex(static_cast<std::uint16_t>(uniqueNames.size()));
+
+        nameIndexMap.emplace(name, nameIndex);
+        uniqueNames.emplace_back(&name);
+        nameIndexes.emplace_back(nameIndex);
+    }
+
+    // Convert the dates
+    std::vector<std::int32_t>               days;
+
+    days.reserve(dates.size());
+
+    for(auto const & date : dates) {
+        if(date % SecondsPerDay != 0)
+            throw std::invalid_argument("Dates must be based on midnight");
+
+        std::int64_t const                  day(date / SecondsPerDay);
+
+        if(day < std::numeric_limits<std::int32_t>::min() || day > std::numeric_limits<std::int32_t>::max())
+            throw std::invalid_argument("Date is out of range");
+
+        if(days.empty() == false && day <= days.back())
+            throw std::invalid_argument("Dates must be sorted and unique");
+
+        days.emplace_back(static_cast<std::int32_t>(day));
+    }
+
+    // Create the string pool
+    std::vector<std::uint32_t>              nameOffsets;
+    std::string                             stringPool;
+
+    nameOffsets.reserve(uniqueNames.size());
+
+    for(auto const & pName : uniqueNames) {
+        nameOffsets.emplace_back(static_cast<std::uint32_t>(stringPool.size()));
+
+        stringPool += *pName;
+        stringPool += '\0';
+    }
+
+    // Write the data
+    size_t const                            nameOffsetsPosition(GetHolidayTableNameOffsetsPosition(days.size()));
+    std::vector<unsigned char>              result(nameOffsetsPosition + nameOffsets.size() * sizeof(std::uint32_t) + stringPool.size(), 0);
+    unsigned char *                         pResult(result.data());
+
+    std::uint32_t const                     header[4] = {
+        HolidayTableVersion,
+        static_cast<std::uint32_t>(days.size()),
+        static_cast<std::uint32_t>(nameOffsets.size()),
+        static_cast<std::uint32_t>(stringPool.size())
+    };
+
+    std::memcpy(pResult, HolidayTableMagic, sizeof(HolidayTableMagic));
+    std::memcpy(pResult + sizeof(HolidayTableMagic), header, sizeof(header));
+    std::memcpy(pResult + HolidayTableHeaderSize, days.data(), days.size() * sizeof(std::int32_t));
+    std::memcpy(pResult + HolidayTableHeaderSize + days.size() * sizeof(std::int32_t), nameIndexes.data(), nameIndexes.size() * sizeof(std::uint16_t));
+    std::memcpy(pResult + nameOffsetsPosition, nameOffsets.data(), nameOffsets.size() * sizeof(std::uint32_t));
+    std::memcpy(pResult + nameOffsetsPosition + nameOffsets.size() * sizeof(std::uint32_t), stringPool.data(), stringPool.size());
+
+    return result;
+}
+
+HolidayTable::HolidayTable(DataPtr pData, size_t cData) :
+    _pData(
+        [&pData, &cData](void) {
+            if(!pData)
+                throw std::invalid_argument("pData");
+
+            if(reinterpret_cast<std::uintptr_t>(pData.get()) % sizeof(std::uint32_t) != 0)
+                throw std::invalid_argument("pData is not aligned");
+
+            if(cData < HolidayTableHeaderSize || std::memcmp(pData.get(), HolidayTableMagic, sizeof(HolidayTableMagic)) != 0)
+                throw std::invalid_argument("Invalid holiday table");
+
+            if(ReadHolidayTableHeaderValue(pData.get(), 0) != HolidayTableVersion)
+                throw std::invalid_argument("Unsupported holiday table version");
+
+            std::uint64_t const             numDates(ReadHolidayTableHeaderValue(pData.get(), 1));
+            std::uint64_t const             numNames(ReadHolidayTableHeaderValue(pData.get(), 2));
+            std::uint64_t const             stringPoolSize(ReadHolidayTableHeaderValue(pData.get(), 3));
+            std::uint64_t const             nameOffsetsPosition((HolidayTableHeaderSize + numDates * (sizeof(std::int32_t) + sizeof(std::uint16_t)) + 3) & ~static_cast<std::uint64_t>(3));
+
+            if(nameOffsetsPosition + numNames * sizeof(std::uint32_t) + stringPoolSize != cData)
+                throw std::invalid_argument("Invalid holiday table size");
+
+            // Every name is terminated within the string pool, so names can't
+            // exist without it
+            if(numNames != 0 && stringPoolSize == 0)
+                throw std::invalid_argument("Invalid holiday table string pool");
+
+            return std::move(pData);
+        }()
+    ),
+    _cData(cData),
+    _numDates(ReadHolidayTableHeaderValue(_pData.get(), 1)),
+    _numNames(ReadHolidayTableHeaderValue(_pData.get(), 2)),
+    _stringPoolSize(ReadHolidayTableHeaderValue(_pData.get(), 3)),
+    _pDays(reinterpret_cast<std::int32_t const *>(_pData.get() + HolidayTableHeaderSize)),
+    _pNameIndexes(reinterpret_cast<std::uint16_t const *>(_pDays + _numDates)),
+    _pNameOffsets(reinterpret_cast<std::uint32_t const *>(_pData.get() + GetHolidayTableNameOffsetsPosition(_numDates))),
+    _pStringPool(reinterpret_cast<char const *>(_pNameOffsets + _numNames)) {
+    // Validate the content so that lookups don't need to
+    if(_numNames != 0 && _pStringPool[_stringPoolSize - 1] != 0)
+        throw std::invalid_argument("Invalid holiday table string pool");
+
+    for(std::uint32_t index = 0; index < _numNames; ++index) {
+        if(_pNameOffsets[index] >= _stringPoolSize || (index != 0 && _pNameOffsets[index] <= _pNameOffsets[index - 1]))
+            throw std::invalid_argument("Invalid holiday table name offset");
+    }
+
+    for(std::uint32_t index = 0; index < _numDates; ++index) {
+        if(_pNameIndexes[index] >= _numNames)
+            throw std::invalid_argument("Invalid holiday table name index");
+    }
+}
+
+bool HolidayTable::operator==(HolidayTable const &other) const {
+    return _cData == other._cData && std::memcmp(_pData.get(), other._pData.get(), _cData) == 0;
+}
+
+size_t HolidayTable::size(void) const {
+    return _numDates;
+}
+
+TimePointLabel HolidayTable::Find(std::int64_t daysSinceEpoch) const {
+    if(daysSinceEpoch < std::numeric_limits<std::int32_t>::min() || daysSinceEpoch > std::numeric_limits<std::int32_t>::max())
+        return TimePointLabel();
+
+    std::int32_t const                      day(static_cast<std::int32_t>(daysSinceEpoch));
+    std::int32_t const * const              pEndDays(_pDays + _numDates);
+    std::int32_t const * const              pDay(std::lower_bound(_pDays, pEndDays, day));
+
+    if(pDay == pEndDays || *pDay != day)
+        return TimePointLabel();
+
+    std::uint16_t const                     nameIndex(_pNameIndexes[pDay - _pDays]);
+    std::uint32_t const                     nameOffset(_pNameOffsets[nameIndex]);
+    std::uint32_t const                     nextNameOffset(static_cast<std::uint32_t>(nameIndex + 1) < _numNames ? _pNameOffsets[nameIndex + 1] : _stringPoolSize);
+
+    return TimePointLabel(_pStringPool + nameOffset, nextNameOffset - nameOffset - 1);
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  DateTimeTransformer
@@ -340,54 +721,14 @@ DateTimeTransformer::DateTimeTransformer(Archive &ar, std::string dataRootDir) :
 
 DateTimeTransformer::DateTimeTransformer(std::string optionalCountryName, std::string optionalDataRootDir):
     _countryName(std::move(optionalCountryName)),
-    _dateHolidayMap(
-        [this, &optionalDataRootDir]() {
-            if(_countryName.empty())
-                return HolidayMap();
-
-            // Get the corresponding file
-            std::string                         filename;
-
-            if(
-                EnumCountries(
-                    [this, &filename](std::string country) {
-                        if(DoesCountryMatch(_countryName, country)) {
-                            filename = std::move(country);
-
-                            // Don't continue processing
-                            return false;
-                        }
-
-                        return true;
-                    },
-                    optionalDataRootDir
-                )
-            ) {
-                // A true return value means that we have enumerated through all of the country names and didn't find a match
-                throw std::invalid_argument(_countryName);
-            }
-
-            JsonStream holidaysByCountry = GetJsonStream(GetDateTimeFeaturizerDataDirectory(optionalDataRootDir) + filename);
-
-            //Convert Jsonstream to std::unordered_map
-            //Note that the map keys are generated with "Date" and "Holiday" so no need to check existence
-            std::vector<std::int64_t> dateVector = holidaysByCountry.at("Date").get<std::vector<std::int64_t>>();
-            std::vector<std::string> nameVector = holidaysByCountry.at("Holiday").get<std::vector<std::string>>();
-            HolidayMap                      holidays;
-
-            assert(dateVector.size() == nameVector.size());
-            for (unsigned long iter = 0; iter < dateVector.size(); ++iter) {
-                holidays[dateVector[iter]] = nameVector[iter];
-            }
-
-            return holidays;
-        }()
-    ) {
-
+    _holidays(_countryName.empty() ? HolidayTablePtr() : HolidayTable::Get(_countryName, optionalDataRootDir)) {
 }
 
 bool DateTimeTransformer::operator==(DateTimeTransformer const &other) const {
-    return _dateHolidayMap == other._dateHolidayMap;
+    if(_holidays == other._holidays)
+        return true;
+
+    return _holidays && other._holidays && *_holidays == *other._holidays;
 }
 
 void DateTimeTransformer::save(Archive & ar) const /*override*/ {
@@ -402,28 +743,101 @@ void DateTimeTransformer::save(Archive & ar) const /*override*/ {
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-void DateTimeTransformer::execute_impl(InputType const &input, CallbackFunction const &callback) /*override*/ {
-    static constexpr long long const        secondsPerDay(60 * 60 * 24);
+void DateTimeTransformer::execute_batch(std::int64_t const *pSeconds, size_t cSeconds, TimePointColumns const &columns) {
+    if(pSeconds == nullptr && cSeconds != 0)
+        throw std::invalid_argument("pSeconds");
+
+    // Copy the column pointers so that the compiler knows that they aren't modified by
+    // the writes within the loop.
+    TimePointColumns const                  output(columns);
+
+    if(
+        output.year == nullptr || output.month == nullptr || output.day == nullptr
+        || output.hour == nullptr || output.minute == nullptr || output.second == nullptr
+        || output.amPm == nullptr || output.hour12 == nullptr || output.dayOfWeek == nullptr
+        || output.dayOfQuarter == nullptr || output.dayOfYear == nullptr || output.weekOfMonth == nullptr
+        || output.quarterOfYear == nullptr || output.halfOfYear == nullptr || output.weekIso == nullptr
+        || output.yearIso == nullptr
+    )
+        throw std::invalid_argument("columns");
+
+    // Offsets of the first day in each quarter, in a year that isn't a leap year
+    static constexpr std::int64_t const     quarterStarts[4] = { 0, 90, 181, 273 };
+
+    for(size_t index = 0; index < cSeconds; ++index) {
+        std::int64_t const                  seconds(pSeconds[index]);
+        std::int64_t const                  days(FloorDiv(seconds, SecondsPerDay));
+        std::int64_t const                  secondOfDay(seconds - days * SecondsPerDay);
+        std::int64_t const                  hour(secondOfDay / 3600);
+        CivilDate const                     date(CivilFromDays(days));
+        std::int64_t const                  quarter((date.month - 1) / 3);
+
+        // 1970-01-01 was a Thursday; days of the week start with Sunday (0)
+        std::int64_t const                  dayOfWeek(days + 4 - FloorDiv(days + 4, 7) * 7);
+
+        // The ISO week is the week that contains the Thursday of this week (weeks start
+        // on Monday), and the ISO year is the year of that Thursday.
+        CivilDate const                     thursday(CivilFromDays(days - (dayOfWeek + 6) % 7 + 3));
+
+        output.year[index] = static_cast<std::int32_t>(date.year);
+        output.month[index] = static_cast<std::uint8_t>(date.month);
+        output.day[index] = static_cast<std::uint8_t>(date.day);
+        output.hour[index] = static_cast<std::uint8_t>(hour);
+        output.minute[index] = static_cast<std::uint8_t>(secondOfDay / 60 % 60);
+        output.second[index] = static_cast<std::uint8_t>(secondOfDay % 60);
+        output.amPm[index] = static_cast<std::uint8_t>(hour >= 12);
+        output.hour12[index] = static_cast<std::uint8_t>(hour - 12 * static_cast<std::int64_t>(hour > 12));
+        output.dayOfWeek[index] = static_cast<std::uint8_t>(dayOfWeek);
+        output.dayOfQuarter[index] = static_cast<std::uint8_t>(date.dayOfYear - quarterStarts[quarter] - date.isLeapYear * static_cast<std::int64_t>(quarter != 0) + 1);
+        output.dayOfYear[index] = static_cast<std::uint16_t>(date.dayOfYear);
+        output.weekOfMonth[index] = static_cast<std::uint16_t>((date.day - 1) / 7);
+        output.quarterOfYear[index] = static_cast<std::uint8_t>(quarter + 1);
+        output.halfOfYear[index] = static_cast<std::uint8_t>(1 + static_cast<std::int64_t>(date.month > 6));
+        output.weekIso[index] = static_cast<std::uint8_t>(thursday.dayOfYear / 7 + 1);
+        output.yearIso[index] = static_cast<std::int32_t>(thursday.year);
+    }
+
+    if(output.holidayName) {
+        for(size_t index = 0; index < cSeconds; ++index)
+            output.holidayName[index] = GetHolidayName(pSeconds[index]);
+    }
+}
 
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+void DateTimeTransformer::execute_impl(InputType const &input, CallbackFunction const &callback) /*override*/ {
     TimePoint                               result(input);
 
-    if (!_dateHolidayMap.empty()) {
-        // Values in the holiday map are based on midnight of the corresponding day. When looking up holidays for this time,
-        // remove any seconds since midnight.
-        long long const                     totalSeconds(std::chrono::time_point_cast<std::chrono::seconds>(input).time_since_epoch().count());
-        int64_t const                       holidayKey(static_cast<int64_t>((static_cast<double>(totalSeconds) / secondsPerDay)) * secondsPerDay);
-        HolidayMap::const_iterator const    iter(_dateHolidayMap.find(holidayKey));
-
-        if(iter != _dateHolidayMap.end())
-            result.holidayName = iter->second;
-    }
+    result.holidayName = GetHolidayName(std::chrono::time_point_cast<std::chrono::seconds>(input).time_since_epoch().count());
 
     callback(std::move(result));
 }
 
+void DateTimeTransformer::execute_batch_impl(InputType const *pInput, size_t cInput, TimePoint *pOutput) /*override*/ {
+    InputType const * const                 pEndInput(pInput + cInput);
+
+    while(pInput != pEndInput) {
+        *pOutput = TimePoint(*pInput);
+        pOutput->holidayName = GetHolidayName(std::chrono::time_point_cast<std::chrono::seconds>(*pInput).time_since_epoch().count());
+
+        ++pInput;
+        ++pOutput;
+    }
+}
+
 void DateTimeTransformer::flush_impl(CallbackFunction const &) /*override*/ {
 }
 
+TimePointLabel DateTimeTransformer::GetHolidayName(std::int64_t secondsSinceEpoch) const {
+    if(!_holidays)
+        return TimePointLabel();
+
+    // Holidays are based on midnight of the corresponding day. When looking up holidays for this time,
+    // remove any seconds since midnight.
+    return _holidays->Find(static_cast<std::int64_t>(static_cast<double>(secondsSinceEpoch) / SecondsPerDay));
+}
+
 // ----------------------------------------------------------------------
 // |
 // |  DateTimeEstimator
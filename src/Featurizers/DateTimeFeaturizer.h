@@ -7,8 +7,10 @@
 #include <chrono>
 #include <ctime>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 #include <string>
 
@@ -64,6 +66,56 @@ std::string GetExecutable(void);
 ///
 std::string GetDateTimeFeaturizerDataDirectory(std::string optionalDataRootDir);
 
+/////////////////////////////////////////////////////////////////////////
+///  \class         TimePointLabel
+///  \brief         Non-owning reference to a null-terminated string used for
+///                 the labels in a TimePoint.
+///
+///                 Labels reference static tables (for months, days of the week,
+///                 and am/pm) or holiday names owned by the DateTimeTransformer
+///                 that created the TimePoint, so creating a TimePoint never
+///                 allocates. A holiday name is only valid for the lifetime of the
+///                 transformer that produced it.
+///
+class TimePointLabel {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    TimePointLabel(void);
+    TimePointLabel(char const *value);
+    TimePointLabel(char const *value, size_t size);
+
+    // The label references the string's buffer, so it is only valid while the
+    // string is alive and unmodified; temporaries are rejected.
+    explicit TimePointLabel(std::string const &value);
+    TimePointLabel(std::string &&value) = delete;
+
+    char const * c_str(void) const;
+    size_t size(void) const;
+    bool empty(void) const;
+
+    char const * begin(void) const;
+    char const * end(void) const;
+
+    explicit operator std::string(void) const;
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    char const *                            _value;
+    size_t                                  _size;
+};
+
+bool operator==(TimePointLabel const &a, TimePointLabel const &b);
+bool operator!=(TimePointLabel const &a, TimePointLabel const &b);
+std::ostream & operator<<(std::ostream &os, TimePointLabel const &label);
+
 /////////////////////////////////////////////////////////////////////////
 ///  \struct        TimePoint
 ///  \brief         Struct to hold various components of DateTime information
@@ -85,10 +137,10 @@ struct TimePoint {
     std::uint8_t halfOfYear = 0;    // 1 if date is prior to July 1, 2 otherwise
     std::uint8_t weekIso = 0;       // ISO week, see below for details
     std::int32_t yearIso = 0;      // ISO year, see details later
-    std::string monthLabel = "";    // calendar month as string, 'January' through 'December'
-    std::string amPmLabel = "";     // 'am' if hour is before noon (12 pm), 'pm' otherwise
-    std::string dayOfWeekLabel = "";// day of week as string
-    std::string holidayName = "";   // If a country is provided, we check if the date is a holiday
+    TimePointLabel monthLabel;      // calendar month as string, 'January' through 'December'
+    TimePointLabel amPmLabel;       // 'am' if hour is before noon (12 pm), 'pm' otherwise
+    TimePointLabel dayOfWeekLabel;  // day of week as string
+    TimePointLabel holidayName;     // If a country is provided, we check if the date is a holiday
     std::uint8_t isPaidTimeOff = 0; // If its a holiday, is it PTO
 
     // ISO year and week are defined in ISO 8601, see Wikipedia.ISO for details.
@@ -97,9 +149,13 @@ struct TimePoint {
     // This means if January 1 falls on a Friday, ISO year will begin only on
     // January 4. As such, ISO years may differ from calendar years.
 
-    TimePoint(const std::chrono::system_clock::time_point& sysTime);
+    // Label tables, indexed by `month - 1`, `dayOfWeek`, and `amPm`
+    static TimePointLabel const             MonthLabels[12];
+    static TimePointLabel const             DayOfWeekLabels[7];
+    static TimePointLabel const             AmPmLabels[2];
 
-    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(TimePoint);
+    TimePoint(void) = default;
+    TimePoint(const std::chrono::system_clock::time_point& sysTime);
 
     enum {
         JANUARY = 1, FEBRUARY, MARCH, APRIL, MAY, JUNE,
@@ -108,17 +164,110 @@ struct TimePoint {
     enum {
         SUNDAY = 0, MONDAY, TUESDAY, WEDNESDAY, THURSDAY, FRIDAY, SATURDAY
     };
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         HolidayTable
+///  \brief         Read-only holidays for a country.
+///
+///                 Tables use a compact binary format that is generated by
+///                 `DateTimeFeaturizerData/Tools/BinaryGenerator.py`: a header, the
+///                 sorted days (since the Unix epoch) of each holiday, the index of
+///                 each holiday's name, and a pool of null-terminated names. The
+///                 format doesn't contain any pointers, so the binary files are
+///                 memory mapped rather than parsed.
+///
+///                 Tables are loaded once per process and shared by all of the
+///                 transformers for the same country.
+///
+class HolidayTable {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Types
+    // |
+    // ----------------------------------------------------------------------
+    using HolidayTablePtr                   = std::shared_ptr<HolidayTable const>;
+
+    /// Data in the binary format; the deleter releases the memory (or mapping)
+    using DataPtr                           = std::shared_ptr<unsigned char const>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /// Returns the table for the country, loading it if it hasn't been loaded
+    /// by this process. The binary file is used if it exists in the data directory;
+    /// otherwise, the table is created from the country's JSON file.
+    static HolidayTablePtr Get(std::string const &countryName, std::string const &optionalDataRootDir);
+
+    /// Creates data in the binary format; `dates` are seconds since the Unix epoch
+    /// at midnight of each holiday and must be sorted.
+    static std::vector<unsigned char> CreateData(std::vector<std::int64_t> const &dates, std::vector<std::string> const &names);
+
+    HolidayTable(DataPtr pData, size_t cData);
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(HolidayTable);
+
+    bool operator==(HolidayTable const &other) const;
+
+    /// Returns the number of holidays
+    size_t size(void) const;
+
+    /// Returns the name of the holiday on the day, or an empty label if the day
+    /// is not a holiday.
+    TimePointLabel Find(std::int64_t daysSinceEpoch) const;
 
 private:
-    const std::string _weekDays[7] = {
-        "Sunday", "Monday", "Tuesday", "Wednesday",
-        "Thursday", "Friday", "Saturday"
-    };
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    DataPtr const                           _pData;
+    size_t const                            _cData;
 
-    const std::string _months[12] = {
-        "January", "February", "March", "April", "May", "June",
-        "July", "August", "September", "October", "November", "December"
-    };
+    std::uint32_t const                     _numDates;
+    std::uint32_t const                     _numNames;
+    std::uint32_t const                     _stringPoolSize;
+
+    std::int32_t const *                    _pDays;
+    std::uint16_t const *                   _pNameIndexes;
+    std::uint32_t const *                   _pNameOffsets;
+    char const *                            _pStringPool;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        TimePointColumns
+///  \brief         Struct-of-arrays destination used when converting a column
+///                 of timestamps with `DateTimeTransformer::execute_batch`.
+///
+///                 Each column has the same meaning as the corresponding TimePoint
+///                 member and must reference a buffer large enough to hold all of
+///                 the converted values. Labels can be retrieved from the TimePoint
+///                 label tables using `month`, `dayOfWeek`, and `amPm`; `holidayName`
+///                 is optional and is only populated when it isn't null.
+///
+struct TimePointColumns {
+    std::int32_t *                          year = nullptr;
+    std::uint8_t *                          month = nullptr;
+    std::uint8_t *                          day = nullptr;
+    std::uint8_t *                          hour = nullptr;
+    std::uint8_t *                          minute = nullptr;
+    std::uint8_t *                          second = nullptr;
+    std::uint8_t *                          amPm = nullptr;
+    std::uint8_t *                          hour12 = nullptr;
+    std::uint8_t *                          dayOfWeek = nullptr;
+    std::uint8_t *                          dayOfQuarter = nullptr;
+    std::uint16_t *                         dayOfYear = nullptr;
+    std::uint16_t *                         weekOfMonth = nullptr;
+    std::uint8_t *                          quarterOfYear = nullptr;
+    std::uint8_t *                          halfOfYear = nullptr;
+    std::uint8_t *                          weekIso = nullptr;
+    std::int32_t *                          yearIso = nullptr;
+    TimePointLabel *                        holidayName = nullptr;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -155,14 +304,23 @@ public:
 
     void save(Archive & ar) const override;
 
+    /// Converts a column of time points into `pOutput`, which must be large
+    /// enough to hold `cInput` items. No heap allocations are made; holiday
+    /// names in the results reference data owned by this transformer.
+    using BaseType::execute_batch;
+
+    /// Converts a column of seconds since the Unix epoch (UTC) into `columns`.
+    /// The calendar decomposition uses branch-free integer arithmetic rather than
+    /// `gmtime`, so the loop over the values can be vectorized by the compiler.
+    void execute_batch(std::int64_t const *pSeconds, size_t cSeconds, TimePointColumns const &columns);
+
 private:
     // ----------------------------------------------------------------------
     // |
     // |  Private Types
     // |
     // ----------------------------------------------------------------------
-    using JsonStream                        = nlohmann::json;
-    using HolidayMap                        = std::unordered_map<std::int64_t, std::string>;
+    using HolidayTablePtr                   = HolidayTable::HolidayTablePtr;
 
     // ----------------------------------------------------------------------
     // |
@@ -170,7 +328,7 @@ private:
     // |
     // ----------------------------------------------------------------------
     std::string const                       _countryName;
-    HolidayMap const                        _dateHolidayMap;
+    HolidayTablePtr const                   _holidays;
 
     // ----------------------------------------------------------------------
     // |
@@ -178,7 +336,12 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(InputType const &input, CallbackFunction const &callback) override;
+    void execute_batch_impl(InputType const *pInput, size_t cInput, TimePoint *pOutput) override;
     void flush_impl(CallbackFunction const &callback) override;
+
+    /// Returns the name of the holiday on the date of `secondsSinceEpoch`, or an empty
+    /// label if the date is not a holiday.
+    TimePointLabel GetHolidayName(std::int64_t secondsSinceEpoch) const;
 };
 
 class DateTimeEstimator :
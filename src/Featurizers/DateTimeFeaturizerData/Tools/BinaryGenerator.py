@@ -0,0 +1,139 @@
+# ----------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License
+# ----------------------------------------------------------------------
+"""Generates binary holiday tables based on the generated JSON files"""
+
+import json
+import os
+import struct
+import sys
+
+import CommonEnvironment
+from CommonEnvironment import CommandLine
+from CommonEnvironment import FileSystem
+from CommonEnvironment.StreamDecorator import StreamDecorator
+
+# ----------------------------------------------------------------------
+_script_fullpath                            = CommonEnvironment.ThisFullpath()
+_script_dir, _script_name                   = os.path.split(_script_fullpath)
+# ----------------------------------------------------------------------
+
+# The binary format is consumed by `HolidayTable` in DateTimeFeaturizer.cpp; all values are little endian.
+#
+#   char        magic[8]                    "HOLIDAYS"
+#   uint32      version                     1
+#   uint32      numDates
+#   uint32      numNames
+#   uint32      stringPoolSize
+#   int32       days[numDates]              Sorted days since the Unix epoch
+#   uint16      nameIndexes[numDates]       Index of the name associated with each day
+#   <padding to a 4-byte boundary>
+#   uint32      nameOffsets[numNames]       Offset of each name within the string pool
+#   char        stringPool[stringPoolSize]  Null-terminated names
+#
+MAGIC                                       = b"HOLIDAYS"
+VERSION                                     = 1
+SECONDS_PER_DAY                             = 60 * 60 * 24
+
+
+# ----------------------------------------------------------------------
+@CommandLine.EntryPoint(
+)
+@CommandLine.Constraints(
+    output_stream=None,
+)
+def EntryPoint(
+    output_stream=sys.stdout,
+):
+    """Generates binary holiday tables based on the generated JSON files"""
+
+    with StreamDecorator(output_stream).DoneManager(
+        line_prefix="",
+        prefix="\nResults: ",
+        suffix="\n",
+    ) as dm:
+        input_dir = os.path.join(_script_dir, "..", "GeneratedCode")
+        output_dir = os.path.join(input_dir, "Binary")
+
+        FileSystem.RemoveTree(output_dir)
+        FileSystem.MakeDirs(output_dir)
+
+        for filename in sorted(os.listdir(input_dir)):
+            basename, ext = os.path.splitext(filename)
+            if ext != ".json":
+                continue
+
+            with open(os.path.join(input_dir, filename)) as f:
+                content = json.load(f)
+
+            with open(os.path.join(output_dir, "{}.bin".format(basename)), "wb") as f:
+                f.write(CreateBinaryData(content["Date"], content["Holiday"]))
+
+        return dm.result
+
+
+# ----------------------------------------------------------------------
+# ----------------------------------------------------------------------
+# ----------------------------------------------------------------------
+def CreateBinaryData(dates, names):
+    assert len(dates) == len(names), (len(dates), len(names))
+
+    name_indexes = []
+    unique_names = {}
+
+    for name in names:
+        index = unique_names.get(name, None)
+        if index is None:
+            index = len(unique_names)
+            unique_names[name] = index
+
+        name_indexes.append(index)
+
+    if len(unique_names) > 0xFFFF:
+        raise Exception("Too many holiday names")
+
+    name_offsets = []
+    string_pool = bytearray()
+
+    for name in unique_names.keys():
+        name_offsets.append(len(string_pool))
+
+        string_pool += name.encode("utf-8")
+        string_pool += b"\0"
+
+    days = []
+
+    for date in dates:
+        if date % SECONDS_PER_DAY != 0:
+            raise Exception("'{}' is not a midnight-based date".format(date))
+
+        days.append(date // SECONDS_PER_DAY)
+
+    if days != sorted(days) or len(set(days)) != len(days):
+        raise Exception("Dates must be sorted and unique")
+
+    result = bytearray()
+
+    result += MAGIC
+    result += struct.pack("<IIII", VERSION, len(days), len(unique_names), len(string_pool))
+    result += struct.pack("<{}i".format(len(days)), *days)
+    result += struct.pack("<{}H".format(len(name_indexes)), *name_indexes)
+
+    while len(result) % 4:
+        result += b"\0"
+
+    result += struct.pack("<{}I".format(len(name_offsets)), *name_offsets)
+    result += string_pool
+
+    return bytes(result)
+
+
+# ----------------------------------------------------------------------
+# ----------------------------------------------------------------------
+# ----------------------------------------------------------------------
+if __name__ == "__main__":
+    try:
+        sys.exit(CommandLine.Main())
+    except KeyboardInterrupt:
+        pass
@@ -60,18 +60,25 @@ private:
 
     // MSVC has problems when the definition and declaration are separated
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override {
+        callback(transform(input));
+    }
+
+    void execute_batch_impl(typename BaseType::InputType const *pInput, size_t cInput, typename BaseType::TransformedType *pOutput) override {
+        for(size_t index = 0; index < cInput; ++index)
+            pOutput[index] = transform(pInput[index]);
+    }
+
+    std::uint32_t transform(typename BaseType::InputType const &input) const {
         typename IndexMap::const_iterator const         iter(Labels.find(input));
 
         if(iter == Labels.end()) {
-            if(AllowMissingValues) {
-                callback(0);
-                return;
-            }
+            if(AllowMissingValues)
+                return 0;
 
             throw std::invalid_argument("'input' was not found");
         }
 
-        callback(iter->second + (AllowMissingValues ? 1 : 0));
+        return iter->second + (AllowMissingValues ? 1 : 0);
     }
 };
 
@@ -61,6 +61,9 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(typename BaseType::InputType const *pInput, size_t cInput, typename BaseType::TransformedType *pOutput) override;
+
+    TransformedT transform(typename BaseType::InputType const &input) const;
 };
 
 namespace Details {
@@ -233,22 +236,31 @@ void MaxAbsScalerTransformer<InputT, TransformedT>::save(Archive &ar) const /*ov
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
 void MaxAbsScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+    callback(transform(input));
+}
+
+template <typename InputT, typename TransformedT>
+void MaxAbsScalerTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInput, size_t cInput, typename BaseType::TransformedType *pOutput) /*override*/ {
+    for(size_t index = 0; index < cInput; ++index)
+        pOutput[index] = transform(pInput[index]);
+}
+
+template <typename InputT, typename TransformedT>
+TransformedT MaxAbsScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input) const {
 
 #if (defined __clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wfloat-equal"
 #endif
 
-    if (Scale != static_cast<TransformedT>(0)) {
-        callback(static_cast<TransformedT>(input) / Scale);
-        return;
-    }
+    if (Scale != static_cast<TransformedT>(0))
+        return static_cast<TransformedT>(input) / Scale;
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
 #endif
 
-    callback(static_cast<TransformedT>(input));
+    return static_cast<TransformedT>(input);
 }
 
 
@@ -95,6 +95,9 @@ struct ShouldInterpolateValues {
 ///  \brief         Creates a `Transformer` that populates null values with the
 ///                 median value encountered during training.
 ///
+///                 When `medianRankError` is provided, the median is approximated
+///                 with a bounded amount of memory (see `MedianEstimator`).
+///
 template <
     typename InputT,
     typename TransformedT,
@@ -126,7 +129,7 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    MedianImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex);
+    MedianImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, float medianRankError=Traits<std::float_t>::CreateNullValue());
     ~MedianImputerEstimator(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MedianImputerEstimator);
@@ -186,11 +189,11 @@ void Details::MedianImputerEstimatorImpl<InputT, TransformedT, InterpolateValues
 // |
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT, bool InterpolateValuesV, size_t MaxNumTrainingItemsV>
-MedianImputerEstimator<InputT, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>::MedianImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex) :
+MedianImputerEstimator<InputT, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>::MedianImputerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, float medianRankError) :
     BaseType(
         "MedianImputerEstimator",
         pAllColumnAnnotations,
-        [pAllColumnAnnotations, colIndex](void) { return Components::MedianEstimator<typename Traits<InputT>::nullable_type, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
+        [pAllColumnAnnotations, colIndex, &medianRankError](void) { return Components::MedianEstimator<typename Traits<InputT>::nullable_type, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex), true, std::move(medianRankError)); },
         [pAllColumnAnnotations, colIndex](void) { return Details::MedianImputerEstimatorImpl<InputT, TransformedT, InterpolateValuesV, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); }
     ) {
 }
@@ -61,12 +61,13 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(typename BaseType::InputType const *pInput, size_t cInput, typename BaseType::TransformedType *pOutput) override;
 
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::true_type);
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::false_type);
+    TransformedT transform(typename BaseType::InputType const &input, std::true_type) const;
+    TransformedT transform(typename BaseType::InputType const &input, std::false_type) const;
 
     template <typename U>
-    void execute_implex(U const &input, typename BaseType::CallbackFunction const &callback);
+    TransformedT transform_value(U const &input) const;
 };
 
 namespace Details {
@@ -255,44 +256,46 @@ void MinMaxScalerTransformer<InputT, TransformedT>::save(Archive &ar) const /*ov
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
 void MinMaxScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
-    execute_impl(input, callback, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
+    callback(transform(input, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>()));
 }
 
 template <typename InputT, typename TransformedT>
-void MinMaxScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::true_type) {
+void MinMaxScalerTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInput, size_t cInput, typename BaseType::TransformedType *pOutput) /*override*/ {
+    for(size_t index = 0; index < cInput; ++index)
+        pOutput[index] = transform(pInput[index], std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
+}
+
+template <typename InputT, typename TransformedT>
+TransformedT MinMaxScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input, std::true_type) const {
     // ----------------------------------------------------------------------
     using InputTraits                       = Traits<InputT>;
     using TransformedTraits                 = Traits<TransformedT>;
     // ----------------------------------------------------------------------
 
-    if(InputTraits::IsNull(input)) {
-        callback(TransformedTraits::CreateNullValue());
-        return;
-    }
+    if(InputTraits::IsNull(input))
+        return TransformedTraits::CreateNullValue();
 
-    execute_implex(InputTraits::GetNullableValue(input), callback);
+    return transform_value(InputTraits::GetNullableValue(input));
 }
 
 template <typename InputT, typename TransformedT>
-void MinMaxScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::false_type) {
-    execute_implex(input, callback);
+TransformedT MinMaxScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input, std::false_type) const {
+    return transform_value(input);
 }
 
 template <typename InputT, typename TransformedT>
 template <typename U>
-void MinMaxScalerTransformer<InputT, TransformedT>::execute_implex(U const &input, typename BaseType::CallbackFunction const &callback) {
+TransformedT MinMaxScalerTransformer<InputT, TransformedT>::transform_value(U const &input) const {
 #if (defined __clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wdouble-promotion"
 #   pragma clang diagnostic ignored "-Wfloat-equal"
 #endif
 
-    if(_span == static_cast<InputT>(0)) {
-        callback(static_cast<TransformedT>(0));
-        return;
-    }
+    if(_span == static_cast<InputT>(0))
+        return static_cast<TransformedT>(0);
 
-    callback((static_cast<TransformedT>(input) - _min) / _span);
+    return (static_cast<TransformedT>(input) - _min) / _span;
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
@@ -18,6 +18,12 @@ namespace Featurizers {
 ///                 matrix for dimensionality reduction, also provides
 ///                 PCAComponents retriving
 ///
+///                 The output is the input multiplied by the transpose of
+///                 `eigenvectors`. The transposed matrix is calculated once
+///                 during construction, so that `execute` is a single matrix
+///                 product of the input (which can contain any number of rows)
+///                 and the projection.
+///
 template <
     typename InputEigenMatrixT,
     typename OutputEigenMatrixT = typename InputMatrixTypeMapper<InputEigenMatrixT>::OutType
@@ -58,7 +64,8 @@ private:
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    EigenMatrix const                       _eigenvectors;
+    // The transpose of the eigenvectors (features x components)
+    EigenMatrix const                       _projection;
 
     // ----------------------------------------------------------------------
     // |
@@ -70,13 +77,16 @@ private:
         if (input.size() == 0)
             throw std::invalid_argument("Input matrix size() invalid");
 
-        //this is simplified(mathematically) from input.col() == _eigenvectors.transpose().rows()
-        if (input.cols() != _eigenvectors.cols())
+        if (input.cols() != _projection.rows())
             throw std::invalid_argument("Input matrix cols() invalid");
 
-        // TODO: We should compute this transformation during construction and cache that value rather
-        //       then repeatedly calculating it here.
-        callback(input * _eigenvectors.transpose());
+        typename BaseType::TransformedType  result(input.rows(), _projection.cols());
+
+        // Evaluate the (blocked) product directly into the result rather than
+        // into a temporary
+        result.noalias() = input * _projection;
+
+        callback(std::move(result));
     }
 };
 
@@ -84,6 +94,20 @@ private:
 ///  \class         PCAEstimator
 ///  \brief         Estimator to calculate PCAComponents
 ///
+///                 Training data can be provided as any number of row chunks
+///                 across any number of calls to `fit`. The column means and
+///                 the scatter (unnormalized covariance) matrix are merged
+///                 incrementally, so memory is proportional to features^2
+///                 rather than rows * features; the eigendecomposition is
+///                 performed in `complete_training`.
+///
+///                 A `numComponents` value of 0 creates a transformer with all
+///                 of the eigenvectors, as calculated by the eigensolver (one
+///                 eigenvector per column, ordered by increasing eigenvalue).
+///                 Otherwise, the transformer contains one component per row:
+///                 the eigenvectors with the `numComponents` largest
+///                 eigenvalues, ordered from the largest.
+///
 template <
     typename InputEigenMatrixT,
     typename OutputEigenMatrixT = typename InputMatrixTypeMapper<InputEigenMatrixT>::OutType,
@@ -104,7 +128,7 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    PCAEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex);
+    PCAEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, size_t numComponents=0);
     ~PCAEstimator(void) override = default;
 
     FEATURIZER_MOVE_CONSTRUCTOR_ONLY(PCAEstimator);
@@ -117,7 +141,21 @@ private:
     // ----------------------------------------------------------------------
     using EigenMatrix                       = typename InputMatrixTypeMapper<InputEigenMatrixT>::MatrixType;
     using SelfAdjointEigenSolver            = Eigen::SelfAdjointEigenSolver<EigenMatrix>;
-    using EigenVectors                      = typename SelfAdjointEigenSolver::EigenvectorsType;
+
+    // Statistics are accumulated in double precision, as rounding errors
+    // compound over many chunks
+    using AccumulatorMatrix                 = Eigen::Matrix<std::double_t, Eigen::Dynamic, Eigen::Dynamic>;
+    using AccumulatorRowVector              = Eigen::Matrix<std::double_t, 1, Eigen::Dynamic>;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Constants
+    // |
+    // ----------------------------------------------------------------------
+
+    // Chunks are processed in blocks of this many rows, which bounds the size
+    // of the temporary centered copy
+    static constexpr Eigen::Index const     BlockRows = 1024;
 
     // ----------------------------------------------------------------------
     // |
@@ -125,8 +163,15 @@ private:
     // |
     // ----------------------------------------------------------------------
     size_t const                            _colIndex;
+    size_t const                            _numComponents;
 
-    EigenVectors                            _eigenVectors;
+    EigenMatrix                             _eigenVectors;
+
+    // Training statistics; `_scatter` is the sum of the outer products of the
+    // centered rows (Chan et al.'s pairwise update of Welford's algorithm)
+    std::uint64_t                           _numRows;
+    AccumulatorRowVector                    _mean;
+    AccumulatorMatrix                       _scatter;
 
     // ----------------------------------------------------------------------
     // |
@@ -137,27 +182,42 @@ private:
 
     // MSVC has problems when the declaration and definition are separated
     FitResult fit_impl(typename BaseType::InputType const *pBuffer, size_t cElements) override {
-        if(cElements != 1)
-            throw std::runtime_error("Only 1 matrix can be provided");
+        typename BaseType::InputType const * const          pEndBuffer(pBuffer + cElements);
 
-        auto const &                        matrix(*pBuffer);
+        while(pBuffer != pEndBuffer) {
+            auto const &                    matrix(*pBuffer++);
 
-        SelfAdjointEigenSolver              eig(
-            [&matrix]() {
-                //compute for centered training data
-                EigenMatrix                 centered = matrix.rowwise() - matrix.colwise().mean();
+            if(matrix.size() == 0)
+                throw std::invalid_argument("Input matrix size() invalid");
 
-                //compute for covariance matrix
-                EigenMatrix                 cov = centered.adjoint() * centered;
+            if(_numRows == 0) {
+                _mean = AccumulatorRowVector::Zero(matrix.cols());
+                _scatter = AccumulatorMatrix::Zero(matrix.cols(), matrix.cols());
+            }
+            else if(matrix.cols() != _mean.cols())
+                throw std::invalid_argument("Input matrix cols() invalid");
 
-                //using covariance matrix to compute PCA
-                return cov;
-            }()
-        );
+            for(Eigen::Index row = 0; row < matrix.rows(); row += BlockRows) {
+                Eigen::Index const          cRows(std::min(static_cast<Eigen::Index>(BlockRows), matrix.rows() - row));
 
-        _eigenVectors = eig.eigenvectors();
+                AccumulatorMatrix const     block(matrix.middleRows(row, cRows).template cast<std::double_t>());
+                AccumulatorRowVector const  blockMean(block.colwise().mean());
+                AccumulatorMatrix const     centered(block.rowwise() - blockMean);
+                AccumulatorRowVector const  delta(blockMean - _mean);
+
+                std::double_t const         numExisting(static_cast<std::double_t>(_numRows));
+                std::double_t const         numBlock(static_cast<std::double_t>(cRows));
+                std::double_t const         numTotal(numExisting + numBlock);
 
-        return FitResult::Complete;
+                _scatter.noalias() += centered.adjoint() * centered;
+                _scatter.noalias() += delta.adjoint() * delta * (numExisting * numBlock / numTotal);
+                _mean += delta * (numBlock / numTotal);
+
+                _numRows += static_cast<std::uint64_t>(cRows);
+            }
+        }
+
+        return FitResult::Continue;
     }
 
     void complete_training_impl(void) override;
@@ -185,9 +245,14 @@ private:
 // ----------------------------------------------------------------------
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
 PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::PCATransformer(EigenMatrix eigenvectors) :
-    _eigenvectors(std::move(eigenvectors)) {
-    if(_eigenvectors.size() == 0)
-        throw std::invalid_argument("eigenvectors");
+    _projection(
+        [&eigenvectors](void) -> EigenMatrix {
+            if(eigenvectors.size() == 0)
+                throw std::invalid_argument("eigenvectors");
+
+            return eigenvectors.transpose();
+        }()
+    ) {
 }
 
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
@@ -211,7 +276,10 @@ PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::PCATransformer(Archive &a
 
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
 bool PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::operator==(PCATransformer const &other) const {
-    if ((this->_eigenvectors - other._eigenvectors).norm() > 0.000001f)
+    if (this->_projection.rows() != other._projection.rows() || this->_projection.cols() != other._projection.cols())
+        return false;
+
+    if ((this->_projection - other._projection).norm() > 0.000001f)
         return false;
 
     return true;
@@ -224,17 +292,17 @@ void PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::save(Archive &ar) co
     Traits<std::uint16_t>::serialize(ar, 0); // Minor
 
     // Data
-    Traits<decltype(_eigenvectors)>::serialize(ar, _eigenvectors);
+    Traits<EigenMatrix>::serialize(ar, EigenMatrix(_projection.transpose()));
 }
 
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
 std::ptrdiff_t PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::getEigenVectorRowsNumber() const {
-    return _eigenvectors.rows();
+    return _projection.cols();
 }
 
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT>
 std::ptrdiff_t PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::getEigenVectorColsNumber() const {
-    return _eigenvectors.cols();
+    return _projection.rows();
 }
 
 // ----------------------------------------------------------------------
@@ -243,7 +311,7 @@ std::ptrdiff_t PCATransformer<InputEigenMatrixT, OutputEigenMatrixT>::getEigenVe
 // |
 // ----------------------------------------------------------------------
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT, size_t MaxNumTrainingItemsV>
-PCAEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::PCAEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex) :
+PCAEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::PCAEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, size_t numComponents) :
     BaseType("SVDEstimatorImpl", std::move(pAllColumnAnnotations)),
     _colIndex(
         std::move(
@@ -254,7 +322,9 @@ PCAEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::PCAEs
                 return colIndex;
             }()
         )
-    ) {
+    ),
+    _numComponents(std::move(numComponents)),
+    _numRows(0) {
 }
 
 // ----------------------------------------------------------------------
@@ -267,6 +337,27 @@ bool PCAEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::
 
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT, size_t MaxNumTrainingItemsV>
 void PCAEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::complete_training_impl(void) /*override*/ {
+    if(_numRows == 0)
+        throw std::runtime_error("No training data was provided");
+
+    if(_numComponents > static_cast<size_t>(_scatter.cols()))
+        throw std::invalid_argument("numComponents");
+
+    SelfAdjointEigenSolver                  eig(_scatter.template cast<typename EigenMatrix::Scalar>());
+
+    if(_numComponents == 0)
+        _eigenVectors = eig.eigenvectors();
+    else {
+        // Eigenvalues are sorted in increasing order, and each column is an
+        // eigenvector; components are rows ordered by decreasing eigenvalue
+        Eigen::Index const                  numComponents(static_cast<Eigen::Index>(_numComponents));
+
+        _eigenVectors = eig.eigenvectors().rightCols(numComponents).rowwise().reverse().transpose();
+    }
+
+    _numRows = 0;
+    _mean.resize(0);
+    _scatter.resize(0, 0);
 }
 
 } // namespace Featurizers
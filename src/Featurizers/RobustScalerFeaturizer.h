@@ -58,6 +58,9 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(typename BaseType::InputType const *pInput, size_t cInput, typename BaseType::TransformedType *pOutput) override;
+
+    TransformedT transform(typename BaseType::InputType const &input) const;
 };
 
 namespace Details {
@@ -162,6 +165,10 @@ private:
 ///  \class         RobustScalerEstimator
 ///  \brief         This class 'chains' RobustScalerNormEstimator and RobustScalerEstimator.
 ///
+///                 When `medianRankError` is provided, the median used for centering
+///                 is approximated with a bounded amount of memory (see
+///                 `MedianEstimator`).
+///
 template <
     typename InputT,
     typename TransformedT,
@@ -200,7 +207,8 @@ public:
         size_t colIndex,
         bool withCentering,
         float qRangeMin=Traits<std::float_t>::CreateNullValue(),
-        float qRangeMax=Traits<std::float_t>::CreateNullValue()
+        float qRangeMax=Traits<std::float_t>::CreateNullValue(),
+        float medianRankError=Traits<std::float_t>::CreateNullValue()
     );
     ~RobustScalerEstimator(void) override = default;
 
@@ -278,22 +286,31 @@ void RobustScalerTransformer<InputT, TransformedT>::save(Archive &ar) const /*ov
 
 template <typename InputT, typename TransformedT>
 void RobustScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+    callback(transform(input));
+}
+
+template <typename InputT, typename TransformedT>
+void RobustScalerTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInput, size_t cInput, typename BaseType::TransformedType *pOutput) /*override*/ {
+    for(size_t index = 0; index < cInput; ++index)
+        pOutput[index] = transform(pInput[index]);
+}
+
+template <typename InputT, typename TransformedT>
+TransformedT RobustScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input) const {
 
 #if (defined __clang__)
 #   pragma clang diagnostic push
 #   pragma clang diagnostic ignored "-Wfloat-equal"
 #endif
 
-    if (Scale != static_cast<TransformedT>(0)) {
-        callback((static_cast<TransformedT>(input) - Median) / Scale);
-        return;
-    }
+    if (Scale != static_cast<TransformedT>(0))
+        return (static_cast<TransformedT>(input) - Median) / Scale;
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
 #endif
 
-    callback(static_cast<TransformedT>(input) - Median);
+    return static_cast<TransformedT>(input) - Median;
 }
 
 // ----------------------------------------------------------------------
@@ -385,11 +402,11 @@ void Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItem
 // |
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT, size_t MaxNumTrainingItemsV>
-RobustScalerEstimator<InputT, TransformedT, MaxNumTrainingItemsV>::RobustScalerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering, float qRangeMin, float qRangeMax) :
+RobustScalerEstimator<InputT, TransformedT, MaxNumTrainingItemsV>::RobustScalerEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, bool withCentering, float qRangeMin, float qRangeMax, float medianRankError) :
     BaseType(
         "RobustScalerEstimator",
         pAllColumnAnnotations,
-        [pAllColumnAnnotations, colIndex](void) { return Components::MedianEstimator<InputT, TransformedT, true, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
+        [pAllColumnAnnotations, colIndex, &medianRankError](void) { return Components::MedianEstimator<InputT, TransformedT, true, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex), true, std::move(medianRankError)); },
         [pAllColumnAnnotations, colIndex](void) { return Components::StatisticalMetricsEstimator<InputT, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex)); },
         [pAllColumnAnnotations, colIndex, &withCentering, &qRangeMin, &qRangeMax](void) { return Details::RobustScalerEstimatorImpl<InputT, TransformedT, MaxNumTrainingItemsV>(std::move(pAllColumnAnnotations), std::move(colIndex), std::move(withCentering), std::move(qRangeMin), std::move(qRangeMax)); }
     ) {
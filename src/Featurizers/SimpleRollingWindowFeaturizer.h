@@ -9,8 +9,8 @@
 #include "../Traits.h"
 
 #include "Base/RollingWindowTransformerBase.h"
-#include "Calculators/MaxCalculator.h"
-#include "Calculators/MinCalculator.h"
+#include "Calculators/RollingMaxCalculator.h"
+#include "Calculators/RollingMinCalculator.h"
 #include "Components/FilterDecoratorFeaturizer.h"
 #include "Components/GrainFeaturizerImpl.h"
 #include "Components/InferenceOnlyFeaturizerImpl.h"
@@ -194,17 +194,24 @@ public:
 template <typename InputT, size_t MaxNumTrainingItemsV>
 SimpleRollingWindowTransformer<InputT, MaxNumTrainingItemsV>::SimpleRollingWindowTransformer(SimpleRollingWindowCalculation windowCalculation, std::uint32_t horizon, std::uint32_t maxWindowSize, std::uint32_t minWindowSize) :
     BaseType(
-        [windowCalculation] () -> typename BaseType::CalculatorFunction {
+        [windowCalculation] (std::uint32_t windowSize) -> typename BaseType::WindowCalculatorFunction {
             if (windowCalculation == SimpleRollingWindowCalculation::Min) {
-                return [] (typename Components::CircularBuffer<InputT>::iterator begin, typename Components::CircularBuffer<InputT>::iterator end) {
-                    return Calculators::MinCalculator<InputT>::execute(begin, end);
+                Calculators::RollingMinCalculator<InputT>   calculator(windowSize);
+
+                return [calculator] (InputT const &value) mutable -> typename Traits<InputT>::nullable_type {
+                    calculator.update(value);
+                    return calculator.commit();
                 };
             } else {
-                return [] (typename Components::CircularBuffer<InputT>::iterator begin, typename Components::CircularBuffer<InputT>::iterator end) {
-                    return Calculators::MaxCalculator<InputT>::execute(begin, end);
+                Calculators::RollingMaxCalculator<InputT>   calculator(windowSize);
+
+                return [calculator] (InputT const &value) mutable -> typename Traits<InputT>::nullable_type {
+                    calculator.update(value);
+                    return calculator.commit();
                 };
             }
-        }(),
+        },
+        static_cast<std::uint8_t>(windowCalculation),
         std::move(horizon),
         std::move(maxWindowSize),
         std::move(minWindowSize)),
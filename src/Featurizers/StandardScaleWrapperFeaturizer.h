@@ -61,12 +61,13 @@ private:
     // |
     // ----------------------------------------------------------------------
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+    void execute_batch_impl(typename BaseType::InputType const *pInput, size_t cInput, typename BaseType::TransformedType *pOutput) override;
 
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::true_type);
-    void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::false_type);
+    TransformedT transform(typename BaseType::InputType const &input, std::true_type) const;
+    TransformedT transform(typename BaseType::InputType const &input, std::false_type) const;
 
     template <typename U>
-    void execute_implex(U const &input, typename BaseType::CallbackFunction const &callback);
+    TransformedT transform_value(U const &input) const;
 };
 
 namespace Details {
@@ -261,11 +262,17 @@ bool StandardScalerTransformer<InputT, TransformedT>::operator==(StandardScalerT
 // ----------------------------------------------------------------------
 template <typename InputT, typename TransformedT>
 void StandardScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
-    execute_impl(input, callback, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
+    callback(transform(input, std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>()));
 }
 
 template <typename InputT, typename TransformedT>
-void StandardScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::true_type) {
+void StandardScalerTransformer<InputT, TransformedT>::execute_batch_impl(typename BaseType::InputType const *pInput, size_t cInput, typename BaseType::TransformedType *pOutput) /*override*/ {
+    for(size_t index = 0; index < cInput; ++index)
+        pOutput[index] = transform(pInput[index], std::integral_constant<bool, Microsoft::Featurizer::Traits<InputT>::IsNullableType>());
+}
+
+template <typename InputT, typename TransformedT>
+TransformedT StandardScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input, std::true_type) const {
     // ----------------------------------------------------------------------
     using InputTraits                       = Traits<InputT>;
     using TransformedTraits                 = Traits<TransformedT>;
@@ -273,23 +280,21 @@ void StandardScalerTransformer<InputT, TransformedT>::execute_impl(typename Base
 
     // TODO: Implement different strategies to handle nulls
     // potential strategies can be returning 0s for nulls, throwing errors, returning nulls for nulls
-    if(InputTraits::IsNull(input)) {
-        callback(TransformedTraits::CreateNullValue());
-        return;
-    }
+    if(InputTraits::IsNull(input))
+        return TransformedTraits::CreateNullValue();
 
-    execute_implex(InputTraits::GetNullableValue(input), callback);
+    return transform_value(InputTraits::GetNullableValue(input));
 }
 
 template <typename InputT, typename TransformedT>
-void StandardScalerTransformer<InputT, TransformedT>::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback, std::false_type) {
-    execute_implex(input, callback);
+TransformedT StandardScalerTransformer<InputT, TransformedT>::transform(typename BaseType::InputType const &input, std::false_type) const {
+    return transform_value(input);
 }
 
 template <typename InputT, typename TransformedT>
 template <typename U>
-void StandardScalerTransformer<InputT, TransformedT>::execute_implex(U const &input, typename BaseType::CallbackFunction const &callback) {
-    callback((static_cast<TransformedT>(input) - _average) / _deviation);
+TransformedT StandardScalerTransformer<InputT, TransformedT>::transform_value(U const &input) const {
+    return (static_cast<TransformedT>(input) - _average) / _deviation;
 }
 
 // ----------------------------------------------------------------------
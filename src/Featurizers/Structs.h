@@ -101,6 +101,16 @@ public:
     bool operator!=(SingleValueSparseVectorEncoding const &other) const;
 };
 
+/////////////////////////////////////////////////////////////////////////
+///  \fn            CreateSparseMatrix
+///  \brief         Creates a compressed sparse row (CSR) matrix where each row
+///                 is populated by a `SparseVectorEncoding` (for example, the
+///                 output of `TfidfVectorizerTransformer`) without creating
+///                 the dense vectors.
+///
+template <typename T>
+SparseRowMajMatrix<T> CreateSparseMatrix(SparseVectorEncoding<T> const *pVectors, size_t cVectors);
+
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
@@ -275,6 +285,60 @@ bool SingleValueSparseVectorEncoding<T>::operator!=(SingleValueSparseVectorEncod
     return (*this == other) == false;
 }
 
+// ----------------------------------------------------------------------
+// |
+// |  CreateSparseMatrix
+// |
+// ----------------------------------------------------------------------
+template <typename T>
+SparseRowMajMatrix<T> CreateSparseMatrix(SparseVectorEncoding<T> const *pVectors, size_t cVectors) {
+    using StorageIndex                      = typename SparseRowMajMatrix<T>::StorageIndex;
+
+    if(pVectors == nullptr)
+        throw std::invalid_argument("pVectors");
+    if(cVectors == 0)
+        throw std::invalid_argument("cVectors");
+
+    SparseVectorEncoding<T> const * const   pEndVectors(pVectors + cVectors);
+    std::uint64_t const                     numElements(pVectors->NumElements);
+    std::uint64_t                           numValues(0);
+
+    for(SparseVectorEncoding<T> const *pVector = pVectors; pVector != pEndVectors; ++pVector) {
+        if(pVector->NumElements != numElements)
+            throw std::invalid_argument("'NumElements' values are inconsistent");
+
+        // The values are ordered by index, so only the last one needs to be
+        // checked
+        if(pVector->Values.empty() == false && pVector->Values.back().Index >= numElements)
+            throw std::invalid_argument("Index");
+
+        numValues += pVector->Values.size();
+    }
+
+    if(
+        numElements > static_cast<std::uint64_t>(std::numeric_limits<StorageIndex>::max())
+        || numValues > static_cast<std::uint64_t>(std::numeric_limits<StorageIndex>::max())
+    )
+        throw std::invalid_argument("The matrix is too large");
+
+    SparseRowMajMatrix<T>                   result(static_cast<Eigen::Index>(cVectors), static_cast<Eigen::Index>(numElements));
+
+    result.reserve(static_cast<Eigen::Index>(numValues));
+
+    // The values in each vector are ordered by index, so they can be appended
+    // to the matrix directly
+    for(Eigen::Index row = 0; row < static_cast<Eigen::Index>(cVectors); ++row) {
+        result.startVec(row);
+
+        for(auto const &value : pVectors[row].Values)
+            result.insertBack(row, static_cast<Eigen::Index>(value.Index)) = value.Value;
+    }
+
+    result.finalize();
+
+    return result;
+}
+
 } // namespace Featurizers
 } // namespace Featurizer
 } // namespace Microsoft
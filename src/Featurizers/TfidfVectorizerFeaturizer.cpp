@@ -10,6 +10,66 @@ namespace Microsoft {
 namespace Featurizer {
 namespace Featurizers {
 
+namespace {
+
+/// Scratch buffers used by `TfidfVectorizerTransformer::ScoreDocument`. `TermCounts`
+/// is indexed by term id and is zero for every term that isn't in `DocumentTerms`,
+/// `DocumentTerms` contains the ids of the terms encountered in the current document
+/// and `DocumentWeights` contains the (unnormalized) tfidf values of those terms.
+struct ExecuteScratch {
+    std::vector<std::uint32_t>              TermCounts;
+    std::vector<std::uint32_t>              DocumentTerms;
+    std::vector<std::float_t>               DocumentWeights;
+};
+
+ExecuteScratch & GetExecuteScratch(void) {
+    static thread_local ExecuteScratch      scratch;
+
+    return scratch;
+}
+
+/// Returns the L1 norm (if `squared` is false) or the squared L2 norm (if
+/// `squared` is true) of the values. Partial sums are kept in independent
+/// accumulators so that the loop can be pipelined and vectorized.
+std::float_t CalculateNorm(std::float_t const *pValues, size_t cValues, bool squared) {
+    std::float_t                            sums[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    std::float_t const * const              pEnd(pValues + cValues);
+    std::float_t const * const              pBlockEnd(pValues + (cValues & ~static_cast<size_t>(3)));
+
+    if(squared) {
+        while(pValues != pBlockEnd) {
+            sums[0] += pValues[0] * pValues[0];
+            sums[1] += pValues[1] * pValues[1];
+            sums[2] += pValues[2] * pValues[2];
+            sums[3] += pValues[3] * pValues[3];
+            pValues += 4;
+        }
+
+        while(pValues != pEnd) {
+            sums[0] += *pValues * *pValues;
+            ++pValues;
+        }
+    }
+    else {
+        while(pValues != pBlockEnd) {
+            sums[0] += pValues[0];
+            sums[1] += pValues[1];
+            sums[2] += pValues[2];
+            sums[3] += pValues[3];
+            pValues += 4;
+        }
+
+        while(pValues != pEnd) {
+            sums[0] += *pValues;
+            ++pValues;
+        }
+    }
+
+    return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+} // anonymous namespace
+
 // ----------------------------------------------------------------------
 // |
 // |  TfidfVectorizerTransformer
@@ -25,35 +85,31 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(IndexMap labels,
                                                        std::string regexToken,
                                                        std::uint32_t ngramRangeMin,
                                                        std::uint32_t ngramRangeMax) :
-    _labels(
-        std::move(
+    TfidfVectorizerTransformer(
+        CreateVocabulary(
             [&labels](void) ->  IndexMap & {
                 if (labels.size() == 0) {
                     throw std::invalid_argument("Index map is empty!");
                 }
                 return labels;
-            }()
-        )
-    ),
-    _documentFreq(
-        std::move(
+            }(),
             [&docuFreq](void) ->  IndexMap & {
                 if (docuFreq.size() == 0) {
                     throw std::invalid_argument("DocumentFrequency map is empty!");
                 }
                 return docuFreq;
-            }()
-        )
-    ),
-    _totalNumsDocuments(std::move(totalNumDocus)),
-    _norm(std::move(norm)),
-    _tfidfParameters(std::move(tfidfParameters)),
-    _lowercase(std::move(lowercase)),
-    _analyzer(std::move(analyzer)),
-    _regexToken(std::move(regexToken)),
-    _ngramRangeMin(std::move(ngramRangeMin)),
-    _ngramRangeMax(std::move(ngramRangeMax)),
-    _parseFunc(Components::DocumentParseFuncGenerator(_analyzer, _regexToken, _ngramRangeMin, _ngramRangeMax)) {
+            }(),
+            tfidfParameters
+        ),
+        std::move(totalNumDocus),
+        std::move(norm),
+        std::move(tfidfParameters),
+        std::move(lowercase),
+        std::move(analyzer),
+        std::move(regexToken),
+        std::move(ngramRangeMin),
+        std::move(ngramRangeMax)
+    ) {
 }
 
 TfidfVectorizerTransformer::TfidfVectorizerTransformer(Archive &ar) :
@@ -63,12 +119,41 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(Archive &ar) :
             std::uint16_t                   majorVersion(Traits<std::uint16_t>::deserialize(ar));
             std::uint16_t                   minorVersion(Traits<std::uint16_t>::deserialize(ar));
 
-            if(majorVersion != 1 || minorVersion != 0)
+            if(majorVersion != 1 || minorVersion > 1)
                 throw std::runtime_error("Unsupported archive version");
 
             // Data
-            IndexMap                       labels(Traits<IndexMap>::deserialize(ar));
-            FrequencyMap                   docuFreq(Traits<FrequencyMap>::deserialize(ar));
+
+            // Version 1.0 archives contain the vocabulary as maps
+            if(minorVersion == 0) {
+                IndexMap                   labels(Traits<IndexMap>::deserialize(ar));
+                FrequencyMap               docuFreq(Traits<FrequencyMap>::deserialize(ar));
+                std::uint32_t              totalNumDocus(Traits<std::uint32_t >::deserialize(ar));
+                NormMethod                 norm(static_cast<NormMethod>(Traits<std::underlying_type<NormMethod>::type>::deserialize(ar)));
+                TfidfPolicy                tfidfParameters(static_cast<TfidfPolicy>(Traits<std::underlying_type<TfidfPolicy>::type>::deserialize(ar)));
+                bool                       lowercase(Traits<bool>::deserialize(ar));
+                AnalyzerMethod             analyzer(static_cast<AnalyzerMethod>(Traits<std::underlying_type<AnalyzerMethod>::type>::deserialize(ar)));
+                std::string                regexToken(Traits<std::string>::deserialize(ar));
+                std::uint32_t              ngramRangeMin(Traits<std::uint32_t>::deserialize(ar));
+                std::uint32_t              ngramRangeMax(Traits<std::uint32_t>::deserialize(ar));
+
+                return TfidfVectorizerTransformer(
+                            std::move(labels),
+                            std::move(docuFreq),
+                            std::move(totalNumDocus),
+                            std::move(norm),
+                            std::move(tfidfParameters),
+                            std::move(lowercase),
+                            std::move(analyzer),
+                            std::move(regexToken),
+                            std::move(ngramRangeMin),
+                            std::move(ngramRangeMax)
+                        );
+            }
+
+            Components::FrozenIndexMap     terms(ar);
+            std::vector<std::uint32_t>     indexes(Traits<std::vector<std::uint32_t>>::deserialize(ar));
+            std::vector<std::uint32_t>     documentFreqs(Traits<std::vector<std::uint32_t>>::deserialize(ar));
             std::uint32_t                  totalNumDocus(Traits<std::uint32_t >::deserialize(ar));
             NormMethod                     norm(static_cast<NormMethod>(Traits<std::underlying_type<NormMethod>::type>::deserialize(ar)));
             TfidfPolicy                    tfidfParameters(static_cast<TfidfPolicy>(Traits<std::underlying_type<TfidfPolicy>::type>::deserialize(ar)));
@@ -79,8 +164,7 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(Archive &ar) :
             std::uint32_t                  ngramRangeMax(Traits<std::uint32_t>::deserialize(ar));
 
             return TfidfVectorizerTransformer(
-                        std::move(labels),
-                        std::move(docuFreq),
+                        Vocabulary(std::move(terms), std::move(indexes), std::move(documentFreqs)),
                         std::move(totalNumDocus),
                         std::move(norm),
                         std::move(tfidfParameters),
@@ -94,14 +178,68 @@ TfidfVectorizerTransformer::TfidfVectorizerTransformer(Archive &ar) :
     ) {
 }
 
+TfidfVectorizerTransformer::TfidfVectorizerTransformer(Vocabulary vocabulary,
+                                                       std::uint32_t totalNumDocus,
+                                                       NormMethod norm,
+                                                       TfidfPolicy tfidfParameters,
+                                                       bool lowercase,
+                                                       AnalyzerMethod analyzer,
+                                                       std::string regexToken,
+                                                       std::uint32_t ngramRangeMin,
+                                                       std::uint32_t ngramRangeMax) :
+    _vocabulary(std::move(vocabulary)),
+    _totalNumsDocuments(std::move(totalNumDocus)),
+    _norm(std::move(norm)),
+    _tfidfParameters(std::move(tfidfParameters)),
+    _lowercase(std::move(lowercase)),
+    _analyzer(std::move(analyzer)),
+    _regexToken(std::move(regexToken)),
+    _ngramRangeMin(std::move(ngramRangeMin)),
+    _ngramRangeMax(std::move(ngramRangeMax)),
+    _tokenizer(_lowercase, _analyzer, _regexToken, _ngramRangeMin, _ngramRangeMax),
+    _termIdfs(
+        [this](void) {
+            bool const                      useIdf((_tfidfParameters & TfidfPolicy::UseIdf) == TfidfPolicy::UseIdf);
+            bool const                      smoothIdf((_tfidfParameters & TfidfPolicy::SmoothIdf) == TfidfPolicy::SmoothIdf);
+
+            std::vector<std::float_t>       result;
+
+            result.reserve(_vocabulary.DocumentFreqs.size());
+
+            for(std::uint32_t documentFreq : _vocabulary.DocumentFreqs) {
+                double                      idf;
+
+                //calculate idf(inverse document frequency) which measures how important a term is. While computing TF,
+                //all terms are considered equally important. However it is known that certain terms, such as "is", "of",
+                //and "that", may appear a lot of times but have little importance. Thus we need to weigh down the frequent
+                //terms while scale up the rare ones, by computing the following:
+                //IDF(t) = log_e(Total number of documents / Number of documents with term t in it).
+                //source:http://www.tfidf.com/
+                if (!useIdf) {
+                    idf = 1.0;
+                } else if (smoothIdf) {
+                    idf = 1.0 + std::log((1 + _totalNumsDocuments) / (1.0 + documentFreq));
+                } else {
+                    idf = 1.0 + std::log((1 + _totalNumsDocuments) / (0.0 + documentFreq));
+                }
+
+                result.emplace_back(static_cast<std::float_t>(idf));
+            }
+
+            return result;
+        }()
+    ) {
+}
+
 void TfidfVectorizerTransformer::save(Archive &ar) const /*override*/ {
     // Version
     Traits<std::uint16_t>::serialize(ar, 1); // Major
-    Traits<std::uint16_t>::serialize(ar, 0); // Minor
+    Traits<std::uint16_t>::serialize(ar, 1); // Minor
 
     // Data
-    Traits<decltype(_labels)>::serialize(ar, _labels);
-    Traits<decltype(_documentFreq)>::serialize(ar, _documentFreq);
+    _vocabulary.Terms.save(ar);
+    Traits<decltype(_vocabulary.Indexes)>::serialize(ar, _vocabulary.Indexes);
+    Traits<decltype(_vocabulary.DocumentFreqs)>::serialize(ar, _vocabulary.DocumentFreqs);
     Traits<decltype(_totalNumsDocuments)>::serialize(ar, _totalNumsDocuments);
     Traits<std::underlying_type<NormMethod>::type>::serialize(ar, static_cast<std::underlying_type<NormMethod>::type>(_norm));
     Traits<std::underlying_type<TfidfPolicy>::type>::serialize(ar, static_cast<std::underlying_type<TfidfPolicy>::type>(_tfidfParameters));
@@ -113,8 +251,9 @@ void TfidfVectorizerTransformer::save(Archive &ar) const /*override*/ {
 }
 
 bool TfidfVectorizerTransformer::operator==(TfidfVectorizerTransformer const &other) const {
-    return _labels == other._labels
-        && _documentFreq == other._documentFreq
+    return _vocabulary.Terms == other._vocabulary.Terms
+        && _vocabulary.Indexes == other._vocabulary.Indexes
+        && _vocabulary.DocumentFreqs == other._vocabulary.DocumentFreqs
         && _totalNumsDocuments == other._totalNumsDocuments
         && _norm == other._norm
         && _tfidfParameters == other._tfidfParameters
@@ -128,79 +267,80 @@ bool TfidfVectorizerTransformer::operator==(TfidfVectorizerTransformer const &ot
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-void TfidfVectorizerTransformer::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+std::float_t TfidfVectorizerTransformer::ScoreDocument(char const *pInput, size_t cInput) {
+    ExecuteScratch &                        scratch(GetExecuteScratch());
+    std::vector<std::uint32_t> &            termCounts(scratch.TermCounts);
+    std::vector<std::uint32_t> &            documentTerms(scratch.DocumentTerms);
+    std::vector<std::float_t> &             documentWeights(scratch.DocumentWeights);
+
+    // Reset the scratch buffers here (rather than at the end of the method) so
+    // that they are valid even if a previous invocation threw an exception.
+    for(std::uint32_t termId : documentTerms)
+        termCounts[termId] = 0;
+
+    documentTerms.clear();
+
+    // The buffers are shared by all transformers on this thread, so they may have
+    // been sized for a smaller vocabulary.
+    if(termCounts.size() < _vocabulary.Indexes.size())
+        termCounts.resize(_vocabulary.Indexes.size(), 0);
+
     //termfrequency for specific document
-    MapWithIterRange documentTermFrequency;
-
-    std::string processedInput = Components::DocumentDecorator(input, _lowercase, _analyzer, _regexToken, _ngramRangeMin, _ngramRangeMax);
-
-    _parseFunc(
-        processedInput,
-        [&documentTermFrequency] (std::string::const_iterator iterStart, std::string::const_iterator iterEnd) {
-            MapWithIterRange::iterator docuTermFreqIter(documentTermFrequency.find(std::make_tuple(iterStart, iterEnd)));
-            if (docuTermFreqIter != documentTermFrequency.end()) {
-                ++docuTermFreqIter->second;
-            } else {
-                documentTermFrequency.insert(std::make_pair(std::make_tuple(iterStart, iterEnd), 1));
-            }
+    _tokenizer.Tokenize(
+        pInput,
+        cInput,
+        [this, &termCounts, &documentTerms] (std::string::const_iterator iterStart, std::string::const_iterator iterEnd) {
+            std::uint32_t const             termId(FindTerm(iterStart, iterEnd));
+
+            if(termId == InvalidTermId)
+                return;
+
+            if(termCounts[termId]++ == 0)
+                documentTerms.emplace_back(termId);
         }
     );
 
-    std::float_t normVal = 0.0f;
-    std::vector<std::tuple<std::uint32_t, std::float_t>> results;
-    for (auto const & wordIteratorPair : documentTermFrequency) {
-        std::string const word(std::string(std::get<0>(wordIteratorPair.first), std::get<1>(wordIteratorPair.first)));
-
-        IndexMap::const_iterator const      labelIter(_labels.find(word));
-
-        if (labelIter != _labels.end()) {
-
-            double tf;
-            double idf;
-
-            //calculate tf(term frequency) which measures how frequently a term occurs in a document.
-            //Since every document is different in length, it is possible that a term would appear much more times
-            //in long documents than shorter ones. Thus, the term frequency is often divided by the document length
-            //(aka. the total number of terms in the document) as a way of normalization:
-            //TF(t) = (Number of times term t appears in a document) / (Total number of terms in the document)
-            //source:http://www.tfidf.com/
-            if ((_tfidfParameters & TfidfPolicy::Binary) == TfidfPolicy::Binary) {
-                tf = 1.0;
-            } else if (!((_tfidfParameters & TfidfPolicy::SublinearTf) == TfidfPolicy::SublinearTf)) {
-                tf = wordIteratorPair.second;
-            } else {
-                tf = 1.0 + std::log(wordIteratorPair.second);
-            }
+    bool const                              isBinary((_tfidfParameters & TfidfPolicy::Binary) == TfidfPolicy::Binary);
+    bool const                              isSublinearTf((_tfidfParameters & TfidfPolicy::SublinearTf) == TfidfPolicy::SublinearTf);
 
-            //calculate idf(inverse document frequency) which measures how important a term is. While computing TF,
-            //all terms are considered equally important. However it is known that certain terms, such as "is", "of",
-            //and "that", may appear a lot of times but have little importance. Thus we need to weigh down the frequent
-            //terms while scale up the rare ones, by computing the following:
-            //IDF(t) = log_e(Total number of documents / Number of documents with term t in it).
-            //source:http://www.tfidf.com/
-            if (!((_tfidfParameters & TfidfPolicy::UseIdf) == TfidfPolicy::UseIdf)) {
-                idf = 1.0;
-            } else if ((_tfidfParameters & TfidfPolicy::SmoothIdf) == TfidfPolicy::SmoothIdf) {
-                idf = 1.0 + std::log((1 + _totalNumsDocuments) / (1.0 + _documentFreq.at(word)));
-            } else {
-                idf = 1.0 + std::log((1 + _totalNumsDocuments) / (0.0 + _documentFreq.at(word)));
-            }
+    // Term ids are assigned in the order of the output index, so sorting the ids
+    // means that the results don't need to be sorted.
+    std::sort(documentTerms.begin(), documentTerms.end());
 
-            //calculate tfidf (tfidf = tf * idf)
-            std::float_t tfidf = static_cast<std::float_t>(tf * idf);
+    documentWeights.resize(documentTerms.size());
 
-            //calculate normVal
-            if(_norm == NormMethod::L1) {
-                assert(tfidf >= 0.0f);
-                normVal += tfidf;
-            } else if (_norm == NormMethod::L2) {
-                normVal += tfidf * tfidf;
-            }
+    std::float_t * const                    pWeights(documentWeights.data());
+
+    for (size_t i = 0; i < documentTerms.size(); ++i) {
+        std::uint32_t const                 termId(documentTerms[i]);
+        std::uint32_t const                 count(termCounts[termId]);
+        std::float_t                        tf;
 
-            //temperarily put output in a vector for future normalization
-            results.emplace_back(std::make_tuple(labelIter->second, tfidf));
+        //calculate tf(term frequency) which measures how frequently a term occurs in a document.
+        //Since every document is different in length, it is possible that a term would appear much more times
+        //in long documents than shorter ones. Thus, the term frequency is often divided by the document length
+        //(aka. the total number of terms in the document) as a way of normalization:
+        //TF(t) = (Number of times term t appears in a document) / (Total number of terms in the document)
+        //source:http://www.tfidf.com/
+        if (isBinary) {
+            tf = 1.0f;
+        } else if (!isSublinearTf) {
+            tf = static_cast<std::float_t>(count);
+        } else {
+            tf = static_cast<std::float_t>(1.0 + std::log(count));
         }
+
+        //calculate tfidf (tfidf = tf * idf); idf is calculated when the transformer is created.
+        //Values are temperarily put in a buffer for future normalization
+        pWeights[i] = tf * _termIdfs[termId];
     }
+
+    //calculate normVal
+    std::float_t normVal = 0.0f;
+
+    if(_norm == NormMethod::L1 || _norm == NormMethod::L2)
+        normVal = CalculateNorm(pWeights, documentWeights.size(), _norm == NormMethod::L2);
+
      //normVal will be zero when the input is empty
     if (_norm == NormMethod::L1 || _norm == NormMethod::L2)
         assert(normVal >= 0.0f);
@@ -214,19 +354,132 @@ void TfidfVectorizerTransformer::execute_impl(typename BaseType::InputType const
     if (_norm == NormMethod::None)
         normVal = 1.0;
 
+    return normVal;
+}
+
+template <typename T>
+size_t TfidfVectorizerTransformer::execute_into_impl(char const *pInput, size_t cInput, std::uint64_t &numElements, T *pValues, std::uint64_t *pIndexes, size_t cValues) {
+    std::float_t const                      normVal(ScoreDocument(pInput, cInput));
+    ExecuteScratch const &                  scratch(GetExecuteScratch());
+    std::vector<std::uint32_t> const &      documentTerms(scratch.DocumentTerms);
+    std::float_t const * const              pWeights(scratch.DocumentWeights.data());
+
+    numElements = _vocabulary.Terms.size();
+
+    if(documentTerms.size() <= cValues) {
+        for (size_t i = 0; i < documentTerms.size(); ++i) {
+            *pValues++ = static_cast<T>(pWeights[i] / normVal);
+            *pIndexes++ = _vocabulary.Indexes[documentTerms[i]];
+        }
+    }
+
+    return documentTerms.size();
+}
+
+size_t TfidfVectorizerTransformer::execute_into(char const *pInput, size_t cInput, std::uint64_t &numElements, std::float_t *pValues, std::uint64_t *pIndexes, size_t cValues) {
+    return execute_into_impl(pInput, cInput, numElements, pValues, pIndexes, cValues);
+}
+
+size_t TfidfVectorizerTransformer::execute_into(char const *pInput, size_t cInput, std::uint64_t &numElements, std::uint32_t *pValues, std::uint64_t *pIndexes, size_t cValues) {
+    return execute_into_impl(pInput, cInput, numElements, pValues, pIndexes, cValues);
+}
+
+void TfidfVectorizerTransformer::execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) /*override*/ {
+    std::float_t const                      normVal(ScoreDocument(input.data(), input.size()));
+    ExecuteScratch const &                  scratch(GetExecuteScratch());
+    std::vector<std::uint32_t> const &      documentTerms(scratch.DocumentTerms);
+    std::float_t const * const              pWeights(scratch.DocumentWeights.data());
+
     std::vector<SparseVectorEncoding<std::float_t>::ValueEncoding> sparseVector;
 
-    for (auto & result : results) {
-        sparseVector.emplace_back(SparseVectorEncoding<std::float_t>::ValueEncoding(std::get<1>(result) / normVal, std::get<0>(result)));
+    sparseVector.reserve(documentTerms.size());
+
+    for (size_t i = 0; i < documentTerms.size(); ++i) {
+        sparseVector.emplace_back(SparseVectorEncoding<std::float_t>::ValueEncoding(pWeights[i] / normVal, _vocabulary.Indexes[documentTerms[i]]));
     }
 
-    std::sort(sparseVector.begin(), sparseVector.end(),
-        [](SparseVectorEncoding<std::float_t>::ValueEncoding const &a, SparseVectorEncoding<std::float_t>::ValueEncoding const &b) {
-            return a.Index < b.Index;
+    callback(SparseVectorEncoding<std::float_t>(_vocabulary.Terms.size(), std::move(sparseVector)));
+}
+
+TfidfVectorizerTransformer::Vocabulary TfidfVectorizerTransformer::CreateVocabulary(IndexMap const &labels, FrequencyMap const &docuFreq, TfidfPolicy tfidfParameters) {
+    bool const                              useIdf((tfidfParameters & TfidfPolicy::UseIdf) == TfidfPolicy::UseIdf);
+
+    // Assign term ids in the order of the output index
+    std::vector<IndexMap::value_type const *>   sortedLabels;
+
+    sortedLabels.reserve(labels.size());
+
+    for(auto const & kvp : labels)
+        sortedLabels.emplace_back(&kvp);
+
+    std::sort(sortedLabels.begin(), sortedLabels.end(),
+        [](IndexMap::value_type const *pA, IndexMap::value_type const *pB) {
+            return pA->second < pB->second;
         }
     );
 
-    callback(SparseVectorEncoding<std::float_t>(_labels.size(), std::move(sparseVector)));
+    IndexMap                                termIds;
+    std::vector<std::uint32_t>              indexes;
+    std::vector<std::uint32_t>              documentFreqs;
+
+    termIds.reserve(sortedLabels.size());
+    indexes.reserve(sortedLabels.size());
+    documentFreqs.reserve(sortedLabels.size());
+
+    for(IndexMap::value_type const *pLabel : sortedLabels) {
+        FrequencyMap::const_iterator const  freqIter(docuFreq.find(pLabel->first));
+
+        if(freqIter == docuFreq.end() && useIdf)
+            throw std::invalid_argument("A term in the index map is not in the DocumentFrequency map");
+
+        termIds.emplace(pLabel->first, static_cast<std::uint32_t>(indexes.size()));
+        indexes.emplace_back(pLabel->second);
+        documentFreqs.emplace_back(freqIter != docuFreq.end() ? freqIter->second : 0);
+    }
+
+    return Vocabulary(Components::FrozenIndexMap(termIds), std::move(indexes), std::move(documentFreqs));
+}
+
+std::uint32_t TfidfVectorizerTransformer::FindTerm(StringIterator begin, StringIterator end) const {
+    if(begin == end)
+        return _vocabulary.Terms.find(nullptr, 0);
+
+    return _vocabulary.Terms.find(&*begin, static_cast<size_t>(std::distance(begin, end)));
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  TfidfVectorizerTransformer::Vocabulary
+// |
+// ----------------------------------------------------------------------
+TfidfVectorizerTransformer::Vocabulary::Vocabulary(Components::FrozenIndexMap terms, std::vector<std::uint32_t> indexes, std::vector<std::uint32_t> documentFreqs) :
+    Terms(std::move(terms)),
+    Indexes(std::move(indexes)),
+    DocumentFreqs(
+        std::move(
+            [this, &documentFreqs](void) -> std::vector<std::uint32_t> & {
+                if(Terms.size() == 0)
+                    throw std::invalid_argument("Index map is empty!");
+
+                if(Indexes.size() != Terms.size() || documentFreqs.size() != Terms.size())
+                    throw std::invalid_argument("Invalid vocabulary");
+
+                // Term ids must be unique and dense
+                std::vector<bool>           isUsed(Terms.size(), false);
+
+                Terms.enumerate(
+                    [&isUsed](char const *, size_t, std::uint32_t termId) {
+                        if(termId >= isUsed.size() || isUsed[termId])
+                            throw std::invalid_argument("Invalid vocabulary");
+
+                        isUsed[termId] = true;
+                    }
+                );
+
+                return documentFreqs;
+            }()
+        )
+    ) {
 }
 
 } // namespace Featurizers
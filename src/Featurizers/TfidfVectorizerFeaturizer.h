@@ -6,6 +6,7 @@
 
 #include "Components/PipelineExecutionEstimatorImpl.h"
 #include "Components/DocumentStatisticsEstimator.h"
+#include "Components/FrozenIndexMap.h"
 #include "Structs.h"
 #include "../Traits.h"
 #include "../Strings.h"
@@ -37,6 +38,11 @@ constexpr TfidfPolicy operator&(TfidfPolicy const & a, TfidfPolicy const & b);
 ///  \class         TfidfVectorizerTransformer
 ///  \brief         Returns a unique TFIDFStruct for each input.
 ///
+///                 The scratch buffers used while transforming a document are
+///                 reused by all transformers on the same thread (rather than
+///                 stored in the transformer), so a transformer can be used to
+///                 transform documents on multiple threads concurrently.
+///
 class TfidfVectorizerTransformer : public StandardTransformer<std::string, SparseVectorEncoding<std::float_t>> {
 public:
     // ----------------------------------------------------------------------
@@ -86,24 +92,44 @@ public:
 
     bool operator==(TfidfVectorizerTransformer const &other) const;
 
+    /// Transforms the `cInput` characters at `pInput` and writes the values and
+    /// indexes of the result to the caller's buffers rather than creating a
+    /// `SparseVectorEncoding`.
+    /// `numElements` receives the number of elements in the result. Returns the
+    /// number of values; the buffers are only written when `cValues` is large
+    /// enough to hold all of them.
+    size_t execute_into(char const *pInput, size_t cInput, std::uint64_t &numElements, std::float_t *pValues, std::uint64_t *pIndexes, size_t cValues);
+
+    /// Writes the values as integer counts (see `CountVectorizerTransformer`).
+    size_t execute_into(char const *pInput, size_t cInput, std::uint64_t &numElements, std::uint32_t *pValues, std::uint64_t *pIndexes, size_t cValues);
+
 private:
     // ----------------------------------------------------------------------
     // |
     // |  Private Types
     // |
     // ----------------------------------------------------------------------
-    using ParseFunctionType                  = std::function<
-                                                   void (std::string const &,
-                                                   std::function<void (StringIterator, StringIterator)> const &)
-                                               >;
+    /// The vocabulary used during inference. Each term is assigned a dense id
+    /// in the order of its output index; `Indexes` and `DocumentFreqs` are
+    /// indexed by term id.
+    struct Vocabulary {
+        Components::FrozenIndexMap          Terms;
+        std::vector<std::uint32_t>          Indexes;
+        std::vector<std::uint32_t>          DocumentFreqs;
+
+        Vocabulary(Components::FrozenIndexMap terms, std::vector<std::uint32_t> indexes, std::vector<std::uint32_t> documentFreqs);
+
+        FEATURIZER_MOVE_CONSTRUCTOR_ONLY(Vocabulary);
+    };
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    IndexMap const                          _labels;
-    FrequencyMap const                      _documentFreq;
+    static constexpr std::uint32_t          InvalidTermId = Components::FrozenIndexMap::InvalidIndex;
+
+    Vocabulary                              _vocabulary;
     std::uint32_t const                     _totalNumsDocuments;
     NormMethod const                        _norm;
     TfidfPolicy const                       _tfidfParameters;
@@ -115,14 +141,42 @@ private:
     std::uint32_t const                     _ngramRangeMin;
     std::uint32_t const                     _ngramRangeMax;
 
-    ParseFunctionType const                 _parseFunc;
+    Components::DocumentTokenizer           _tokenizer;
+
+    // Idf of each term, indexed by term id
+    std::vector<std::float_t> const         _termIdfs;
 
     // ----------------------------------------------------------------------
     // |
     // |  Private Methods
     // |
     // ----------------------------------------------------------------------
+    TfidfVectorizerTransformer(
+        Vocabulary vocabulary,
+        std::uint32_t totalNumDocus,
+        NormMethod norm,
+        TfidfPolicy tfidfParameters,
+        bool lowercase,
+        AnalyzerMethod analyzer,
+        std::string regexToken,
+        std::uint32_t ngramRangeMin,
+        std::uint32_t ngramRangeMax
+    );
+
     void execute_impl(typename BaseType::InputType const &input, typename BaseType::CallbackFunction const &callback) override;
+
+    /// Computes the (unnormalized) tfidf values of the document's terms in the
+    /// thread's scratch buffers and returns the value used to normalize them.
+    std::float_t ScoreDocument(char const *pInput, size_t cInput);
+
+    template <typename T>
+    size_t execute_into_impl(char const *pInput, size_t cInput, std::uint64_t &numElements, T *pValues, std::uint64_t *pIndexes, size_t cValues);
+
+    /// Creates the vocabulary from the training data.
+    static Vocabulary CreateVocabulary(IndexMap const &labels, FrequencyMap const &docuFreq, TfidfPolicy tfidfParameters);
+
+    /// Returns the id of the term or `InvalidTermId` if the term isn't in the vocabulary.
+    std::uint32_t FindTerm(StringIterator begin, StringIterator end) const;
 };
 
 namespace Details {
@@ -207,6 +207,12 @@ inline void gram_schmidt(MatrixType& mat) {
 ///  \brief         Estimator that reads an annotation created by the `SVDComponentsEstimator`
 ///                 and creates a `SVDTransformer` object.
 ///
+///                 Inputs can be dense matrices or sparse matrices (such as
+///                 `SparseRowMajMatrix`, see `CreateSparseMatrix`); sparse
+///                 inputs are never densified, and only the `numComponents`
+///                 dense projections are created during training. A
+///                 `numComponents` value of 0 keeps min(rows, cols) components.
+///
 template <
     typename InputEigenMatrixT,
     typename OutputEigenMatrixT = typename InputMatrixTypeMapper<InputEigenMatrixT>::OutType,
@@ -227,7 +233,7 @@ public:
     // |  Public Methods
     // |
     // ----------------------------------------------------------------------
-    TruncatedSVDEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, nonstd::optional<unsigned int> seed = nonstd::optional<unsigned int>());
+    TruncatedSVDEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, nonstd::optional<unsigned int> seed = nonstd::optional<unsigned int>(), size_t numComponents=0);
 
     ~TruncatedSVDEstimator(void) override = default;
 
@@ -247,6 +253,7 @@ private:
     // |
     // ----------------------------------------------------------------------
     size_t const                            _colIndex;
+    size_t const                            _numComponents;
 
     EigenMatrix                             _state;
 
@@ -265,6 +272,13 @@ private:
         auto const &                        matrix(*pBuffer);
         Eigen::Index                        rank((matrix.rows() < matrix.cols()) ? matrix.rows() : matrix.cols());
 
+        if(_numComponents != 0) {
+            if(_numComponents > static_cast<size_t>(rank))
+                throw std::invalid_argument("numComponents");
+
+            rank = static_cast<Eigen::Index>(_numComponents);
+        }
+
         // Gaussian Random Matrix for _matrix^T
         EigenMatrix                         O(matrix.rows(), rank);
         sample_gaussian(O);
@@ -382,7 +396,7 @@ std::ptrdiff_t TruncatedSVDTransformer<InputEigenMatrixT, OutputEigenMatrixT>::g
 // |
 // ----------------------------------------------------------------------
 template <typename InputEigenMatrixT, typename OutputEigenMatrixT, size_t MaxNumTrainingItemsV>
-TruncatedSVDEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::TruncatedSVDEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, nonstd::optional<unsigned int> seed) :
+TruncatedSVDEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItemsV>::TruncatedSVDEstimator(AnnotationMapsPtr pAllColumnAnnotations, size_t colIndex, nonstd::optional<unsigned int> seed, size_t numComponents) :
     BaseType("SVDEstimatorImpl", std::move(pAllColumnAnnotations)),
     _colIndex(
         std::move(
@@ -393,7 +407,8 @@ TruncatedSVDEstimator<InputEigenMatrixT, OutputEigenMatrixT, MaxNumTrainingItems
                 return colIndex;
             }()
         )
-    ) {
+    ),
+    _numComponents(std::move(numComponents)) {
     if (seed.has_value())
         std::srand(*seed);
 }
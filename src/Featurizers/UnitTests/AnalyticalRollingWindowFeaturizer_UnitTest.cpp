@@ -173,6 +173,41 @@ TEST_CASE("Mean - int32, window size 2, horizon 2, min window size 2") {
     CHECK(results(0, 1) == 2.5);
 }
 
+TEST_CASE("Mean - compare with full window calculation") {
+    // Calculate each window directly from the inputs
+    std::vector<std::int32_t> const         inputs{5, -3, 8, 8, 1, 0, -7, 12, 4, 4, 9, -2, 6, 3, -1, 10};
+
+    for(std::uint32_t horizon : {1u, 3u, 5u}) {
+        for(std::uint32_t maxWindowSize : {1u, 2u, 4u}) {
+            for(std::uint32_t minWindowSize = 1; minWindowSize <= maxWindowSize; ++minWindowSize) {
+                NS::Featurizers::AnalyticalRollingWindowTransformer<std::int32_t>     transformer(NS::Featurizers::AnalyticalRollingWindowCalculation::Mean, horizon, maxWindowSize, minWindowSize);
+
+                for(size_t numInputs = 1; numInputs <= inputs.size(); ++numInputs) {
+                    OutputType const        results(transformer.execute(inputs[numInputs - 1]));
+
+                    REQUIRE(results.cols() == horizon);
+
+                    for(std::uint32_t offset = 0; offset < horizon; ++offset) {
+                        std::ptrdiff_t const                windowEnd(static_cast<std::ptrdiff_t>(numInputs) - static_cast<std::ptrdiff_t>(horizon - offset));
+
+                        if(windowEnd < static_cast<std::ptrdiff_t>(minWindowSize)) {
+                            CHECK(NS::Traits<MatrixMemberType>::IsNull(results(0, offset)));
+                            continue;
+                        }
+
+                        auto const                          begin(inputs.begin() + std::max(static_cast<std::ptrdiff_t>(0), windowEnd - static_cast<std::ptrdiff_t>(maxWindowSize)));
+                        auto const                          end(inputs.begin() + windowEnd);
+
+                        double const                        expected(static_cast<double>(std::accumulate(begin, end, 0)) / static_cast<double>(end - begin));
+
+                        CHECK(results(0, offset) == Approx(expected));
+                    }
+                }
+            }
+        }
+    }
+}
+
 TEST_CASE("Estimator Mean - int32, window size 2, horizon 2, min window size 2") {
     NS::AnnotationMapsPtr                   pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
     NS::Featurizers::AnalyticalRollingWindowEstimator<std::int32_t>                 estimator(pAllColumnAnnotations, NS::Featurizers::AnalyticalRollingWindowCalculation::Mean, 2, 2, 2);
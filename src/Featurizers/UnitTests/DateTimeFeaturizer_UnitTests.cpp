@@ -263,6 +263,281 @@ TEST_CASE("Pre-Epoch - 1776 July 4", "[DateTimeTransformer][DateTimeTransformer]
 }
 #endif /* _MSVCRT */
 
+TEST_CASE("TimePoint - Labels") {
+    NS::Featurizers::TimePoint              tp(SysClock::from_time_t(217081624));
+
+    // Labels reference the static tables rather than copies
+    CHECK(tp.monthLabel.c_str() == NS::Featurizers::TimePoint::MonthLabels[10].c_str());
+    CHECK(tp.amPmLabel.c_str() == NS::Featurizers::TimePoint::AmPmLabels[1].c_str());
+    CHECK(tp.dayOfWeekLabel.c_str() == NS::Featurizers::TimePoint::DayOfWeekLabels[3].c_str());
+    CHECK(tp.holidayName.empty());
+
+    CHECK(static_cast<std::string>(tp.monthLabel) == "November");
+    CHECK(tp.monthLabel.size() == 8);
+    CHECK(tp.monthLabel != "Nov");
+    CHECK(tp.monthLabel != "Novembers");
+
+    NS::Featurizers::TimePoint              other(tp);
+
+    CHECK(other.monthLabel == "November");
+
+    // Labels can only be explicitly created from strings that outlive them
+    std::string const                       name("Holiday");
+    NS::Featurizers::TimePointLabel const   label(name);
+
+    CHECK(label.c_str() == name.c_str());
+    CHECK((std::is_convertible<std::string, NS::Featurizers::TimePointLabel>::value) == false);
+    CHECK((std::is_constructible<NS::Featurizers::TimePointLabel, std::string>::value) == false);
+}
+
+TEST_CASE("DateTimeTransformer - execute_batch") {
+    std::vector<SysClock::time_point> const     inputs{
+        SysClock::from_time_t(217081624),
+        SysClock::from_time_t(157161600),
+        SysClock::from_time_t(157161599),
+        SysClock::from_time_t(1751241600),
+        SysClock::from_time_t(227813600)
+    };
+
+    NS::Featurizers::DateTimeTransformer    dt("Canada");
+    std::vector<NS::Featurizers::TimePoint> results(inputs.size());
+
+    dt.execute_batch(inputs.data(), inputs.size(), results.data());
+
+    for(size_t index = 0; index < inputs.size(); ++index) {
+        NS::Featurizers::TimePoint const    expected(dt.execute(inputs[index]));
+        NS::Featurizers::TimePoint const &  result(results[index]);
+
+        CHECK(result.year == expected.year);
+        CHECK(result.month == expected.month);
+        CHECK(result.day == expected.day);
+        CHECK(result.hour == expected.hour);
+        CHECK(result.minute == expected.minute);
+        CHECK(result.second == expected.second);
+        CHECK(result.dayOfWeek == expected.dayOfWeek);
+        CHECK(result.dayOfYear == expected.dayOfYear);
+        CHECK(result.weekIso == expected.weekIso);
+        CHECK(result.yearIso == expected.yearIso);
+        CHECK(result.monthLabel == expected.monthLabel);
+        CHECK(result.amPmLabel == expected.amPmLabel);
+        CHECK(result.dayOfWeekLabel == expected.dayOfWeekLabel);
+        CHECK(result.holidayName == expected.holidayName);
+    }
+
+    CHECK(results[1].holidayName == "Christmas Day");
+    CHECK(results[2].holidayName == "1 day before Christmas Day");
+    CHECK(results[4].holidayName.empty());
+
+    // Empty input
+    dt.execute_batch(nullptr, 0, nullptr);
+
+    CHECK_THROWS_WITH(dt.execute_batch(nullptr, 1, results.data()), "pInput");
+    CHECK_THROWS_WITH(dt.execute_batch(inputs.data(), 1, nullptr), "pOutput");
+}
+
+TEST_CASE("DateTimeTransformer - execute_batch columns") {
+    // Every day between 1900 (1970 on Windows) and 2100, at varying times of the day
+#if (defined _MSC_VER)
+    std::int64_t const                      firstDay(0);
+#else
+    std::int64_t const                      firstDay(-25567);
+#endif
+    std::int64_t const                      lastDay(47482);
+
+    std::vector<std::int64_t>               inputs;
+
+    for(std::int64_t day = firstDay; day < lastDay; ++day)
+        inputs.emplace_back(day * 86400 + (day * 7919) % 86400);
+
+    size_t const                            numInputs(inputs.size());
+
+    std::vector<std::int32_t>               year(numInputs);
+    std::vector<std::uint8_t>               month(numInputs);
+    std::vector<std::uint8_t>               day(numInputs);
+    std::vector<std::uint8_t>               hour(numInputs);
+    std::vector<std::uint8_t>               minute(numInputs);
+    std::vector<std::uint8_t>               second(numInputs);
+    std::vector<std::uint8_t>               amPm(numInputs);
+    std::vector<std::uint8_t>               hour12(numInputs);
+    std::vector<std::uint8_t>               dayOfWeek(numInputs);
+    std::vector<std::uint8_t>               dayOfQuarter(numInputs);
+    std::vector<std::uint16_t>              dayOfYear(numInputs);
+    std::vector<std::uint16_t>              weekOfMonth(numInputs);
+    std::vector<std::uint8_t>               quarterOfYear(numInputs);
+    std::vector<std::uint8_t>               halfOfYear(numInputs);
+    std::vector<std::uint8_t>               weekIso(numInputs);
+    std::vector<std::int32_t>               yearIso(numInputs);
+    std::vector<NS::Featurizers::TimePointLabel>    holidayName(numInputs);
+
+    NS::Featurizers::TimePointColumns       columns;
+
+    columns.year = year.data();
+    columns.month = month.data();
+    columns.day = day.data();
+    columns.hour = hour.data();
+    columns.minute = minute.data();
+    columns.second = second.data();
+    columns.amPm = amPm.data();
+    columns.hour12 = hour12.data();
+    columns.dayOfWeek = dayOfWeek.data();
+    columns.dayOfQuarter = dayOfQuarter.data();
+    columns.dayOfYear = dayOfYear.data();
+    columns.weekOfMonth = weekOfMonth.data();
+    columns.quarterOfYear = quarterOfYear.data();
+    columns.halfOfYear = halfOfYear.data();
+    columns.weekIso = weekIso.data();
+    columns.yearIso = yearIso.data();
+    columns.holidayName = holidayName.data();
+
+    NS::Featurizers::DateTimeTransformer    dt("Canada");
+
+    dt.execute_batch(inputs.data(), numInputs, columns);
+
+    size_t                                  numMismatches(0);
+    size_t                                  numHolidays(0);
+
+    for(size_t index = 0; index < numInputs; ++index) {
+        NS::Featurizers::TimePoint const    expected(dt.execute(SysClock::from_time_t(static_cast<time_t>(inputs[index]))));
+
+        if(
+            year[index] != expected.year
+            || month[index] != expected.month
+            || day[index] != expected.day
+            || hour[index] != expected.hour
+            || minute[index] != expected.minute
+            || second[index] != expected.second
+            || amPm[index] != expected.amPm
+            || hour12[index] != expected.hour12
+            || dayOfWeek[index] != expected.dayOfWeek
+            || dayOfQuarter[index] != expected.dayOfQuarter
+            || dayOfYear[index] != expected.dayOfYear
+            || weekOfMonth[index] != expected.weekOfMonth
+            || quarterOfYear[index] != expected.quarterOfYear
+            || halfOfYear[index] != expected.halfOfYear
+            || weekIso[index] != expected.weekIso
+            || yearIso[index] != expected.yearIso
+            || holidayName[index] != expected.holidayName
+        ) {
+            UNSCOPED_INFO(inputs[index]);
+            ++numMismatches;
+        }
+
+        if(holidayName[index].empty() == false)
+            ++numHolidays;
+    }
+
+    CHECK(numMismatches == 0);
+    CHECK(numHolidays != 0);
+
+    // Labels
+    CHECK(NS::Featurizers::TimePoint::MonthLabels[month[0] - 1] == dt.execute(SysClock::from_time_t(static_cast<time_t>(inputs[0]))).monthLabel);
+
+    // Holiday names are optional
+    columns.holidayName = nullptr;
+    dt.execute_batch(inputs.data(), numInputs, columns);
+
+    // Errors
+    CHECK_THROWS_WITH(dt.execute_batch(nullptr, 1, columns), "pSeconds");
+
+    columns.weekIso = nullptr;
+    CHECK_THROWS_WITH(dt.execute_batch(inputs.data(), numInputs, columns), "columns");
+}
+
+TEST_CASE("HolidayTable") {
+    std::vector<unsigned char> const        data(
+        NS::Featurizers::HolidayTable::CreateData(
+            { -86400, 0, 86400 * 5, 86400 * 6, 86400 * 365 },
+            { "Holiday 1", "Holiday 2", "Holiday 1", "", "Holiday 3" }
+        )
+    );
+
+    unsigned char *                         pBuffer(new unsigned char[data.size()]);
+    NS::Featurizers::HolidayTable::DataPtr  pData(pBuffer, std::default_delete<unsigned char []>());
+
+    std::copy(data.begin(), data.end(), pBuffer);
+
+    NS::Featurizers::HolidayTable const     table(pData, data.size());
+
+    CHECK(table.size() == 5);
+    CHECK(table.Find(-1) == "Holiday 1");
+    CHECK(table.Find(0) == "Holiday 2");
+    CHECK(table.Find(1).empty());
+    CHECK(table.Find(5) == "Holiday 1");
+    CHECK(table.Find(6).empty());
+    CHECK(table.Find(365) == "Holiday 3");
+    CHECK(table.Find(366).empty());
+    CHECK(table.Find(static_cast<std::int64_t>(1) << 40).empty());
+
+    // Errors
+    CHECK_THROWS_WITH(NS::Featurizers::HolidayTable::CreateData({ 0 }, {}), "dates and names must have the same number of elements");
+    CHECK_THROWS_WITH(NS::Featurizers::HolidayTable::CreateData({ 10 }, { "Holiday" }), "Dates must be based on midnight");
+    CHECK_THROWS_WITH(NS::Featurizers::HolidayTable::CreateData({ 86400, 0 }, { "Holiday", "Holiday" }), "Dates must be sorted and unique");
+
+    CHECK_THROWS_WITH(NS::Featurizers::HolidayTable(pData, data.size() - 1), "Invalid holiday table size");
+    CHECK_THROWS_WITH(NS::Featurizers::HolidayTable(pData, 4), "Invalid holiday table");
+    CHECK_THROWS_WITH(NS::Featurizers::HolidayTable(NS::Featurizers::HolidayTable::DataPtr(), 0), "pData");
+
+    // A table whose string pool has been truncated, with a header that is
+    // consistent with the truncated size
+    std::uint32_t                           stringPoolSize(0);
+
+    std::memcpy(&stringPoolSize, data.data() + 8 + 3 * sizeof(std::uint32_t), sizeof(stringPoolSize));
+    REQUIRE(stringPoolSize != 0);
+
+    size_t const                            cTruncated(data.size() - stringPoolSize);
+    unsigned char *                         pTruncatedBuffer(new unsigned char[cTruncated]);
+    NS::Featurizers::HolidayTable::DataPtr  pTruncatedData(pTruncatedBuffer, std::default_delete<unsigned char []>());
+
+    std::copy(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(cTruncated), pTruncatedBuffer);
+    std::memset(pTruncatedBuffer + 8 + 3 * sizeof(std::uint32_t), 0, sizeof(std::uint32_t));
+
+    CHECK_THROWS_WITH(NS::Featurizers::HolidayTable(pTruncatedData, cTruncated), "Invalid holiday table string pool");
+}
+
+TEST_CASE("HolidayTable - Binary data") {
+    // The binary data must match the JSON data
+    std::string const                       dataDirectory(NS::Featurizers::GetDateTimeFeaturizerDataDirectory(""));
+
+    for(auto const & country : NS::Featurizers::DateTimeEstimator::GetSupportedCountries()) {
+        std::ifstream                       jsonFile(dataDirectory + country + ".json");
+        nlohmann::json const                json(nlohmann::json::parse(jsonFile));
+        std::vector<unsigned char> const    expected(
+            NS::Featurizers::HolidayTable::CreateData(
+                json.at("Date").get<std::vector<std::int64_t>>(),
+                json.at("Holiday").get<std::vector<std::string>>()
+            )
+        );
+
+        std::ifstream                       binaryFile(dataDirectory + "Binary/" + country + ".bin", std::ios::binary);
+        std::vector<unsigned char> const    actual((std::istreambuf_iterator<char>(binaryFile)), std::istreambuf_iterator<char>());
+
+        INFO(country);
+        CHECK(actual == expected);
+    }
+}
+
+TEST_CASE("HolidayTable - Shared") {
+    NS::Featurizers::HolidayTable::HolidayTablePtr const    pTable(NS::Featurizers::HolidayTable::Get("Canada", ""));
+
+    CHECK(pTable);
+    CHECK(pTable->size() != 0);
+    CHECK(pTable == NS::Featurizers::HolidayTable::Get("Canada", ""));
+    CHECK(*pTable == *NS::Featurizers::HolidayTable::Get("canada", ""));
+    CHECK((*pTable == *NS::Featurizers::HolidayTable::Get("Finland", "")) == false);
+
+    CHECK_THROWS_WITH(NS::Featurizers::HolidayTable::Get("This is not a valid country name", ""), "This is not a valid country name");
+
+    NS::Featurizers::DateTimeTransformer    dt1("Canada");
+    NS::Featurizers::DateTimeTransformer    dt2("canada");
+    NS::Featurizers::DateTimeTransformer    dt3("Finland");
+    NS::Featurizers::DateTimeTransformer    dt4("");
+
+    CHECK(dt1 == dt2);
+    CHECK((dt1 == dt3) == false);
+    CHECK((dt1 == dt4) == false);
+    CHECK(dt4 == NS::Featurizers::DateTimeTransformer(""));
+}
+
 TEST_CASE("Serialization") {
     NS::Featurizers::DateTimeTransformer    original("United States");
     NS::Archive                             out;
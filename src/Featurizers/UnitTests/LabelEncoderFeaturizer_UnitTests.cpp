@@ -171,3 +171,19 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("execute_batch") {
+    using TransformerType                   = NS::Featurizers::LabelEncoderTransformer<std::string>;
+
+    std::vector<std::string> const          inputs{"banana", "hello", "apple"};
+    std::vector<std::uint32_t>              results(inputs.size());
+
+    TransformerType(TransformerType::IndexMap{{"apple", 0}, {"banana", 1}}, true).execute_batch(inputs.data(), inputs.size(), results.data());
+
+    CHECK(results == std::vector<std::uint32_t>{2, 0, 1});
+
+    CHECK_THROWS_WITH(
+        TransformerType(TransformerType::IndexMap{{"apple", 0}, {"banana", 1}}, false).execute_batch(inputs.data(), inputs.size(), results.data()),
+        "'input' was not found"
+    );
+}
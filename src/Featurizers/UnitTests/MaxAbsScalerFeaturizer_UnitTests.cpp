@@ -127,3 +127,20 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("execute_batch") {
+    NS::Featurizers::MaxAbsScalerTransformer<std::int8_t, std::float_t>    transformer(4.0f);
+    std::vector<std::int8_t> const          inputs{-4, 2, 0, 8};
+    std::vector<std::float_t>               results(inputs.size());
+
+    transformer.execute_batch(inputs.data(), inputs.size(), results.data());
+
+    CHECK(results == std::vector<std::float_t>{-1.0f, 0.5f, 0.0f, 2.0f});
+
+    // A scale of 0 passes the values through
+    NS::Featurizers::MaxAbsScalerTransformer<std::int8_t, std::float_t>    zeroTransformer(0.0f);
+
+    zeroTransformer.execute_batch(inputs.data(), inputs.size(), results.data());
+
+    CHECK(results == std::vector<std::float_t>{-4.0f, 2.0f, 0.0f, 8.0f});
+}
@@ -84,3 +84,20 @@ TEST_CASE("No non-empty items") {
 TEST_CASE("Exceptions") {
     CHECK_THROWS_WITH(NS::Featurizers::MeanImputerEstimator<int>(NS::CreateTestAnnotationMapsPtr(1), 10), "colIndex");
 }
+
+TEST_CASE("execute_batch") {
+    using EstimatorType                     = NS::Featurizers::MeanImputerEstimator<int>;
+
+    EstimatorType                           estimator(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+    NS::TestHelpers::Train(estimator, std::vector<nonstd::optional<int>>{1, nonstd::optional<int>(), 4});
+
+    EstimatorType::TransformerUniquePtr     pTransformer(estimator.create_transformer());
+    std::vector<nonstd::optional<int>> const inputs{10, nonstd::optional<int>(), -3};
+    std::vector<double>                     results(inputs.size());
+
+    // The pipeline forwards the batch to the imputer's transformer
+    static_cast<EstimatorType::TransformerType &>(*pTransformer).execute_batch(inputs.data(), inputs.size(), results.data());
+
+    CHECK(results == std::vector<double>{10.0, 2.5, -3.0});
+}
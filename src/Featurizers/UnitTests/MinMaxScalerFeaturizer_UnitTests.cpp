@@ -143,3 +143,31 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("execute_batch") {
+    NS::Featurizers::MinMaxScalerTransformer<std::float_t, std::double_t>  transformer(-1.0f, 1.0f);
+    std::vector<std::float_t> const         inputs{2.0f, -1.0f, 0.0f, NS::Traits<std::float_t>::CreateNullValue()};
+    std::vector<std::double_t>              results(inputs.size());
+
+    transformer.execute_batch(inputs.data(), inputs.size(), results.data());
+
+    CHECK(results[0] == 1.5);
+    CHECK(results[1] == 0.0);
+    CHECK(results[2] == 0.5);
+    CHECK(NS::Traits<std::double_t>::IsNull(results[3]));
+
+    // The results should match those produced one item at a time
+    for(size_t index = 0; index < 3; ++index)
+        CHECK(results[index] == transformer.execute(inputs[index]));
+
+    // Identical min and max values
+    NS::Featurizers::MinMaxScalerTransformer<std::int8_t, std::double_t>   spanTransformer(3, 3);
+    std::int8_t const                       spanInputs[] = {1, 3, 5};
+    std::double_t                           spanResults[3];
+
+    spanTransformer.execute_batch(spanInputs, 3, spanResults);
+
+    CHECK(spanResults[0] == 0.0);
+    CHECK(spanResults[1] == 0.0);
+    CHECK(spanResults[2] == 0.0);
+}
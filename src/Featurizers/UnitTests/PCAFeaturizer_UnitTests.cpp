@@ -377,7 +377,8 @@ TEST_CASE("Invalid_fit ColMajor") {
     PCAEstimator                                       estimator(pAllColumnAnnotations, 0);
 
     estimator.begin_training();
-    estimator.fit(trainingMatrix);
+    CHECK(estimator.fit(trainingMatrix) == NS::FitResult::Continue);
+    estimator.complete_training();
 
     CHECK_THROWS_WITH(estimator.fit(trainingMatrix), "`fit` should not be invoked on an estimator that is not training or is already finished/complete");
 }
@@ -402,7 +403,8 @@ TEST_CASE("Invalid_fit RowMajor") {
     PCAEstimator                                       estimator(pAllColumnAnnotations, 0);
 
     estimator.begin_training();
-    estimator.fit(trainingMatrix);
+    CHECK(estimator.fit(trainingMatrix) == NS::FitResult::Continue);
+    estimator.complete_training();
 
     CHECK_THROWS_WITH(estimator.fit(trainingMatrix), "`fit` should not be invoked on an estimator that is not training or is already finished/complete");
 }
@@ -519,6 +521,167 @@ TEST_CASE("Different training and inferencing data RowMajor") {
     }
 }
 
+TEST_CASE("Chunked training") {
+    using MatrixT = Eigen::MatrixX<double>;
+    using PCAEstimator = NS::Featurizers::PCAEstimator<MatrixT>;
+
+    // Correlated columns with a large offset, which stresses the numerical
+    // stability of the incremental statistics
+    MatrixT trainingMatrix(3000, 4);
+
+    for(Eigen::Index row = 0; row < trainingMatrix.rows(); ++row) {
+        double const                        x(std::sin(static_cast<double>(row)));
+        double const                        y(std::cos(static_cast<double>(row) * 0.37));
+
+        trainingMatrix(row, 0) = 1000.0 + x;
+        trainingMatrix(row, 1) = 1000.0 + 2.0 * x + 0.5 * y;
+        trainingMatrix(row, 2) = 1000.0 - y;
+        trainingMatrix(row, 3) = 1000.0 + 0.1 * x * y;
+    }
+
+    // Expected results are calculated with the entire matrix in memory
+    MatrixT const                           centered(trainingMatrix.rowwise() - trainingMatrix.colwise().mean());
+    Eigen::SelfAdjointEigenSolver<MatrixT>  eig(centered.adjoint() * centered);
+    MatrixT const                           expected(trainingMatrix * eig.eigenvectors().transpose());
+
+    // Chunks of different sizes (some of which span multiple blocks) provided
+    // across multiple calls to `fit`
+    std::vector<std::vector<MatrixT>>       trainingBatches(
+        NS::TestHelpers::make_vector<std::vector<MatrixT>>(
+            NS::TestHelpers::make_vector<MatrixT>(trainingMatrix.topRows(1), trainingMatrix.middleRows(1, 1500)),
+            NS::TestHelpers::make_vector<MatrixT>(trainingMatrix.middleRows(1501, 1024)),
+            NS::TestHelpers::make_vector<MatrixT>(trainingMatrix.bottomRows(475))
+        )
+    );
+
+    std::vector<MatrixT>                    outputContainer(
+        NS::TestHelpers::TransformerEstimatorTest(
+            PCAEstimator(NS::CreateTestAnnotationMapsPtr(1), 0),
+            trainingBatches,
+            NS::TestHelpers::make_vector<MatrixT>(trainingMatrix)
+        )
+    );
+
+    REQUIRE(outputContainer.size() == 1);
+    CHECK((outputContainer[0].cwiseAbs() - expected.cwiseAbs()).norm() / expected.norm() < 1e-9);
+}
+
+TEST_CASE("Chunked training errors") {
+    using MatrixT = Eigen::MatrixX<double>;
+    using PCAEstimator = NS::Featurizers::PCAEstimator<MatrixT>;
+
+    PCAEstimator                            estimator(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+    estimator.begin_training();
+
+    CHECK_THROWS_WITH(estimator.fit(MatrixT()), "Input matrix size() invalid");
+
+    estimator.fit(MatrixT::Ones(3, 2));
+    CHECK_THROWS_WITH(estimator.fit(MatrixT::Ones(3, 3)), "Input matrix cols() invalid");
+
+    PCAEstimator                            empty(NS::CreateTestAnnotationMapsPtr(1), 0);
+
+    empty.begin_training();
+    CHECK_THROWS_WITH(empty.complete_training(), "No training data was provided");
+}
+
+TEST_CASE("Truncated components") {
+    using MatrixT = NS::RowMajMatrix<double>;
+    using PCAEstimator = NS::Featurizers::PCAEstimator<MatrixT>;
+
+    MatrixT trainingMatrix(200, 5);
+
+    for(Eigen::Index row = 0; row < trainingMatrix.rows(); ++row) {
+        double const                        x(std::sin(static_cast<double>(row)));
+        double const                        y(std::cos(static_cast<double>(row) * 0.37));
+
+        trainingMatrix(row, 0) = 3.0 * x;
+        trainingMatrix(row, 1) = x + y;
+        trainingMatrix(row, 2) = 0.1 * y;
+        trainingMatrix(row, 3) = 2.0 * y - x;
+        trainingMatrix(row, 4) = 0.01 * x * y;
+    }
+
+    // The components with the 2 largest eigenvalues, largest first
+    MatrixT const                           centered(trainingMatrix.rowwise() - trainingMatrix.colwise().mean());
+    Eigen::SelfAdjointEigenSolver<MatrixT>  eig(centered.adjoint() * centered);
+    MatrixT const                           expected(trainingMatrix * eig.eigenvectors().rightCols(2).rowwise().reverse());
+
+    std::vector<MatrixT>                    outputContainer(
+        NS::TestHelpers::TransformerEstimatorTest(
+            PCAEstimator(NS::CreateTestAnnotationMapsPtr(1), 0, 2),
+            NS::TestHelpers::make_vector<std::vector<MatrixT>>(NS::TestHelpers::make_vector<MatrixT>(trainingMatrix)),
+            NS::TestHelpers::make_vector<MatrixT>(trainingMatrix)
+        )
+    );
+
+    REQUIRE(outputContainer.size() == 1);
+    REQUIRE(outputContainer[0].cols() == 2);
+    CHECK((outputContainer[0].cwiseAbs() - expected.cwiseAbs()).norm() / expected.norm() < 1e-9);
+
+    // The first component explains the most variance
+    MatrixT const                           projected(centered * eig.eigenvectors().rightCols(2).rowwise().reverse());
+
+    CHECK(projected.col(0).squaredNorm() >= projected.col(1).squaredNorm());
+
+    PCAEstimator                            estimator(NS::CreateTestAnnotationMapsPtr(1), 0, 6);
+
+    estimator.begin_training();
+    estimator.fit(trainingMatrix);
+    CHECK_THROWS_WITH(estimator.complete_training(), "numComponents");
+}
+
+TEST_CASE("Non-square components") {
+    using MatrixT = NS::RowMajMatrix<float>;
+    using TransformerType = NS::Featurizers::PCATransformer<MatrixT>;
+
+    MatrixT components(2, 3);
+
+    components << 1.0f, 0.0f, 0.0f,
+                  0.0f, 0.5f, 0.5f;
+
+    TransformerType                         transformer(components);
+
+    CHECK(transformer.getEigenVectorRowsNumber() == 2);
+    CHECK(transformer.getEigenVectorColsNumber() == 3);
+
+    MatrixT input(4, 3);
+
+    input << 1.0f, 2.0f, 4.0f,
+             3.0f, 0.0f, 2.0f,
+             0.0f, 1.0f, 1.0f,
+             5.0f, 6.0f, 8.0f;
+
+    MatrixT expected(4, 2);
+
+    expected << 1.0f, 3.0f,
+                3.0f, 1.0f,
+                0.0f, 1.0f,
+                5.0f, 7.0f;
+
+    MatrixT output;
+
+    transformer.execute(
+        input,
+        [&output](MatrixT value) {
+            output = std::move(value);
+        }
+    );
+
+    CHECK(output == expected);
+
+    CHECK_THROWS_WITH(transformer.execute(MatrixT(4, 2), [](MatrixT) {}), "Input matrix cols() invalid");
+
+    NS::Archive                             out;
+
+    transformer.save(out);
+
+    NS::Archive                             in(out.commit());
+    TransformerType                         other(in);
+
+    CHECK(other == transformer);
+    CHECK((TransformerType(MatrixT::Identity(3, 3)) == transformer) == false);
+}
 
 TEST_CASE("Serialization/Deserialization ColMajor") {
     using MatrixT = Eigen::MatrixX<float>;
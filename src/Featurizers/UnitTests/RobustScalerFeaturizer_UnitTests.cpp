@@ -286,3 +286,44 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("Sketch median") {
+    std::vector<std::vector<std::double_t>>             trainingBatches;
+
+    for(int value = 1; value <= 9; value += 2)
+        trainingBatches.emplace_back(NS::TestHelpers::make_vector<std::double_t>(static_cast<std::double_t>(value)));
+
+    // Small inputs are retained exactly by the sketch
+    CHECK(
+        NS::TestHelpers::FuzzyCheck(
+            NS::TestHelpers::TransformerEstimatorTest(
+                NS::Featurizers::RobustScalerEstimator<std::double_t, std::double_t>(NS::CreateTestAnnotationMapsPtr(1), 0, true, 25.0f, 75.0f, 0.01f),
+                trainingBatches,
+                NS::TestHelpers::make_vector<std::double_t>(1.0, 5.0, 9.0)
+            ),
+            NS::TestHelpers::make_vector<std::double_t>(-1.0, 0.0, 1.0)
+        )
+    );
+
+    CHECK_THROWS_WITH(
+        (NS::Featurizers::RobustScalerEstimator<std::double_t, std::double_t>(NS::CreateTestAnnotationMapsPtr(1), 0, true, 25.0f, 75.0f, 1.5f)),
+        "rankError"
+    );
+}
+
+TEST_CASE("execute_batch") {
+    NS::Featurizers::RobustScalerTransformer<std::int8_t, std::float_t>    transformer(2.0f, 4.0f);
+    std::vector<std::int8_t> const          inputs{-2, 2, 4, 10};
+    std::vector<std::float_t>               results(inputs.size());
+
+    transformer.execute_batch(inputs.data(), inputs.size(), results.data());
+
+    CHECK(results == std::vector<std::float_t>{-1.0f, 0.0f, 0.5f, 2.0f});
+
+    // A scale of 0 only centers the values
+    NS::Featurizers::RobustScalerTransformer<std::int8_t, std::float_t>    zeroTransformer(2.0f, 0.0f);
+
+    zeroTransformer.execute_batch(inputs.data(), inputs.size(), results.data());
+
+    CHECK(results == std::vector<std::float_t>{-4.0f, 0.0f, 2.0f, 8.0f});
+}
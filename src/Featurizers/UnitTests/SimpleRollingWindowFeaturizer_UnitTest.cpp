@@ -197,6 +197,43 @@ TEST_CASE("Min - int32, window size 2, horizon 2, min window size 2") {
     CHECK(results(0, 1) == 2);
 }
 
+TEST_CASE("Min/Max - compare with full window calculation") {
+    // Calculate each window directly from the inputs
+    std::vector<InputType> const            inputs{5, -3, 8, 8, 1, 0, -7, 12, 4, 4, 9, -2, 6, 3, -1, 10};
+
+    for(auto calculation : {NS::Featurizers::SimpleRollingWindowCalculation::Min, NS::Featurizers::SimpleRollingWindowCalculation::Max}) {
+        for(std::uint32_t horizon : {1u, 3u, 5u}) {
+            for(std::uint32_t maxWindowSize : {1u, 2u, 4u}) {
+                for(std::uint32_t minWindowSize = 1; minWindowSize <= maxWindowSize; ++minWindowSize) {
+                    NS::Featurizers::SimpleRollingWindowTransformer<InputType>    transformer(calculation, horizon, maxWindowSize, minWindowSize);
+
+                    for(size_t numInputs = 1; numInputs <= inputs.size(); ++numInputs) {
+                        OutputType const    results(transformer.execute(inputs[numInputs - 1]));
+
+                        REQUIRE(results.cols() == horizon);
+
+                        for(std::uint32_t offset = 0; offset < horizon; ++offset) {
+                            std::ptrdiff_t const            windowEnd(static_cast<std::ptrdiff_t>(numInputs) - static_cast<std::ptrdiff_t>(horizon - offset));
+
+                            if(windowEnd < static_cast<std::ptrdiff_t>(minWindowSize)) {
+                                CHECK(NS::Traits<MatrixMemberType>::IsNull(results(0, offset)));
+                                continue;
+                            }
+
+                            auto const                      begin(inputs.begin() + std::max(static_cast<std::ptrdiff_t>(0), windowEnd - static_cast<std::ptrdiff_t>(maxWindowSize)));
+                            auto const                      end(inputs.begin() + windowEnd);
+
+                            InputType const                 expected(calculation == NS::Featurizers::SimpleRollingWindowCalculation::Min ? *std::min_element(begin, end) : *std::max_element(begin, end));
+
+                            CHECK(results(0, offset) == expected);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
 TEST_CASE("Estimator Min - int32, window size 2, horizon 2, min window size 2") {
     NS::AnnotationMapsPtr                   pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
     NS::Featurizers::SimpleRollingWindowEstimator<InputType>                 estimator(pAllColumnAnnotations, NS::Featurizers::SimpleRollingWindowCalculation::Min, 2, 2, 2);
@@ -384,3 +421,14 @@ TEST_CASE("Flush test") {
     CHECK(results.cols() == 1);
     CHECK(results(0, 0) == 1);
 }
+
+TEST_CASE("Equality compares the calculation") {
+    using TransformerType                   = NS::Featurizers::SimpleRollingWindowTransformer<std::int32_t>;
+
+    TransformerType                         minTransformer(NS::Featurizers::SimpleRollingWindowCalculation::Min, 2, 2, 2);
+    TransformerType                         maxTransformer(NS::Featurizers::SimpleRollingWindowCalculation::Max, 2, 2, 2);
+
+    CHECK(minTransformer == TransformerType(NS::Featurizers::SimpleRollingWindowCalculation::Min, 2, 2, 2));
+    CHECK(minTransformer != maxTransformer);
+    CHECK(static_cast<TransformerType::BaseType const &>(minTransformer) != static_cast<TransformerType::BaseType const &>(maxTransformer));
+}
@@ -578,3 +578,16 @@ TEST_CASE("Serialization/Deserialization") {
     TransformerType modelLoaded(loader);
     CHECK(modelLoaded==*model);
 }
+
+TEST_CASE("execute_batch") {
+    NS::Featurizers::StandardScalerTransformer<std::float_t, std::double_t>    transformer(2.0, 4.0);
+    std::vector<std::float_t> const         inputs{-2.0f, 2.0f, NS::Traits<std::float_t>::CreateNullValue(), 10.0f};
+    std::vector<std::double_t>              results(inputs.size());
+
+    transformer.execute_batch(inputs.data(), inputs.size(), results.data());
+
+    CHECK(results[0] == -1.0);
+    CHECK(results[1] == 0.0);
+    CHECK(NS::Traits<std::double_t>::IsNull(results[2]));
+    CHECK(results[3] == 2.0);
+}
@@ -110,3 +110,47 @@ TEST_CASE("SingleValueSparseVectorEncoding - float") {
     CHECK(o1 != NS::Featurizers::SingleValueSparseVectorEncoding<float>(10, 2.0f, 2));
     CHECK(o1 != NS::Featurizers::SingleValueSparseVectorEncoding<float>(10, 1.0f, 3));
 }
+
+TEST_CASE("CreateSparseMatrix") {
+    using SparseEncoding = NS::Featurizers::SparseVectorEncoding<float>;
+
+    std::vector<SparseEncoding>             vectors;
+
+    vectors.emplace_back(5, NS::TestHelpers::make_vector<SparseEncoding::ValueEncoding>(SparseEncoding::ValueEncoding(1.0f, 0), SparseEncoding::ValueEncoding(2.0f, 3)));
+    vectors.emplace_back(5, NS::TestHelpers::make_vector<SparseEncoding::ValueEncoding>(SparseEncoding::ValueEncoding(3.0f, 4)));
+
+    NS::SparseRowMajMatrix<float> const     matrix(NS::Featurizers::CreateSparseMatrix(vectors.data(), vectors.size()));
+
+    CHECK(matrix.rows() == 2);
+    CHECK(matrix.cols() == 5);
+    CHECK(matrix.nonZeros() == 3);
+    CHECK(matrix.isCompressed());
+
+    NS::RowMajMatrix<float>                 expected(NS::RowMajMatrix<float>::Zero(2, 5));
+
+    expected(0, 0) = 1.0f;
+    expected(0, 3) = 2.0f;
+    expected(1, 4) = 3.0f;
+
+    CHECK(NS::RowMajMatrix<float>(matrix) == expected);
+}
+
+TEST_CASE("CreateSparseMatrix - errors") {
+    using SparseEncoding = NS::Featurizers::SparseVectorEncoding<float>;
+
+    std::vector<SparseEncoding>             vectors;
+
+    vectors.emplace_back(5, NS::TestHelpers::make_vector<SparseEncoding::ValueEncoding>(SparseEncoding::ValueEncoding(1.0f, 0)));
+    vectors.emplace_back(6, NS::TestHelpers::make_vector<SparseEncoding::ValueEncoding>(SparseEncoding::ValueEncoding(1.0f, 0)));
+
+    CHECK_THROWS_WITH(NS::Featurizers::CreateSparseMatrix<float>(nullptr, 1), "pVectors");
+    CHECK_THROWS_WITH(NS::Featurizers::CreateSparseMatrix(vectors.data(), 0), "cVectors");
+    CHECK_THROWS_WITH(NS::Featurizers::CreateSparseMatrix(vectors.data(), vectors.size()), "'NumElements' values are inconsistent");
+
+    std::vector<SparseEncoding>             outOfRange;
+
+    outOfRange.emplace_back(5, NS::TestHelpers::make_vector<SparseEncoding::ValueEncoding>(SparseEncoding::ValueEncoding(1.0f, 4)));
+    outOfRange.emplace_back(5, NS::TestHelpers::make_vector<SparseEncoding::ValueEncoding>(SparseEncoding::ValueEncoding(1.0f, 1), SparseEncoding::ValueEncoding(2.0f, 5)));
+
+    CHECK_THROWS_WITH(NS::Featurizers::CreateSparseMatrix(outOfRange.data(), outOfRange.size()), "Index");
+}
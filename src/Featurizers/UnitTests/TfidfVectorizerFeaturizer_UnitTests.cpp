@@ -5,6 +5,8 @@
 #define CATCH_CONFIG_MAIN
 #include "catch.hpp"
 
+#include <thread>
+
 #include "../../3rdParty/optional.h"
 #include "../../Archive.h"
 #include "../TfidfVectorizerFeaturizer.h"
@@ -846,6 +848,42 @@ TEST_CASE("Serialization/Deserialization") {
     CHECK(other == original);
 }
 
+TEST_CASE("Deserialization - version 1.0") {
+    using TransformerType = NS::Featurizers::TfidfVectorizerTransformer;
+
+    IndexMap indexMap(
+        {
+            {"apple", 1},
+            {"banana", 2},
+            {"grape", 3},
+            {"orange", 4},
+            {"peach", 5}
+        }
+    );
+
+    // Version 1.0 archives contain the vocabulary as maps
+    NS::Archive                             out;
+
+    NS::Traits<std::uint16_t>::serialize(out, 1);
+    NS::Traits<std::uint16_t>::serialize(out, 0);
+    NS::Traits<IndexMap>::serialize(out, indexMap);
+    NS::Traits<IndexMap>::serialize(out, indexMap);
+    NS::Traits<std::uint32_t>::serialize(out, 5);
+    NS::Traits<std::uint8_t>::serialize(out, static_cast<std::uint8_t>(NormMethod::L2));
+    NS::Traits<std::uint32_t>::serialize(out, static_cast<std::uint32_t>(TfidfPolicy::UseIdf));
+    NS::Traits<bool>::serialize(out, true);
+    NS::Traits<std::uint8_t>::serialize(out, static_cast<std::uint8_t>(AnalyzerMethod::Word));
+    NS::Traits<std::string>::serialize(out, "");
+    NS::Traits<std::uint32_t>::serialize(out, 1);
+    NS::Traits<std::uint32_t>::serialize(out, 1);
+
+    NS::Archive                             in(out.commit());
+    TransformerType                         other(in);
+
+    CHECK(in.AtEnd());
+    CHECK(other == TransformerType(indexMap, indexMap, 5, NormMethod::L2, TfidfPolicy::UseIdf, true, AnalyzerMethod::Word, "", 1, 1));
+}
+
 TEST_CASE("Serialization Version Error") {
     NS::Archive                             out;
 
@@ -859,3 +897,153 @@ TEST_CASE("Serialization Version Error") {
         Catch::Contains("Unsupported archive version")
     );
 }
+
+TEST_CASE("Transformer reuse") {
+    using TransformerType = NS::Featurizers::TfidfVectorizerTransformer;
+    using TransformedType = NS::Featurizers::SparseVectorEncoding<std::float_t>;
+
+    IndexMap labels(
+        {
+            {"apple", 0},
+            {"banana", 1},
+            {"grape", 2}
+        }
+    );
+    IndexMap docuFreq(
+        {
+            {"apple", 1},
+            {"banana", 2},
+            {"grape", 3}
+        }
+    );
+
+    TransformerType                         transformer(labels, docuFreq, 3, NormMethod::None, TfidfPolicy::UseIdf, true, AnalyzerMethod::Word, "", 1, 1);
+
+    std::float_t const                      appleIdf(static_cast<std::float_t>(1.0 + std::log(4.0 / 1.0)));
+    std::float_t const                      bananaIdf(static_cast<std::float_t>(1.0 + std::log(4.0 / 2.0)));
+    std::float_t const                      grapeIdf(static_cast<std::float_t>(1.0 + std::log(4.0 / 3.0)));
+
+    // Terms that aren't in the vocabulary (including prefixes and extensions of
+    // terms that are) are ignored, and counts don't leak from one document to the next.
+    for(int iteration = 0; iteration < 2; ++iteration) {
+        std::vector<TransformedType::ValueEncoding> values1{};
+        values1.emplace_back(TransformedType::ValueEncoding(2.0f * appleIdf, 0));
+        values1.emplace_back(TransformedType::ValueEncoding(bananaIdf, 1));
+
+        SparseVectorNumericCheck<std::float_t>(transformer.execute("banana APPLE apples app cherry apple"), TransformedType(3, std::move(values1)));
+
+        std::vector<TransformedType::ValueEncoding> values2{};
+        values2.emplace_back(TransformedType::ValueEncoding(grapeIdf, 2));
+
+        SparseVectorNumericCheck<std::float_t>(transformer.execute("grape"), TransformedType(3, std::move(values2)));
+    }
+}
+
+TEST_CASE("execute_into") {
+    using TransformerType = NS::Featurizers::TfidfVectorizerTransformer;
+    using TransformedType = NS::Featurizers::SparseVectorEncoding<std::float_t>;
+
+    IndexMap labels({{"apple", 0}, {"banana", 1}, {"grape", 2}});
+    IndexMap docuFreq({{"apple", 1}, {"banana", 2}, {"grape", 3}});
+
+    TransformerType                         transformer(labels, docuFreq, 3, NormMethod::L2, TfidfPolicy::UseIdf, true, AnalyzerMethod::Word, "", 1, 1);
+
+    std::vector<std::float_t>               values(3, -1.0f);
+    std::vector<std::uint64_t>              indexes(3, 99);
+    std::uint64_t                           numElements(0);
+
+    // The input doesn't need to be null-terminated
+    std::string const                       input("banana apple apple grape");
+
+    CHECK(transformer.execute_into(input.data(), 18, numElements, values.data(), indexes.data(), values.size()) == 2);
+
+    TransformedType const                   expected(transformer.execute("banana apple apple"));
+
+    CHECK(numElements == expected.NumElements);
+
+    for(size_t i = 0; i < expected.Values.size(); ++i) {
+        CHECK(std::abs(values[i] - expected.Values[i].Value) < 0.000001f);
+        CHECK(indexes[i] == expected.Values[i].Index);
+    }
+
+    // The buffers aren't written when they are too small
+    std::fill(values.begin(), values.end(), -1.0f);
+
+    CHECK(transformer.execute_into(input.data(), input.size(), numElements, values.data(), indexes.data(), 2) == 3);
+    CHECK(values[0] == -1.0f);
+
+    // Values can be written as counts (as done by the CountVectorizer)
+    TransformerType                         countTransformer(labels, docuFreq, 3, NormMethod::None, static_cast<TfidfPolicy>(0), true, AnalyzerMethod::Word, "", 1, 1);
+    std::vector<std::uint32_t>              counts(3, 0);
+
+    CHECK(countTransformer.execute_into(input.data(), input.size(), numElements, counts.data(), indexes.data(), counts.size()) == 3);
+    CHECK(counts == std::vector<std::uint32_t>{ 2, 1, 1 });
+    CHECK(indexes == std::vector<std::uint64_t>{ 0, 1, 2 });
+}
+
+TEST_CASE("Concurrent execution") {
+    using TransformerType = NS::Featurizers::TfidfVectorizerTransformer;
+    using TransformedType = NS::Featurizers::SparseVectorEncoding<std::float_t>;
+
+    IndexMap labels({{"apple", 0}, {"banana", 1}, {"grape", 2}});
+    IndexMap docuFreq({{"apple", 1}, {"banana", 2}, {"grape", 3}});
+    IndexMap largeLabels;
+    IndexMap largeDocuFreq;
+
+    for(std::uint32_t index = 0; index < 1000; ++index) {
+        largeLabels.emplace("term" + std::to_string(index), index);
+        largeDocuFreq.emplace("term" + std::to_string(index), 1);
+    }
+
+    TransformerType                         transformer(labels, docuFreq, 3, NormMethod::L2, TfidfPolicy::UseIdf, true, AnalyzerMethod::Word, "", 1, 1);
+    TransformerType                         largeTransformer(largeLabels, largeDocuFreq, 3, NormMethod::L2, TfidfPolicy::UseIdf, true, AnalyzerMethod::Word, "", 1, 1);
+
+    std::vector<std::string> const          documents{ "banana apple apple", "grape banana", "cherry grape", "apple grape grape banana" };
+    std::vector<TransformedType>            expected;
+
+    for(auto const &document : documents)
+        expected.emplace_back(transformer.execute(document));
+
+    // Transformers with different vocabularies share the scratch buffers of a thread
+    TransformedType const                   largeExpected(largeTransformer.execute("term999 term0 term999"));
+
+    CHECK(largeExpected.Values.size() == 2);
+    CHECK(transformer.execute(documents[3]) == expected[3]);
+    CHECK(largeTransformer.execute("term999 term0 term999") == largeExpected);
+
+    // A transformer can be used on multiple threads concurrently
+    std::vector<std::thread>                threads;
+    std::vector<size_t>                     numMismatches(4, 0);
+
+    for(size_t threadIndex = 0; threadIndex < numMismatches.size(); ++threadIndex) {
+        threads.emplace_back(
+            [&, threadIndex](void) {
+                for(size_t iteration = 0; iteration < 1000; ++iteration) {
+                    size_t const            documentIndex((iteration + threadIndex) % documents.size());
+
+                    if((transformer.execute(documents[documentIndex]) == expected[documentIndex]) == false)
+                        ++numMismatches[threadIndex];
+                }
+            }
+        );
+    }
+
+    for(auto &thread : threads)
+        thread.join();
+
+    for(size_t mismatches : numMismatches)
+        CHECK(mismatches == 0);
+}
+
+TEST_CASE("Invalid DocumentFrequency map") {
+    IndexMap labels({{"apple", 0}, {"banana", 1}});
+    IndexMap docuFreq({{"apple", 1}});
+
+    CHECK_THROWS_WITH(
+        NS::Featurizers::TfidfVectorizerTransformer(labels, docuFreq, 3, NormMethod::L2, TfidfPolicy::UseIdf, true, AnalyzerMethod::Word, "", 1, 1),
+        "A term in the index map is not in the DocumentFrequency map"
+    );
+
+    // The DocumentFrequency map isn't used when idf is disabled
+    CHECK_NOTHROW(NS::Featurizers::TfidfVectorizerTransformer(labels, docuFreq, 3, NormMethod::L2, TfidfPolicy::Binary, true, AnalyzerMethod::Word, "", 1, 1));
+}
@@ -6,6 +6,7 @@
 #include "catch.hpp"
 
 #include "../../Featurizers/TruncatedSVDFeaturizer.h"
+#include "../../Featurizers/Structs.h"
 #include "../TestHelpers.h"
 #include "../../Archive.h"
 
@@ -281,6 +282,108 @@ TEST_CASE("Map") {
     TruncatedSVDTransformerTestMapRowMajConst<double>();
 }
 
+template <typename SparseMatrixT>
+void TruncatedSVDTransformerTestSparse(size_t numComponents) {
+    using DenseMatrixT = NS::RowMajMatrix<typename SparseMatrixT::Scalar>;
+
+    NS::AnnotationMapsPtr const             pAllColumnAnnotations(NS::CreateTestAnnotationMapsPtr(1));
+
+    // Mostly zeros, with one empty row and one empty column
+    DenseMatrixT                            dense(DenseMatrixT::Zero(6, 5));
+
+    dense(0, 0) = 1;
+    dense(0, 3) = 2;
+    dense(1, 1) = 3;
+    dense(2, 0) = 4;
+    dense(2, 4) = 5;
+    dense(4, 1) = 6;
+    dense(4, 3) = 7;
+    dense(5, 0) = 8;
+
+    SparseMatrixT                           sparse(dense.sparseView());
+
+    std::vector<DenseMatrixT>               expected(
+        NS::TestHelpers::TransformerEstimatorTest(
+            NS::Featurizers::TruncatedSVDEstimator<DenseMatrixT>(pAllColumnAnnotations, 0, static_cast<unsigned int>(42), numComponents),
+            NS::TestHelpers::make_vector<std::vector<DenseMatrixT>>(NS::TestHelpers::make_vector<DenseMatrixT>(dense)),
+            NS::TestHelpers::make_vector<DenseMatrixT>(dense)
+        )
+    );
+
+    std::vector<DenseMatrixT>               actual(
+        NS::TestHelpers::TransformerEstimatorTest(
+            NS::Featurizers::TruncatedSVDEstimator<SparseMatrixT>(pAllColumnAnnotations, 0, static_cast<unsigned int>(42), numComponents),
+            NS::TestHelpers::make_vector<std::vector<SparseMatrixT>>(NS::TestHelpers::make_vector<SparseMatrixT>(sparse)),
+            NS::TestHelpers::make_vector<SparseMatrixT>(sparse)
+        )
+    );
+
+    REQUIRE(expected.size() == 1);
+    REQUIRE(actual.size() == 1);
+    CHECK(actual[0].cols() == (numComponents == 0 ? 5 : static_cast<Eigen::Index>(numComponents)));
+    CHECK((actual[0] - expected[0]).norm() < 0.0001);
+}
+
+TEST_CASE("Sparse") {
+    TruncatedSVDTransformerTestSparse<NS::SparseRowMajMatrix<float>>(0);
+    TruncatedSVDTransformerTestSparse<NS::SparseRowMajMatrix<double>>(0);
+    TruncatedSVDTransformerTestSparse<NS::SparseRowMajMatrix<double>>(2);
+    TruncatedSVDTransformerTestSparse<Eigen::SparseMatrix<double>>(3);
+}
+
+TEST_CASE("Sparse - SparseVectorEncoding") {
+    using SparseEncoding = NS::Featurizers::SparseVectorEncoding<std::float_t>;
+
+    // Vectors such as those produced by `TfidfVectorizerTransformer`
+    std::vector<SparseEncoding>             vectors;
+
+    for(std::uint64_t row = 0; row < 50; ++row) {
+        std::vector<SparseEncoding::ValueEncoding>  values;
+
+        values.emplace_back(1.0f, row % 7);
+        values.emplace_back(static_cast<std::float_t>(row % 5) + 0.5f, 100 + row % 3);
+        values.emplace_back(0.25f, 100000 + row % 11);
+
+        vectors.emplace_back(200000, std::move(values));
+    }
+
+    NS::SparseRowMajMatrix<std::float_t>    matrix(NS::Featurizers::CreateSparseMatrix(vectors.data(), vectors.size()));
+
+    NS::Featurizers::TruncatedSVDEstimator<NS::SparseRowMajMatrix<std::float_t>>    estimator(NS::CreateTestAnnotationMapsPtr(1), 0, static_cast<unsigned int>(42), 3);
+
+    estimator.begin_training();
+    estimator.fit(matrix);
+    estimator.complete_training();
+
+    auto                                    pTransformer(estimator.create_transformer());
+    NS::RowMajMatrix<std::float_t>          output;
+
+    pTransformer->execute(
+        matrix,
+        [&output](NS::RowMajMatrix<std::float_t> value) {
+            output = std::move(value);
+        }
+    );
+
+    CHECK(output.rows() == 50);
+    CHECK(output.cols() == 3);
+    CHECK(output.allFinite());
+}
+
+TEST_CASE("Sparse - errors") {
+    using MatrixT = NS::SparseRowMajMatrix<double>;
+
+    MatrixT                                 matrix(2, 3);
+
+    matrix.insert(0, 0) = 1.0;
+    matrix.insert(1, 2) = 2.0;
+
+    NS::Featurizers::TruncatedSVDEstimator<MatrixT>     estimator(NS::CreateTestAnnotationMapsPtr(1), 0, nonstd::optional<unsigned int>(), 3);
+
+    estimator.begin_training();
+    CHECK_THROWS_WITH(estimator.fit(matrix), "numComponents");
+}
+
 TEST_CASE("Invalid_Annotation ColMajor") {
     using MatrixT = Eigen::MatrixX<float>;
     MatrixT invalidSingularVectors;
@@ -63,6 +63,12 @@ function(Impl)
     foreach(df ${JSON_DATA})
         file(COPY ${df} DESTINATION Data/DateTimeFeaturizer)
     endforeach()
+
+    file(GLOB BINARY_DATA "${_this_path}/../DateTimeFeaturizerData/GeneratedCode/Binary/*.bin")
+
+    foreach(df ${BINARY_DATA})
+        file(COPY ${df} DESTINATION Data/DateTimeFeaturizer/Binary)
+    endforeach()
 endfunction()
 
 Impl()
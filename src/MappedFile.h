@@ -0,0 +1,155 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#if (defined _WIN32)
+#   if (!defined NOMINMAX)
+#       define NOMINMAX
+#   endif
+#   include <Windows.h>
+#else
+#   include <cerrno>
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace Microsoft {
+namespace Featurizer {
+
+/// Read-only data whose deleter releases the underlying memory (which may be
+/// a memory mapped file).
+using SharedDataPtr                         = std::shared_ptr<unsigned char const>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            MapFile
+///  \brief         Maps the file into memory as read-only data, returning
+///                 nullptr if the file doesn't exist. Other failures throw a
+///                 `std::system_error` with the OS error code. The data is paged
+///                 in on demand and remains valid as long as the returned pointer
+///                 (or a copy of it) is alive; only callers that use the data
+///                 in place (rather than copying it out) avoid a private copy.
+///
+inline SharedDataPtr MapFile(std::string const &filename, size_t &cData);
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+#if (defined _WIN32)
+
+inline SharedDataPtr MapFile(std::string const &filename, size_t &cData) {
+    HANDLE                                  file(CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr));
+
+    if(file == INVALID_HANDLE_VALUE) {
+        DWORD const                         error(GetLastError());
+
+        if(error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND)
+            return SharedDataPtr();
+
+        throw std::system_error(static_cast<int>(error), std::system_category(), "CreateFile '" + filename + "'");
+    }
+
+    LARGE_INTEGER                           size;
+
+    if(GetFileSizeEx(file, &size) == false) {
+        DWORD const                         error(GetLastError());
+
+        CloseHandle(file);
+        throw std::system_error(static_cast<int>(error), std::system_category(), "GetFileSizeEx '" + filename + "'");
+    }
+
+    if(size.QuadPart == 0) {
+        CloseHandle(file);
+        throw std::runtime_error("The file is empty");
+    }
+
+    HANDLE                                  mapping(CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr));
+    DWORD                                   error(GetLastError());
+
+    CloseHandle(file);
+
+    if(mapping == nullptr)
+        throw std::system_error(static_cast<int>(error), std::system_category(), "CreateFileMapping '" + filename + "'");
+
+    void const *                            pView(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+
+    error = GetLastError();
+
+    // The view keeps a reference to the mapping
+    CloseHandle(mapping);
+
+    if(pView == nullptr)
+        throw std::system_error(static_cast<int>(error), std::system_category(), "MapViewOfFile '" + filename + "'");
+
+    cData = static_cast<size_t>(size.QuadPart);
+
+    return SharedDataPtr(
+        static_cast<unsigned char const *>(pView),
+        [](unsigned char const *ptr) { UnmapViewOfFile(ptr); }
+    );
+}
+
+#else
+
+inline SharedDataPtr MapFile(std::string const &filename, size_t &cData) {
+    int const                               file(open(filename.c_str(), O_RDONLY));
+
+    if(file == -1) {
+        if(errno == ENOENT)
+            return SharedDataPtr();
+
+        throw std::system_error(errno, std::generic_category(), "open '" + filename + "'");
+    }
+
+    struct stat                             info;
+
+    if(fstat(file, &info) != 0) {
+        int const                           error(errno);
+
+        close(file);
+        throw std::system_error(error, std::generic_category(), "fstat '" + filename + "'");
+    }
+
+    size_t const                            size(static_cast<size_t>(info.st_size));
+
+    if(size == 0) {
+        close(file);
+        throw std::runtime_error("The file is empty");
+    }
+
+    void *                                  pView(mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0));
+    int const                               error(errno);
+
+    // The mapping remains valid after the file is closed
+    close(file);
+
+    if(pView == MAP_FAILED)
+        throw std::system_error(error, std::generic_category(), "mmap '" + filename + "'");
+
+    cData = size;
+
+    return SharedDataPtr(
+        static_cast<unsigned char const *>(pView),
+        [size](unsigned char const *ptr) { munmap(const_cast<unsigned char *>(ptr), size); }
+    );
+}
+
+#endif
+
+} // namespace Featurizer
+} // namespace Microsoft
@@ -0,0 +1,37 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#include "BenchmarkHelpers.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+thread_local Microsoft::Featurizer::Benchmarks::AllocationCounters          g_allocationCounters;
+
+} // anonymous namespace
+
+Microsoft::Featurizer::Benchmarks::AllocationCounters & Microsoft::Featurizer::Benchmarks::GetAllocationCounters(void) {
+    return g_allocationCounters;
+}
+
+// The array and nothrow forms invoke these functions. They are defined in
+// their own translation unit so that calls aren't inlined into code that
+// allocates.
+void * operator new(size_t cBytes) {
+    g_allocationCounters.Bytes += cBytes;
+    ++g_allocationCounters.Allocations;
+
+    void *                                  ptr(std::malloc(cBytes == 0 ? 1 : cBytes));
+
+    if(ptr == nullptr)
+        throw std::bad_alloc();
+
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
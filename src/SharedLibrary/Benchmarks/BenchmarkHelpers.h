@@ -0,0 +1,365 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if (defined _WIN32)
+#   if (!defined NOMINMAX)
+#       define NOMINMAX
+#   endif
+#   include <Windows.h>
+#   include <psapi.h>
+#else
+#   include <sys/resource.h>
+#endif
+
+namespace Microsoft {
+namespace Featurizer {
+namespace Benchmarks {
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         DataGenerator
+///  \brief         Generates pseudo-random benchmark data from a seed.
+///
+///                 The raw output of `std::mt19937_64` is fully specified by
+///                 the standard, but the standard distributions are not; values
+///                 are mapped to ranges here so that the same seed generates the
+///                 same data with every compiler and standard library.
+///
+class DataGenerator {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    DataGenerator(std::uint64_t seed);
+
+    /// Returns an integer in the range [minValue, maxValue].
+    template <typename T>
+    T integer(T minValue, T maxValue);
+
+    /// Returns a real number in the range [0.0, 1.0).
+    double real(void);
+
+    /// Returns a real number in the range [minValue, maxValue).
+    double real(double minValue, double maxValue);
+
+    /// Returns true with the provided probability.
+    bool probability(double value);
+
+    /// Returns a lowercase word with between 1 and `maxLength` characters.
+    std::string word(size_t maxLength);
+
+    /// Returns one of `numCategories` distinct strings.
+    std::string category(size_t numCategories);
+
+    /// Returns `numWords` space-delimited words chosen from a vocabulary of
+    /// `vocabularySize` words.
+    std::string document(size_t numWords, size_t vocabularySize);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::mt19937_64                         _generator;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        AllocationCounters
+///  \brief         Totals updated by the global allocation functions defined
+///                 by the benchmark executable. Each thread has its own
+///                 counters, so threads don't contend on them and a
+///                 measurement only includes allocations made by the
+///                 measuring thread.
+///
+struct AllocationCounters {
+    std::uint64_t                           Bytes;
+    std::uint64_t                           Allocations;
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            GetAllocationCounters
+///  \brief         Returns the counters of the calling thread.
+///
+AllocationCounters & GetAllocationCounters(void);
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        Measurement
+///  \brief         The results of a single benchmark operation.
+///
+struct Measurement {
+    std::string                             Interface;          // "cpp" or "c"
+    std::string                             Featurizer;
+    std::string                             Operation;
+    size_t                                  Rows;
+    std::uint64_t                           Nanoseconds;
+    std::uint64_t                           BytesAllocated;
+    std::uint64_t                           Allocations;
+    std::uint64_t                           PeakRSS;            // Process-wide high-water mark
+    std::uint64_t                           PeakRSSGrowth;      // Increase of the high-water mark during the operation
+    std::uint64_t                           SerializedBytes;    // Only written when not 0
+};
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            GetPeakRSS
+///  \brief         Returns the peak resident set size of the process in bytes.
+///
+inline std::uint64_t GetPeakRSS(void);
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            Measure
+///  \brief         Invokes the functor and returns the time and allocations
+///                 that it required.
+///
+template <typename FunctorT>
+Measurement Measure(std::string interfaceName, std::string featurizer, std::string operation, size_t rows, FunctorT const &func);
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         JsonWriter
+///  \brief         Writes measurements as a JSON object that contains the
+///                 benchmark settings and an array of results.
+///
+class JsonWriter {
+public:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Public Methods
+    // |
+    // ----------------------------------------------------------------------
+    JsonWriter(std::ostream &stream, size_t rows, std::uint64_t seed);
+    ~JsonWriter(void);
+
+    JsonWriter(JsonWriter const &) = delete;
+    JsonWriter & operator =(JsonWriter const &) = delete;
+
+    void write(Measurement const &measurement);
+
+private:
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Data
+    // |
+    // ----------------------------------------------------------------------
+    std::ostream &                          _stream;
+    bool                                    _isFirst;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+    static std::string Escape(std::string const &value);
+};
+
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// |
+// |  Implementation
+// |
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+// ----------------------------------------------------------------------
+
+// ----------------------------------------------------------------------
+// |
+// |  DataGenerator
+// |
+// ----------------------------------------------------------------------
+inline DataGenerator::DataGenerator(std::uint64_t seed) :
+    _generator(seed) {
+}
+
+template <typename T>
+T DataGenerator::integer(T minValue, T maxValue) {
+    if(minValue > maxValue)
+        throw std::invalid_argument("minValue");
+
+    std::uint64_t const                     range(static_cast<std::uint64_t>(maxValue) - static_cast<std::uint64_t>(minValue));
+
+    if(range == std::numeric_limits<std::uint64_t>::max())
+        return static_cast<T>(_generator());
+
+    return static_cast<T>(static_cast<std::uint64_t>(minValue) + _generator() % (range + 1));
+}
+
+inline double DataGenerator::real(void) {
+    // Use the 53 most significant bits to fill the mantissa
+    return static_cast<double>(_generator() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+inline double DataGenerator::real(double minValue, double maxValue) {
+    return minValue + real() * (maxValue - minValue);
+}
+
+inline bool DataGenerator::probability(double value) {
+    return real() < value;
+}
+
+inline std::string DataGenerator::word(size_t maxLength) {
+    size_t const                            length(integer<size_t>(1, maxLength));
+    std::string                             result;
+
+    result.reserve(length);
+
+    while(result.size() < length)
+        result.push_back(static_cast<char>('a' + integer(0, 25)));
+
+    return result;
+}
+
+inline std::string DataGenerator::category(size_t numCategories) {
+    return "category_" + std::to_string(integer<size_t>(0, numCategories - 1));
+}
+
+inline std::string DataGenerator::document(size_t numWords, size_t vocabularySize) {
+    std::string                             result;
+
+    for(size_t index = 0; index < numWords; ++index) {
+        if(index != 0)
+            result.push_back(' ');
+
+        result += "word" + std::to_string(integer<size_t>(0, vocabularySize - 1));
+    }
+
+    return result;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Free Functions
+// |
+// ----------------------------------------------------------------------
+#if (defined _WIN32)
+
+inline std::uint64_t GetPeakRSS(void) {
+    PROCESS_MEMORY_COUNTERS                 counters;
+
+    if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == false)
+        throw std::runtime_error("GetProcessMemoryInfo");
+
+    return static_cast<std::uint64_t>(counters.PeakWorkingSetSize);
+}
+
+#else
+
+inline std::uint64_t GetPeakRSS(void) {
+    struct rusage                           usage;
+
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        throw std::runtime_error("getrusage");
+
+#   if (defined __APPLE__)
+    // Bytes on macOS
+    return static_cast<std::uint64_t>(usage.ru_maxrss);
+#   else
+    // Kilobytes on Linux
+    return static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;
+#   endif
+}
+
+#endif
+
+template <typename FunctorT>
+Measurement Measure(std::string interfaceName, std::string featurizer, std::string operation, size_t rows, FunctorT const &func) {
+    AllocationCounters &                    counters(GetAllocationCounters());
+
+    std::uint64_t const                     bytes(counters.Bytes);
+    std::uint64_t const                     allocations(counters.Allocations);
+    std::uint64_t const                     peakRSS(GetPeakRSS());
+    auto const                              startTime(std::chrono::steady_clock::now());
+
+    func();
+
+    auto const                              duration(std::chrono::steady_clock::now() - startTime);
+
+    Measurement                             result;
+
+    result.Interface = std::move(interfaceName);
+    result.Featurizer = std::move(featurizer);
+    result.Operation = std::move(operation);
+    result.Rows = rows;
+    result.Nanoseconds = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    result.BytesAllocated = counters.Bytes - bytes;
+    result.Allocations = counters.Allocations - allocations;
+    result.PeakRSS = GetPeakRSS();
+    result.PeakRSSGrowth = result.PeakRSS - peakRSS;
+    result.SerializedBytes = 0;
+
+    return result;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  JsonWriter
+// |
+// ----------------------------------------------------------------------
+inline JsonWriter::JsonWriter(std::ostream &stream, size_t rows, std::uint64_t seed) :
+    _stream(stream),
+    _isFirst(true) {
+    _stream << "{\n  \"rows\": " << rows << ",\n  \"seed\": " << seed << ",\n  \"results\": [";
+}
+
+inline JsonWriter::~JsonWriter(void) {
+    _stream << (_isFirst ? "]\n}\n" : "\n  ]\n}\n");
+    _stream.flush();
+}
+
+inline void JsonWriter::write(Measurement const &measurement) {
+    // Avoid infinite values when the operation was faster than the clock resolution
+    double const                            nanoseconds(static_cast<double>(measurement.Nanoseconds == 0 ? 1 : measurement.Nanoseconds));
+    double const                            rows(static_cast<double>(measurement.Rows == 0 ? 1 : measurement.Rows));
+
+    _stream
+        << (_isFirst ? "\n" : ",\n")
+        << "    {"
+        << "\"interface\": \"" << Escape(measurement.Interface) << "\", "
+        << "\"featurizer\": \"" << Escape(measurement.Featurizer) << "\", "
+        << "\"operation\": \"" << Escape(measurement.Operation) << "\", "
+        << "\"rows\": " << measurement.Rows << ", "
+        << "\"total_ns\": " << measurement.Nanoseconds << ", "
+        << "\"ns_per_row\": " << nanoseconds / rows << ", "
+        << "\"rows_per_sec\": " << rows * 1000000000.0 / nanoseconds << ", "
+        << "\"bytes_allocated_per_row\": " << static_cast<double>(measurement.BytesAllocated) / rows << ", "
+        << "\"allocations_per_row\": " << static_cast<double>(measurement.Allocations) / rows << ", "
+        << "\"peak_rss_bytes\": " << measurement.PeakRSS << ", "
+        << "\"peak_rss_growth_bytes\": " << measurement.PeakRSSGrowth;
+
+    if(measurement.SerializedBytes != 0)
+        _stream << ", \"serialized_bytes\": " << measurement.SerializedBytes;
+
+    _stream << "}";
+    _isFirst = false;
+}
+
+inline std::string JsonWriter::Escape(std::string const &value) {
+    std::string                             result;
+
+    result.reserve(value.size());
+
+    for(char c : value) {
+        if(c == '"' || c == '\\')
+            result.push_back('\\');
+
+        result.push_back(c);
+    }
+
+    return result;
+}
+
+} // namespace Benchmarks
+} // namespace Featurizer
+} // namespace Microsoft
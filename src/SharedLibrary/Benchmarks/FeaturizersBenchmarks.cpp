@@ -0,0 +1,1312 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+
+// Measures fit, transform, serialize, and deserialize for every estimator in
+// src/Featurizers (through the C++ classes) and for a selection of the C
+// interfaces exported by the shared library. The results are written to
+// stdout as JSON with one entry per featurizer and operation:
+//
+//     - fit:           Training and creating the transformer; a row is a training row.
+//     - transform:     Executing and flushing the transformer; a row is an inference row.
+//     - serialize:     Saving the transformer; a row is one complete archive.
+//     - deserialize:   Creating a transformer from the archive; a row is one complete archive.
+//
+// Transformer batch paths and the components shared by the featurizers (such
+// as PointerTable and Strings::ParseRegex) are also measured; their operation
+// names describe the variation being measured.
+//
+// Allocations are counted by the global allocation functions replaced in
+// BenchmarkHelpers.cpp, so memory allocated with malloc (such as Eigen matrix
+// data) is not included. Each thread has its own counters, and only the
+// allocations made by the thread running the operation are reported.
+// Peak RSS is the high-water mark of the whole process when the operation
+// completes, so it includes memory used by the benchmarks that ran before it;
+// the growth is the amount that the operation raised the high-water mark,
+// and is 0 when the operation fit within memory that was already resident.
+//
+// Data is generated from the seed, so the same arguments produce the same
+// data on every platform.
+//
+// Usage: FeaturizersBenchmarks [num_rows] [seed] [filter]
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "BenchmarkHelpers.h"
+
+#include "Strings.h"
+
+#include "Featurizers/AnalyticalRollingWindowFeaturizer.h"
+#include "Featurizers/BackwardFillImputerFeaturizer.h"
+#include "Featurizers/CatImputerFeaturizer.h"
+#include "Featurizers/CountVectorizerFeaturizer.h"
+#include "Featurizers/DateTimeFeaturizer.h"
+#include "Featurizers/ForecastingPivotFeaturizer.h"
+#include "Featurizers/ForwardFillImputerFeaturizer.h"
+#include "Featurizers/FromStringFeaturizer.h"
+#include "Featurizers/HashOneHotVectorizerFeaturizer.h"
+#include "Featurizers/ImputationMarkerFeaturizer.h"
+#include "Featurizers/L1NormalizeFeaturizer.h"
+#include "Featurizers/L2NormalizeFeaturizer.h"
+#include "Featurizers/LabelEncoderFeaturizer.h"
+#include "Featurizers/LagLeadOperatorFeaturizer.h"
+#include "Featurizers/MaxAbsScalerFeaturizer.h"
+#include "Featurizers/MaxNormalizeFeaturizer.h"
+#include "Featurizers/MeanImputerFeaturizer.h"
+#include "Featurizers/MedianImputerFeaturizer.h"
+#include "Featurizers/MinMaxImputerFeaturizer.h"
+#include "Featurizers/MinMaxScalerFeaturizer.h"
+#include "Featurizers/MissingDummiesFeaturizer.h"
+#include "Featurizers/ModeImputerFeaturizer.h"
+#include "Featurizers/NumericalizeFeaturizer.h"
+#include "Featurizers/OneHotEncoderFeaturizer.h"
+#include "Featurizers/PCAFeaturizer.h"
+#include "Featurizers/RobustScalerFeaturizer.h"
+#include "Featurizers/SampleAddFeaturizer.h"
+#include "Featurizers/ShortGrainDropperFeaturizer.h"
+#include "Featurizers/SimpleRollingWindowFeaturizer.h"
+#include "Featurizers/StandardScaleWrapperFeaturizer.h"
+#include "Featurizers/StringFeaturizer.h"
+#include "Featurizers/TfidfVectorizerFeaturizer.h"
+#include "Featurizers/TimeSeriesImputerFeaturizer.h"
+#include "Featurizers/TruncatedSVDFeaturizer.h"
+
+#include "SharedLibrary_FromStringFeaturizer.h"
+#include "SharedLibrary_LabelEncoderFeaturizer.h"
+#include "SharedLibrary_MaxAbsScalerFeaturizer.h"
+#include "SharedLibrary_MeanImputerFeaturizer.h"
+#include "SharedLibrary_MinMaxScalerFeaturizer.h"
+
+#include "PointerTable.h"
+
+namespace NS = Microsoft::Featurizer;
+namespace BM = Microsoft::Featurizer::Benchmarks;
+
+namespace {
+
+// ----------------------------------------------------------------------
+// |
+// |  Types
+// |
+// ----------------------------------------------------------------------
+struct Settings {
+    size_t                                  Rows;
+    std::uint64_t                           Seed;
+
+    /// The number of times that each transformer is serialized and deserialized
+    size_t                                  SerializationIterations;
+};
+
+using BenchmarkFunction                     = std::function<void (Settings const &, BM::JsonWriter &, std::string const &)>;
+
+/////////////////////////////////////////////////////////////////////////
+///  \class         MutexPointerTable
+///  \brief         The previous PointerTable implementation, which
+///                 serializes all access with a single mutex. It is the
+///                 reference for the PointerTable contention benchmark.
+///
+class MutexPointerTable {
+public:
+    MutexPointerTable(unsigned int seed=(std::random_device())()) : m_mt(seed) {}
+
+    template<typename T>
+    size_t Add(const T* const toBeAdded) {
+        if(toBeAdded == nullptr)
+            throw std::invalid_argument("Trying to add a null pointer to the table!");
+
+        std::lock_guard<std::mutex> const   lock(m_mutex);
+        std::uniform_int_distribution<size_t>   dist(1, std::numeric_limits<size_t>::max());
+
+        while(true) {
+            size_t const                    index(dist(m_mt));
+
+            if(m_un.find(index) == m_un.end()) {
+                m_un[index] = toBeAdded;
+                return index;
+            }
+        }
+    }
+
+    template<typename T>
+    T* Get(size_t index) {
+        std::lock_guard<std::mutex> const   lock(m_mutex);
+        auto const                          iter(m_un.find(index));
+
+        if(iter == m_un.end())
+            throw std::invalid_argument("Invalid query to the Pointer table, index incorrect!");
+
+        return reinterpret_cast<T*>(const_cast<void*>(iter->second));
+    }
+
+    void Remove(size_t index) {
+        std::lock_guard<std::mutex> const   lock(m_mutex);
+        auto const                          iter(m_un.find(index));
+
+        if(iter == m_un.end())
+            throw std::invalid_argument("Invalid remove from the Pointer table, index pointer not found!");
+
+        m_un.erase(iter);
+    }
+
+private:
+    std::unordered_map<size_t, const void *>            m_un;
+    std::mutex                                          m_mutex;
+    std::mt19937                                        m_mt;
+};
+
+// ----------------------------------------------------------------------
+// |
+// |  Functions
+// |
+// ----------------------------------------------------------------------
+template <typename FunctorT>
+auto Generate(size_t numItems, FunctorT const &func) -> std::vector<decltype(func())> {
+    std::vector<decltype(func())>           result;
+
+    result.reserve(numItems);
+
+    while(result.size() < numItems)
+        result.emplace_back(func());
+
+    return result;
+}
+
+template <typename T>
+T NullableValue(BM::DataGenerator &generator, T value) {
+    // 10% of the values are null
+    return generator.probability(0.1) ? NS::Traits<T>::CreateNullValue() : value;
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            BenchmarkEstimator
+///  \brief         Benchmarks an estimator and the transformer that it creates.
+///                 `trainingRows` and `inferenceRows` are the number of rows
+///                 represented by the data, which is different from the number
+///                 of items when each item is a matrix.
+///
+template <typename EstimatorT, typename InputT>
+void BenchmarkEstimator(
+    Settings const &settings,
+    BM::JsonWriter &writer,
+    std::string const &name,
+    EstimatorT &estimator,
+    std::vector<InputT> const &trainingData,
+    size_t trainingRows,
+    std::vector<InputT> const &inferenceData,
+    size_t inferenceRows
+) {
+    // ----------------------------------------------------------------------
+    using TransformerUniquePtr              = typename EstimatorT::TransformerUniquePtr;
+    using TransformerType                   = typename EstimatorT::TransformerType;
+    using CallbackFunction                  = typename TransformerUniquePtr::element_type::CallbackFunction;
+    using TransformedType                   = typename TransformerUniquePtr::element_type::TransformedType;
+    // ----------------------------------------------------------------------
+
+    TransformerUniquePtr                    pTransformer;
+
+    writer.write(
+        BM::Measure(
+            "cpp",
+            name,
+            "fit",
+            trainingRows,
+            [&](void) {
+                estimator.begin_training();
+
+                while(estimator.get_state() == NS::TrainingState::Training) {
+                    if(estimator.fit(trainingData.data(), trainingData.size()) == NS::FitResult::Reset)
+                        continue;
+
+                    estimator.on_data_completed();
+                }
+
+                estimator.complete_training();
+                pTransformer = estimator.create_transformer();
+            }
+        )
+    );
+
+    size_t                                  numOutputs(0);
+    CallbackFunction const                  callback(
+        [&numOutputs](TransformedType) {
+            ++numOutputs;
+        }
+    );
+
+    writer.write(
+        BM::Measure(
+            "cpp",
+            name,
+            "transform",
+            inferenceRows,
+            [&](void) {
+                for(auto const &input : inferenceData)
+                    pTransformer->execute(input, callback);
+
+                pTransformer->flush(callback);
+            }
+        )
+    );
+
+    if(numOutputs == 0)
+        throw std::runtime_error(name + " didn't produce any output");
+
+    NS::Archive::ByteArray                  buffer;
+    BM::Measurement                         serializeMeasurement(
+        BM::Measure(
+            "cpp",
+            name,
+            "serialize",
+            settings.SerializationIterations,
+            [&](void) {
+                for(size_t iteration = 0; iteration < settings.SerializationIterations; ++iteration) {
+                    NS::Archive     archive;
+
+                    pTransformer->save(archive);
+                    buffer = archive.commit();
+                }
+            }
+        )
+    );
+
+    serializeMeasurement.SerializedBytes = buffer.size();
+    writer.write(serializeMeasurement);
+
+    writer.write(
+        BM::Measure(
+            "cpp",
+            name,
+            "deserialize",
+            settings.SerializationIterations,
+            [&](void) {
+                for(size_t iteration = 0; iteration < settings.SerializationIterations; ++iteration) {
+                    NS::Archive     archive(buffer.data(), buffer.size());
+                    TransformerType transformer(archive);
+                }
+            }
+        )
+    );
+}
+
+template <typename EstimatorT, typename InputT>
+void BenchmarkEstimator(
+    Settings const &settings,
+    BM::JsonWriter &writer,
+    std::string const &name,
+    EstimatorT &estimator,
+    std::vector<InputT> const &trainingData,
+    std::vector<InputT> const &inferenceData
+) {
+    BenchmarkEstimator(settings, writer, name, estimator, trainingData, trainingData.size(), inferenceData, inferenceData.size());
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            CallCApi
+///  \brief         Invokes a C interface function, converting errors into
+///                 exceptions.
+///
+template <typename FunctorT>
+void CallCApi(FunctorT const &func) {
+    ErrorInfoHandle *                       pErrorInfo(nullptr);
+
+    if(func(&pErrorInfo) && pErrorInfo == nullptr)
+        return;
+
+    std::string                             message("Unknown error");
+
+    if(pErrorInfo != nullptr) {
+        char const *                        pMessage(nullptr);
+
+        if(GetErrorInfoString(pErrorInfo, &pMessage) && pMessage != nullptr) {
+            message = pMessage;
+            DestroyErrorInfoString(pMessage);
+        }
+
+        DestroyErrorInfo(pErrorInfo);
+    }
+
+    throw std::runtime_error(message);
+}
+
+/////////////////////////////////////////////////////////////////////////
+///  \fn            BenchmarkCApi
+///  \brief         Benchmarks a featurizer through the functions exported by
+///                 the shared library, using the buffer-based functions for
+///                 training and inference.
+///
+template <typename InputT, typename OutputT, typename EstimatorHandleT, typename TransformerHandleT, typename CreateEstimatorFunctorT>
+void BenchmarkCApi(
+    Settings const &settings,
+    BM::JsonWriter &writer,
+    std::string const &name,
+    CreateEstimatorFunctorT const &createFunc,
+    bool (*destroyEstimatorFunc)(EstimatorHandleT *, ErrorInfoHandle **),
+    bool (*getStateFunc)(EstimatorHandleT *, TrainingState *, ErrorInfoHandle **),
+    bool (*fitBufferFunc)(EstimatorHandleT *, InputT const *, size_t, FitResult *, ErrorInfoHandle **),
+    bool (*onDataCompletedFunc)(EstimatorHandleT *, ErrorInfoHandle **),
+    bool (*completeTrainingFunc)(EstimatorHandleT *, ErrorInfoHandle **),
+    bool (*createTransformerFromEstimatorFunc)(EstimatorHandleT *, TransformerHandleT **, ErrorInfoHandle **),
+    bool (*createTransformerFromSavedDataFunc)(unsigned char const *, size_t, TransformerHandleT **, ErrorInfoHandle **),
+    bool (*destroyTransformerFunc)(TransformerHandleT *, ErrorInfoHandle **),
+    bool (*createTransformerSaveDataFunc)(TransformerHandleT *, unsigned char const **, size_t *, ErrorInfoHandle **),
+    bool (*transformBufferFunc)(TransformerHandleT *, InputT const *, size_t, OutputT *, ErrorInfoHandle **),
+    std::vector<InputT> const &trainingData,
+    std::vector<InputT> const &inferenceData
+) {
+    TransformerHandleT *                    pTransformerHandle(nullptr);
+
+    writer.write(
+        BM::Measure(
+            "c",
+            name,
+            "fit",
+            trainingData.size(),
+            [&](void) {
+                EstimatorHandleT *          pEstimatorHandle(nullptr);
+
+                CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return createFunc(&pEstimatorHandle, ppErrorInfo); });
+
+                while(true) {
+                    TrainingState           state(0);
+
+                    CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return getStateFunc(pEstimatorHandle, &state, ppErrorInfo); });
+
+                    if(state != Training)
+                        break;
+
+                    FitResult               result(0);
+
+                    CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return fitBufferFunc(pEstimatorHandle, trainingData.data(), trainingData.size(), &result, ppErrorInfo); });
+
+                    if(result == ResetAndContinue)
+                        continue;
+
+                    CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return onDataCompletedFunc(pEstimatorHandle, ppErrorInfo); });
+                }
+
+                CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return completeTrainingFunc(pEstimatorHandle, ppErrorInfo); });
+                CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return createTransformerFromEstimatorFunc(pEstimatorHandle, &pTransformerHandle, ppErrorInfo); });
+                CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return destroyEstimatorFunc(pEstimatorHandle, ppErrorInfo); });
+            }
+        )
+    );
+
+    std::vector<OutputT>                    output(inferenceData.size());
+
+    writer.write(
+        BM::Measure(
+            "c",
+            name,
+            "transform",
+            inferenceData.size(),
+            [&](void) {
+                CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return transformBufferFunc(pTransformerHandle, inferenceData.data(), inferenceData.size(), output.data(), ppErrorInfo); });
+            }
+        )
+    );
+
+    size_t                                  cBuffer(0);
+    BM::Measurement                         serializeMeasurement(
+        BM::Measure(
+            "c",
+            name,
+            "serialize",
+            settings.SerializationIterations,
+            [&](void) {
+                for(size_t iteration = 0; iteration < settings.SerializationIterations; ++iteration) {
+                    unsigned char const *   pBuffer(nullptr);
+
+                    CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return createTransformerSaveDataFunc(pTransformerHandle, &pBuffer, &cBuffer, ppErrorInfo); });
+                    CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return DestroyTransformerSaveData(pBuffer, cBuffer, ppErrorInfo); });
+                }
+            }
+        )
+    );
+
+    serializeMeasurement.SerializedBytes = cBuffer;
+    writer.write(serializeMeasurement);
+
+    unsigned char const *                   pBuffer(nullptr);
+
+    CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return createTransformerSaveDataFunc(pTransformerHandle, &pBuffer, &cBuffer, ppErrorInfo); });
+
+    writer.write(
+        BM::Measure(
+            "c",
+            name,
+            "deserialize",
+            settings.SerializationIterations,
+            [&](void) {
+                for(size_t iteration = 0; iteration < settings.SerializationIterations; ++iteration) {
+                    TransformerHandleT *    pOther(nullptr);
+
+                    CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return createTransformerFromSavedDataFunc(pBuffer, cBuffer, &pOther, ppErrorInfo); });
+                    CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return destroyTransformerFunc(pOther, ppErrorInfo); });
+                }
+            }
+        )
+    );
+
+    CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return DestroyTransformerSaveData(pBuffer, cBuffer, ppErrorInfo); });
+    CallCApi([&](ErrorInfoHandle **ppErrorInfo) { return destroyTransformerFunc(pTransformerHandle, ppErrorInfo); });
+}
+
+// The functions shared by every featurizer, in the order expected by `BenchmarkCApi`
+#define C_API_FUNCTIONS(Prefix)                                                 \
+    Prefix##_DestroyEstimator,                                                  \
+    Prefix##_GetState,                                                          \
+    Prefix##_FitBuffer,                                                         \
+    Prefix##_OnDataCompleted,                                                   \
+    Prefix##_CompleteTraining,                                                  \
+    Prefix##_CreateTransformerFromEstimator,                                    \
+    Prefix##_CreateTransformerFromSavedData,                                    \
+    Prefix##_DestroyTransformer,                                                \
+    Prefix##_CreateTransformerSaveData,                                         \
+    Prefix##_TransformBuffer
+
+// ----------------------------------------------------------------------
+// |
+// |  Data
+// |
+// ----------------------------------------------------------------------
+std::vector<std::vector<std::string>> CreateGrains(void) {
+    std::vector<std::vector<std::string>>   result;
+
+    for(int grain = 0; grain < 10; ++grain)
+        result.emplace_back(std::vector<std::string>{ "store_" + std::to_string(grain), "product" });
+
+    return result;
+}
+
+template <typename MatrixT>
+MatrixT CreateMatrix(BM::DataGenerator &generator, Eigen::Index numRows, Eigen::Index numCols) {
+    MatrixT                                 result(numRows, numCols);
+
+    for(Eigen::Index row = 0; row < numRows; ++row) {
+        // Correlated columns so that the decompositions have structure to find
+        double const                        base(generator.real(-1.0, 1.0));
+
+        for(Eigen::Index col = 0; col < numCols; ++col)
+            result(row, col) = static_cast<typename MatrixT::Scalar>(base * static_cast<double>(col + 1) + generator.real(-0.1, 0.1));
+    }
+
+    return result;
+}
+
+// ----------------------------------------------------------------------
+// |
+// |  Benchmarks
+// |
+// ----------------------------------------------------------------------
+NS::AnnotationMapsPtr CreateAnnotations(void) {
+    return std::make_shared<NS::AnnotationMaps>(1);
+}
+
+/// Returns a benchmark for an estimator whose input is a single value per
+/// row; `args` are the estimator's constructor arguments after the annotations.
+template <typename EstimatorT, typename CreateValueFunctorT, typename... ArgsT>
+BenchmarkFunction ScalarBenchmark(CreateValueFunctorT createValueFunc, ArgsT... args) {
+    return
+        [createValueFunc, args...](Settings const &settings, BM::JsonWriter &writer, std::string const &name) {
+            BM::DataGenerator               generator(settings.Seed);
+
+            auto const                      trainingData(Generate(settings.Rows, [&generator, &createValueFunc](void) { return createValueFunc(generator); }));
+            auto const                      inferenceData(Generate(settings.Rows, [&generator, &createValueFunc](void) { return createValueFunc(generator); }));
+
+            EstimatorT                      estimator(CreateAnnotations(), args...);
+
+            BenchmarkEstimator(settings, writer, name, estimator, trainingData, inferenceData);
+        };
+}
+
+/// Returns a benchmark for a grained estimator, where each row is a grain
+/// and a value.
+template <typename EstimatorT, typename... ArgsT>
+BenchmarkFunction GrainedBenchmark(ArgsT... args) {
+    return
+        [args...](Settings const &settings, BM::JsonWriter &writer, std::string const &name) {
+            using InputType                 = typename EstimatorT::InputType;
+
+            BM::DataGenerator               generator(settings.Seed);
+            std::vector<std::vector<std::string>> const     grains(CreateGrains());
+
+            std::vector<std::double_t> const                trainingValues(Generate(settings.Rows, [&generator](void) { return generator.real(0.0, 100.0); }));
+            std::vector<std::double_t> const                inferenceValues(Generate(settings.Rows, [&generator](void) { return generator.real(0.0, 100.0); }));
+
+            std::vector<InputType>          trainingData;
+            std::vector<InputType>          inferenceData;
+
+            trainingData.reserve(settings.Rows);
+            inferenceData.reserve(settings.Rows);
+
+            for(size_t row = 0; row < settings.Rows; ++row) {
+                trainingData.emplace_back(grains[row % grains.size()], trainingValues[row]);
+                inferenceData.emplace_back(grains[row % grains.size()], inferenceValues[row]);
+            }
+
+            EstimatorT                      estimator(CreateAnnotations(), args...);
+
+            BenchmarkEstimator(settings, writer, name, estimator, trainingData, inferenceData);
+        };
+}
+
+/// Returns a benchmark for a normalize estimator, where each row is a vector.
+template <typename EstimatorT>
+BenchmarkFunction NormalizeBenchmark(void) {
+    return
+        [](Settings const &settings, BM::JsonWriter &writer, std::string const &name) {
+            using InputType                 = typename EstimatorT::InputType;
+
+            size_t const                    numCols(8);
+
+            BM::DataGenerator               generator(settings.Seed);
+            std::vector<std::double_t> const                trainingValues(Generate(settings.Rows * numCols, [&generator](void) { return generator.real(-100.0, 100.0); }));
+            std::vector<std::double_t> const                inferenceValues(Generate(settings.Rows * numCols, [&generator](void) { return generator.real(-100.0, 100.0); }));
+
+            std::vector<InputType>          trainingData;
+            std::vector<InputType>          inferenceData;
+
+            trainingData.reserve(settings.Rows);
+            inferenceData.reserve(settings.Rows);
+
+            for(size_t row = 0; row < settings.Rows; ++row) {
+                trainingData.emplace_back(trainingValues.begin() + static_cast<std::ptrdiff_t>(row * numCols), trainingValues.begin() + static_cast<std::ptrdiff_t>((row + 1) * numCols));
+                inferenceData.emplace_back(inferenceValues.begin() + static_cast<std::ptrdiff_t>(row * numCols), inferenceValues.begin() + static_cast<std::ptrdiff_t>((row + 1) * numCols));
+            }
+
+            EstimatorT                      estimator(CreateAnnotations(), 0);
+
+            BenchmarkEstimator(settings, writer, name, estimator, trainingData, inferenceData);
+        };
+}
+
+/// Returns a benchmark for an estimator whose input is a matrix. The
+/// estimator is trained with a single matrix and inference is performed
+/// in batches of rows.
+template <typename EstimatorT, typename... ArgsT>
+BenchmarkFunction MatrixBenchmark(ArgsT... args) {
+    return
+        [args...](Settings const &settings, BM::JsonWriter &writer, std::string const &name) {
+            using MatrixType                = typename EstimatorT::InputType;
+
+            Eigen::Index const              numRows(static_cast<Eigen::Index>(settings.Rows));
+            Eigen::Index const              numCols(16);
+            Eigen::Index const              batchRows(256);
+
+            BM::DataGenerator               generator(settings.Seed);
+            std::vector<MatrixType>         trainingData;
+            std::vector<MatrixType>         inferenceData;
+
+            trainingData.emplace_back(CreateMatrix<MatrixType>(generator, numRows, numCols));
+
+            for(Eigen::Index row = 0; row < numRows; row += batchRows)
+                inferenceData.emplace_back(CreateMatrix<MatrixType>(generator, std::min(batchRows, numRows - row), numCols));
+
+            EstimatorT                      estimator(CreateAnnotations(), args...);
+
+            BenchmarkEstimator(settings, writer, name, estimator, trainingData, settings.Rows, inferenceData, settings.Rows);
+        };
+}
+
+void ForecastingPivotBenchmark(Settings const &settings, BM::JsonWriter &writer, std::string const &name) {
+    using MatrixType                        = Eigen::Map<NS::RowMajMatrix<std::double_t>>;
+    using MatrixIterator                    = std::vector<MatrixType>::iterator;
+    using InputType                         = std::tuple<MatrixIterator, MatrixIterator>;
+    using EstimatorType                     = NS::Featurizers::ForecastingPivotEstimator<InputType>;
+
+    // Each row is 2 matrices of 1 row by 4 columns, where some of the columns
+    // contain null values and are excluded from the output.
+    Eigen::Index const                      horizon(4);
+    size_t const                            matricesPerRow(2);
+
+    BM::DataGenerator                       generator(settings.Seed);
+    std::vector<std::double_t>              values(
+        Generate(
+            settings.Rows * matricesPerRow * static_cast<size_t>(horizon),
+            [&generator](void) { return NullableValue(generator, generator.real(0.0, 100.0)); }
+        )
+    );
+
+    std::vector<MatrixType>                 matrices;
+
+    matrices.reserve(settings.Rows * matricesPerRow);
+
+    for(size_t index = 0; index < settings.Rows * matricesPerRow; ++index)
+        matrices.emplace_back(values.data() + index * static_cast<size_t>(horizon), 1, horizon);
+
+    std::vector<InputType>                  data;
+
+    data.reserve(settings.Rows);
+
+    for(size_t row = 0; row < settings.Rows; ++row)
+        data.emplace_back(matrices.begin() + static_cast<std::ptrdiff_t>(row * matricesPerRow), matrices.begin() + static_cast<std::ptrdiff_t>((row + 1) * matricesPerRow));
+
+    EstimatorType                           estimator(CreateAnnotations());
+
+    BenchmarkEstimator(settings, writer, name, estimator, data, data);
+}
+
+void TimeSeriesImputerBenchmark(Settings const &settings, BM::JsonWriter &writer, std::string const &name) {
+    using InputType                         = std::tuple<std::chrono::system_clock::time_point, std::vector<std::string>, std::vector<nonstd::optional<std::string>>>;
+    using EstimatorType                     = NS::Featurizers::TimeSeriesImputerEstimator;
+
+    // Daily values for each grain, where 10% of the values are missing
+    std::vector<std::vector<std::string>> const     grains(CreateGrains());
+    size_t const                            rowsPerGrain(settings.Rows / grains.size() == 0 ? 1 : settings.Rows / grains.size());
+
+    auto const                              createData(
+        [&grains, rowsPerGrain](BM::DataGenerator &generator) {
+            std::chrono::system_clock::time_point const     start(std::chrono::hours(24 * 365 * 40));
+            std::vector<InputType>          result;
+
+            result.reserve(rowsPerGrain * grains.size());
+
+            for(auto const &grain : grains) {
+                for(size_t row = 0; row < rowsPerGrain; ++row) {
+                    std::vector<nonstd::optional<std::string>>  values;
+
+                    for(int col = 0; col < 2; ++col) {
+                        if(generator.probability(0.1))
+                            values.emplace_back();
+                        else
+                            values.emplace_back(std::to_string(generator.integer(0, 1000)));
+                    }
+
+                    result.emplace_back(start + std::chrono::hours(24 * static_cast<int>(row)), grain, std::move(values));
+                }
+            }
+
+            return result;
+        }
+    );
+
+    BM::DataGenerator                       generator(settings.Seed);
+    std::vector<InputType> const            trainingData(createData(generator));
+    std::vector<InputType> const            inferenceData(createData(generator));
+
+    EstimatorType                           estimator(CreateAnnotations(), std::vector<NS::TypeId>{ NS::TypeId::Float64, NS::TypeId::Float64 });
+
+    BenchmarkEstimator(settings, writer, name, estimator, trainingData, inferenceData);
+}
+
+void DateTimeBatchBenchmark(Settings const &settings, BM::JsonWriter &writer, std::string const &name) {
+    using TimePoint                         = NS::Featurizers::TimePoint;
+    using SysClock                          = std::chrono::system_clock;
+
+    // The same timestamps (between 1970 and 2100) are converted one at a time,
+    // as an array of TimePoint structs, and as a column per TimePoint member.
+    BM::DataGenerator                       generator(settings.Seed);
+    std::vector<std::int64_t> const         seconds(Generate(settings.Rows, [&generator](void) { return generator.integer<std::int64_t>(0, 4102444799); }));
+    std::vector<SysClock::time_point>       timePoints;
+
+    timePoints.reserve(seconds.size());
+
+    for(auto const &value : seconds)
+        timePoints.emplace_back(SysClock::from_time_t(static_cast<time_t>(value)));
+
+    auto const                              getChecksum(
+        [](TimePoint const &result) {
+            return result.year + result.dayOfYear + result.weekIso + static_cast<std::int64_t>(result.holidayName.size());
+        }
+    );
+
+    NS::Featurizers::DateTimeTransformer    transformer((std::string()));
+    std::int64_t                            scalarChecksum(0);
+
+    writer.write(
+        BM::Measure(
+            "cpp",
+            name,
+            "transform_scalar",
+            timePoints.size(),
+            [&](void) {
+                for(auto const &timePoint : timePoints)
+                    scalarChecksum += getChecksum(transformer.execute(timePoint));
+            }
+        )
+    );
+
+    std::vector<TimePoint>                  results(timePoints.size());
+
+    writer.write(
+        BM::Measure(
+            "cpp",
+            name,
+            "transform_batch",
+            timePoints.size(),
+            [&](void) {
+                transformer.execute_batch(timePoints.data(), timePoints.size(), results.data());
+            }
+        )
+    );
+
+    std::int64_t                            batchChecksum(0);
+
+    for(auto const &result : results)
+        batchChecksum += getChecksum(result);
+
+    std::vector<std::int32_t>               year(seconds.size());
+    std::vector<std::uint8_t>               month(seconds.size());
+    std::vector<std::uint8_t>               day(seconds.size());
+    std::vector<std::uint8_t>               hour(seconds.size());
+    std::vector<std::uint8_t>               minute(seconds.size());
+    std::vector<std::uint8_t>               second(seconds.size());
+    std::vector<std::uint8_t>               amPm(seconds.size());
+    std::vector<std::uint8_t>               hour12(seconds.size());
+    std::vector<std::uint8_t>               dayOfWeek(seconds.size());
+    std::vector<std::uint8_t>               dayOfQuarter(seconds.size());
+    std::vector<std::uint16_t>              dayOfYear(seconds.size());
+    std::vector<std::uint16_t>              weekOfMonth(seconds.size());
+    std::vector<std::uint8_t>               quarterOfYear(seconds.size());
+    std::vector<std::uint8_t>               halfOfYear(seconds.size());
+    std::vector<std::uint8_t>               weekIso(seconds.size());
+    std::vector<std::int32_t>               yearIso(seconds.size());
+    std::vector<NS::Featurizers::TimePointLabel>    holidayName(seconds.size());
+
+    NS::Featurizers::TimePointColumns       columns;
+
+    columns.year = year.data();
+    columns.month = month.data();
+    columns.day = day.data();
+    columns.hour = hour.data();
+    columns.minute = minute.data();
+    columns.second = second.data();
+    columns.amPm = amPm.data();
+    columns.hour12 = hour12.data();
+    columns.dayOfWeek = dayOfWeek.data();
+    columns.dayOfQuarter = dayOfQuarter.data();
+    columns.dayOfYear = dayOfYear.data();
+    columns.weekOfMonth = weekOfMonth.data();
+    columns.quarterOfYear = quarterOfYear.data();
+    columns.halfOfYear = halfOfYear.data();
+    columns.weekIso = weekIso.data();
+    columns.yearIso = yearIso.data();
+    columns.holidayName = holidayName.data();
+
+    writer.write(
+        BM::Measure(
+            "cpp",
+            name,
+            "transform_columns",
+            seconds.size(),
+            [&](void) {
+                transformer.execute_batch(seconds.data(), seconds.size(), columns);
+            }
+        )
+    );
+
+    std::int64_t                            columnsChecksum(0);
+
+    for(size_t index = 0; index < seconds.size(); ++index)
+        columnsChecksum += year[index] + dayOfYear[index] + weekIso[index] + static_cast<std::int64_t>(holidayName[index].size());
+
+    if(scalarChecksum != batchChecksum || scalarChecksum != columnsChecksum)
+        throw std::runtime_error("Unexpected checksum");
+}
+
+/// Measures PCATransformer inference with all of the components and with the
+/// top components, where each call to `execute` is passed a batch of rows.
+template <typename T>
+void PCATransformerBenchmark(Settings const &settings, BM::JsonWriter &writer, std::string const &name) {
+    using MatrixType                        = NS::RowMajMatrix<T>;
+    using TransformerType                   = NS::Featurizers::PCATransformer<MatrixType>;
+
+    Eigen::Index const                      numRows(static_cast<Eigen::Index>(settings.Rows));
+    Eigen::Index const                      numFeatures(64);
+
+    BM::DataGenerator                       generator(settings.Seed);
+    MatrixType const                        data(CreateMatrix<MatrixType>(generator, numRows, numFeatures));
+    MatrixType const                        eigenvectors(CreateMatrix<MatrixType>(generator, numFeatures, numFeatures));
+
+    for(Eigen::Index numComponents : { numFeatures, Eigen::Index(8) }) {
+        TransformerType                     transformer((MatrixType(eigenvectors.topRows(numComponents))));
+
+        for(Eigen::Index batchRows : { Eigen::Index(1), Eigen::Index(16), Eigen::Index(256), Eigen::Index(4096) }) {
+            if(batchRows > numRows)
+                continue;
+
+            Eigen::Index const              numBatches(numRows / batchRows);
+            size_t const                    batchedRows(static_cast<size_t>(numBatches * batchRows));
+            std::vector<MatrixType>         batches;
+
+            batches.reserve(static_cast<size_t>(numBatches));
+
+            for(Eigen::Index batch = 0; batch < numBatches; ++batch)
+                batches.emplace_back(data.middleRows(batch * batchRows, batchRows));
+
+            size_t                          transformedRows(0);
+
+            writer.write(
+                BM::Measure(
+                    "cpp",
+                    name,
+                    "transform_" + std::to_string(numComponents) + "_components_" + std::to_string(batchRows) + "_rows",
+                    batchedRows,
+                    [&](void) {
+                        for(auto const &batch : batches)
+                            transformedRows += static_cast<size_t>(transformer.execute(batch).rows());
+                    }
+                )
+            );
+
+            if(transformedRows != batchedRows)
+                throw std::runtime_error("Unexpected number of rows");
+        }
+    }
+}
+
+template <typename TableT>
+void PointerTableBenchmarkImpl(Settings const &settings, BM::JsonWriter &writer, std::string const &name, std::string const &operationPrefix) {
+    size_t const                            maxThreads(std::max(static_cast<size_t>(std::thread::hardware_concurrency()), static_cast<size_t>(1)));
+
+    for(size_t addRemoveEvery : { static_cast<size_t>(0), static_cast<size_t>(100) }) {
+        for(size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+            TableT                          table;
+            std::vector<int>                values(numThreads, 1);
+            std::vector<size_t>             indexes;
+
+            for(auto &value : values)
+                indexes.emplace_back(table.Add(&value));
+
+            std::atomic<bool>               start(false);
+            std::atomic<size_t>             checksum(0);
+            std::vector<std::thread>        threads;
+
+            // The threads are created before the measurement begins and wait
+            // until it starts.
+            for(size_t thread = 0; thread < numThreads; ++thread) {
+                threads.emplace_back(
+                    [&, thread](void) {
+                        int                 local(0);
+                        size_t              sum(0);
+
+                        while(start.load() == false)
+                            std::this_thread::yield();
+
+                        for(size_t row = 0; row < settings.Rows; ++row) {
+                            sum += static_cast<size_t>(*table.template Get<int>(indexes[thread]));
+
+                            if(addRemoveEvery != 0 && row % addRemoveEvery == 0)
+                                table.Remove(table.Add(&local));
+                        }
+
+                        checksum += sum;
+                    }
+                );
+            }
+
+            writer.write(
+                BM::Measure(
+                    "cpp",
+                    name,
+                    operationPrefix + (addRemoveEvery == 0 ? "get_" : "get_add_remove_") + std::to_string(numThreads) + "_threads",
+                    numThreads * settings.Rows,
+                    [&](void) {
+                        start = true;
+
+                        for(auto &thread : threads)
+                            thread.join();
+                    }
+                )
+            );
+
+            if(checksum.load() != numThreads * settings.Rows)
+                throw std::runtime_error("Unexpected checksum");
+        }
+    }
+}
+
+void PointerTableBenchmark(Settings const &settings, BM::JsonWriter &writer, std::string const &name) {
+    // Each thread owns a handle and resolves it for every row (which is what
+    // happens when each thread invokes its own transformer through the C
+    // interface); the "add_remove" operations also add and remove a pointer
+    // every 100 rows. The "mutex_" operations measure the same work with the
+    // previous implementation.
+    //
+    // Allocations are only counted on the measuring thread, so these
+    // operations don't include the allocations made by the worker threads.
+    PointerTableBenchmarkImpl<MutexPointerTable>(settings, writer, name, "mutex_");
+    PointerTableBenchmarkImpl<NS::PointerTable>(settings, writer, name, "");
+}
+
+void ParseRegexBenchmark(Settings const &settings, BM::JsonWriter &writer, std::string const &name) {
+    // The pattern is compiled for each document, and compiled once and reused.
+    BM::DataGenerator                       generator(settings.Seed);
+    std::vector<std::string> const          documents(Generate(settings.Rows, [&generator](void) { return generator.document(20, 1000); }));
+    std::string const                       pattern("[^\\s]+");
+
+    size_t                                  compileChecksum(0);
+
+    writer.write(
+        BM::Measure(
+            "cpp",
+            name,
+            "compile_per_document",
+            documents.size(),
+            [&](void) {
+                for(auto const &document : documents) {
+                    NS::Strings::ParseRegex(
+                        document.c_str(),
+                        document.size(),
+                        pattern,
+                        [&compileChecksum](char const *, size_t cCharacters) {
+                            compileChecksum += cCharacters;
+                        }
+                    );
+                }
+            }
+        )
+    );
+
+    re2::RE2 const                          regex(pattern);
+    size_t                                  compiledChecksum(0);
+
+    writer.write(
+        BM::Measure(
+            "cpp",
+            name,
+            "compiled",
+            documents.size(),
+            [&](void) {
+                for(auto const &document : documents) {
+                    NS::Strings::ParseRegex(
+                        document.c_str(),
+                        document.size(),
+                        regex,
+                        [&compiledChecksum](char const *, size_t cCharacters) {
+                            compiledChecksum += cCharacters;
+                        }
+                    );
+                }
+            }
+        )
+    );
+
+    if(compileChecksum != compiledChecksum)
+        throw std::runtime_error("Unexpected checksum");
+}
+
+/// Returns a benchmark for the C interface of a featurizer whose input is a
+/// number.
+template <typename InputT, typename CreateValueFunctorT, typename... ArgsT>
+BenchmarkFunction CApiBenchmark(CreateValueFunctorT createValueFunc, ArgsT... args) {
+    return
+        [createValueFunc, args...](Settings const &settings, BM::JsonWriter &writer, std::string const &name) {
+            BM::DataGenerator               generator(settings.Seed);
+
+            std::vector<InputT> const       trainingData(Generate(settings.Rows, [&generator, &createValueFunc](void) { return createValueFunc(generator); }));
+            std::vector<InputT> const       inferenceData(Generate(settings.Rows, [&generator, &createValueFunc](void) { return createValueFunc(generator); }));
+
+            BenchmarkCApi(settings, writer, name, args..., trainingData, inferenceData);
+        };
+}
+
+/// Returns a benchmark for the C interface of a featurizer whose input is a
+/// string.
+template <typename CreateValueFunctorT, typename... ArgsT>
+BenchmarkFunction CApiStringBenchmark(CreateValueFunctorT createValueFunc, ArgsT... args) {
+    return
+        [createValueFunc, args...](Settings const &settings, BM::JsonWriter &writer, std::string const &name) {
+            BM::DataGenerator               generator(settings.Seed);
+
+            std::vector<std::string> const  trainingStrings(Generate(settings.Rows, [&generator, &createValueFunc](void) { return createValueFunc(generator); }));
+            std::vector<std::string> const  inferenceStrings(Generate(settings.Rows, [&generator, &createValueFunc](void) { return createValueFunc(generator); }));
+
+            std::vector<char const *>       trainingData;
+            std::vector<char const *>       inferenceData;
+
+            for(auto const &value : trainingStrings)
+                trainingData.emplace_back(value.c_str());
+
+            for(auto const &value : inferenceStrings)
+                inferenceData.emplace_back(value.c_str());
+
+            BenchmarkCApi(settings, writer, name, args..., trainingData, inferenceData);
+        };
+}
+
+} // anonymous namespace
+
+int main(int argc, char const * const *argv) {
+    // ----------------------------------------------------------------------
+    using AnalyzerMethod                    = NS::Featurizers::Components::AnalyzerMethod;
+    using RealRange                         = std::pair<std::vector<std::double_t>::const_iterator, std::vector<std::double_t>::const_iterator>;
+    using Benchmark                         = std::pair<std::string, BenchmarkFunction>;
+    // ----------------------------------------------------------------------
+
+    long long const                         rowsArg(argc > 1 ? std::atoll(argv[1]) : 100000);
+
+    if(argc > 4 || rowsArg <= 0) {
+        std::cerr << "Usage: FeaturizersBenchmarks [num_rows] [seed] [filter]\n\n    num_rows must be greater than 0.\n";
+        return -1;
+    }
+
+    size_t const                            numRows(static_cast<size_t>(rowsArg));
+    std::uint64_t const                     seed(argc > 2 ? static_cast<std::uint64_t>(std::atoll(argv[2])) : 12345);
+    std::string const                       filter(argc > 3 ? argv[3] : "");
+
+    Settings const                          settings{ numRows, seed, numRows / 1000 == 0 ? 1 : numRows / 1000 };
+
+    auto const                              createReal(
+        [](BM::DataGenerator &generator) {
+            return generator.real(-1000.0, 1000.0);
+        }
+    );
+
+    auto const                              createNullableReal(
+        [](BM::DataGenerator &generator) {
+            return NullableValue(generator, generator.real(-1000.0, 1000.0));
+        }
+    );
+
+    auto const                              createInt(
+        [](BM::DataGenerator &generator) {
+            return generator.integer<std::int32_t>(-1000, 1000);
+        }
+    );
+
+    auto const                              createNullableInt(
+        [](BM::DataGenerator &generator) {
+            return NullableValue(generator, nonstd::optional<std::int32_t>(generator.integer<std::int32_t>(0, 9)));
+        }
+    );
+
+    auto const                              createCategory(
+        [](BM::DataGenerator &generator) {
+            return generator.category(100);
+        }
+    );
+
+    auto const                              createDocument(
+        [](BM::DataGenerator &generator) {
+            return generator.document(20, 1000);
+        }
+    );
+
+    auto const                              createIntString(
+        [&createInt](BM::DataGenerator &generator) {
+            return std::to_string(createInt(generator));
+        }
+    );
+
+    std::vector<std::vector<std::string>> const     grains(CreateGrains());
+
+    auto const                              createGrain(
+        [&grains](BM::DataGenerator &generator) {
+            return grains[generator.integer<size_t>(0, grains.size() - 1)];
+        }
+    );
+
+    std::vector<Benchmark> const            benchmarks{
+        // ----------------------------------------------------------------------
+        // |  C++
+        Benchmark(
+            "AnalyticalRollingWindowFeaturizer<double>",
+            GrainedBenchmark<NS::Featurizers::GrainedAnalyticalRollingWindowEstimator<std::double_t>>(NS::Featurizers::AnalyticalRollingWindowCalculation::Mean, 2u, 10u)
+        ),
+        Benchmark(
+            "BackwardFillImputerFeaturizer<double>",
+            ScalarBenchmark<NS::Featurizers::BackwardFillImputerEstimator<std::double_t>>(createNullableReal)
+        ),
+        Benchmark(
+            "CatImputerFeaturizer<int32>",
+            ScalarBenchmark<NS::Featurizers::CatImputerEstimator<std::int32_t>>(createNullableInt, 0)
+        ),
+        Benchmark(
+            "CountVectorizerFeaturizer",
+            ScalarBenchmark<NS::Featurizers::CountVectorizerEstimator<>>(createDocument, 0, true, AnalyzerMethod::Word, std::string(), 1.0f, 0.0f, nonstd::optional<std::uint32_t>(), 1u, 1u, false)
+        ),
+        Benchmark(
+            "DateTimeFeaturizer",
+            ScalarBenchmark<NS::Featurizers::DateTimeEstimator>(
+                [](BM::DataGenerator &generator) { return std::chrono::system_clock::time_point(std::chrono::seconds(generator.integer<std::int64_t>(0, 2000000000))); },
+                nonstd::optional<std::string>(),
+                nonstd::optional<std::string>()
+            )
+        ),
+        Benchmark(
+            "ForecastingPivotFeaturizer<double>",
+            ForecastingPivotBenchmark
+        ),
+        Benchmark(
+            "ForwardFillImputerFeaturizer<double>",
+            ScalarBenchmark<NS::Featurizers::ForwardFillImputerEstimator<std::double_t>>(createNullableReal)
+        ),
+        Benchmark(
+            "FromStringFeaturizer<int32>",
+            ScalarBenchmark<NS::Featurizers::FromStringEstimator<std::int32_t>>(createIntString)
+        ),
+        Benchmark(
+            "HashOneHotVectorizerFeaturizer<string>",
+            ScalarBenchmark<NS::Featurizers::HashOneHotVectorizerEstimator<std::string>>(createCategory, 12345u, 100u)
+        ),
+        Benchmark(
+            "ImputationMarkerFeaturizer<double>",
+            ScalarBenchmark<NS::Featurizers::ImputationMarkerEstimator<std::double_t>>(createNullableReal)
+        ),
+        Benchmark(
+            "L1NormalizeFeaturizer<double>",
+            NormalizeBenchmark<NS::Featurizers::L1NormalizeEstimator<RealRange>>()
+        ),
+        Benchmark(
+            "L2NormalizeFeaturizer<double>",
+            NormalizeBenchmark<NS::Featurizers::L2NormalizeEstimator<RealRange>>()
+        ),
+        Benchmark(
+            "LabelEncoderFeaturizer<string>",
+            ScalarBenchmark<NS::Featurizers::LabelEncoderEstimator<std::string>>(createCategory, 0, true)
+        ),
+        Benchmark(
+            "LagLeadOperatorFeaturizer<double>",
+            GrainedBenchmark<NS::Featurizers::GrainedLagLeadOperatorEstimator<std::double_t>>(2u, std::vector<std::int64_t>{ -1, 1 })
+        ),
+        Benchmark(
+            "MaxAbsScalerFeaturizer<int32>",
+            ScalarBenchmark<NS::Featurizers::MaxAbsScalerEstimator<std::int32_t, std::double_t>>(createInt, 0)
+        ),
+        Benchmark(
+            "MaxNormalizeFeaturizer<double>",
+            NormalizeBenchmark<NS::Featurizers::MaxNormalizeEstimator<RealRange>>()
+        ),
+        Benchmark(
+            "MeanImputerFeaturizer<double>",
+            ScalarBenchmark<NS::Featurizers::MeanImputerEstimator<std::double_t>>(createNullableReal, 0)
+        ),
+        Benchmark(
+            "MedianImputerFeaturizer<double>",
+            ScalarBenchmark<NS::Featurizers::MedianImputerEstimator<std::double_t, std::double_t>>(createNullableReal, 0)
+        ),
+        Benchmark(
+            "MinMaxImputerFeaturizer<double>",
+            ScalarBenchmark<NS::Featurizers::MinMaxImputerEstimator<std::double_t>>(createNullableReal, 0, true)
+        ),
+        Benchmark(
+            "MinMaxScalerFeaturizer<int32>",
+            ScalarBenchmark<NS::Featurizers::MinMaxScalerEstimator<std::int32_t>>(createInt, 0)
+        ),
+        Benchmark(
+            "MissingDummiesFeaturizer<double>",
+            ScalarBenchmark<NS::Featurizers::MissingDummiesEstimator<std::double_t>>(createNullableReal)
+        ),
+        Benchmark(
+            "ModeImputerFeaturizer<int32>",
+            ScalarBenchmark<NS::Featurizers::ModeImputerEstimator<std::int32_t>>(createNullableInt, 0)
+        ),
+        Benchmark(
+            "NumericalizeFeaturizer<string>",
+            ScalarBenchmark<NS::Featurizers::NumericalizeEstimator<std::string>>(createCategory, 0)
+        ),
+        Benchmark(
+            "OneHotEncoderFeaturizer<string>",
+            ScalarBenchmark<NS::Featurizers::OneHotEncoderEstimator<std::string>>(createCategory, 0, true)
+        ),
+        Benchmark(
+            "PCAFeaturizer<double>",
+            MatrixBenchmark<NS::Featurizers::PCAEstimator<NS::RowMajMatrix<std::double_t>>>(0, 4)
+        ),
+        Benchmark(
+            "RobustScalerFeaturizer<int32>",
+            ScalarBenchmark<NS::Featurizers::RobustScalerEstimator<std::int32_t, std::double_t>>(createInt, 0, true)
+        ),
+        Benchmark(
+            "ShortGrainDropperFeaturizer",
+            ScalarBenchmark<NS::Featurizers::ShortGrainDropperEstimator<>>(createGrain, 0, 5u)
+        ),
+        Benchmark(
+            "SimpleRollingWindowFeaturizer<double>",
+            GrainedBenchmark<NS::Featurizers::GrainedSimpleRollingWindowEstimator<std::double_t>>(NS::Featurizers::SimpleRollingWindowCalculation::Min, 2u, 10u)
+        ),
+        Benchmark(
+            "StandardScaleWrapperFeaturizer<int32>",
+            ScalarBenchmark<NS::Featurizers::StandardScaleWrapperEstimator<std::int32_t>>(createInt, 0, true, true)
+        ),
+        Benchmark(
+            "StringFeaturizer<int32>",
+            ScalarBenchmark<NS::Featurizers::StringEstimator<std::int32_t>>(createInt)
+        ),
+        Benchmark(
+            "TfidfVectorizerFeaturizer",
+            ScalarBenchmark<NS::Featurizers::TfidfVectorizerEstimator<>>(createDocument, 0, true, AnalyzerMethod::Word, std::string())
+        ),
+        Benchmark(
+            "TimeSeriesImputerFeaturizer",
+            TimeSeriesImputerBenchmark
+        ),
+        Benchmark(
+            "TruncatedSVDFeaturizer<double>",
+            MatrixBenchmark<NS::Featurizers::TruncatedSVDEstimator<NS::RowMajMatrix<std::double_t>>>(0, nonstd::optional<unsigned int>(12345), 4)
+        ),
+
+        // ----------------------------------------------------------------------
+        // |  C++ (transformer batch paths and shared components)
+        Benchmark("DateTimeTransformer", DateTimeBatchBenchmark),
+        Benchmark("PCATransformer<float>", PCATransformerBenchmark<std::float_t>),
+        Benchmark("PCATransformer<double>", PCATransformerBenchmark<std::double_t>),
+        Benchmark("PointerTable", PointerTableBenchmark),
+        Benchmark("Strings::ParseRegex", ParseRegexBenchmark),
+
+        // ----------------------------------------------------------------------
+        // |  C
+        Benchmark("FromStringFeaturizer_int32",
+            CApiStringBenchmark(
+                createIntString,
+                [](FromStringFeaturizer_int32_EstimatorHandle **ppHandle, ErrorInfoHandle **ppErrorInfo) { return FromStringFeaturizer_int32_CreateEstimator(false, ppHandle, ppErrorInfo); },
+                C_API_FUNCTIONS(FromStringFeaturizer_int32)
+            )
+        ),
+        Benchmark("LabelEncoderFeaturizer_string",
+            CApiStringBenchmark(
+                createCategory,
+                [](LabelEncoderFeaturizer_string_EstimatorHandle **ppHandle, ErrorInfoHandle **ppErrorInfo) { return LabelEncoderFeaturizer_string_CreateEstimator(true, ppHandle, ppErrorInfo); },
+                C_API_FUNCTIONS(LabelEncoderFeaturizer_string)
+            )
+        ),
+        Benchmark("MaxAbsScalerFeaturizer_float",
+            CApiBenchmark<std::float_t>(
+                [&createReal](BM::DataGenerator &generator) { return static_cast<std::float_t>(createReal(generator)); },
+                MaxAbsScalerFeaturizer_float_CreateEstimator,
+                C_API_FUNCTIONS(MaxAbsScalerFeaturizer_float)
+            )
+        ),
+        Benchmark("MeanImputerFeaturizer_float",
+            CApiBenchmark<std::float_t>(
+                [&createNullableReal](BM::DataGenerator &generator) { return static_cast<std::float_t>(createNullableReal(generator)); },
+                MeanImputerFeaturizer_float_CreateEstimator,
+                C_API_FUNCTIONS(MeanImputerFeaturizer_float)
+            )
+        ),
+        Benchmark("MinMaxScalerFeaturizer_int8",
+            CApiBenchmark<std::int8_t>(
+                [](BM::DataGenerator &generator) { return generator.integer<std::int8_t>(-100, 100); },
+                MinMaxScalerFeaturizer_int8_CreateEstimator,
+                C_API_FUNCTIONS(MinMaxScalerFeaturizer_int8)
+            )
+        )
+    };
+
+    BM::JsonWriter                          writer(std::cout, numRows, seed);
+
+    for(auto const &benchmark : benchmarks) {
+        if(filter.empty() == false && benchmark.first.find(filter) == std::string::npos)
+            continue;
+
+        benchmark.second(settings, writer, benchmark.first);
+    }
+
+    return 0;
+}
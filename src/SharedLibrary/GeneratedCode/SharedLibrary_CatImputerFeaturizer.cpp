@@ -369,6 +369,47 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_Transform(/*in*/ CatImpute
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_TransformBuffer(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::int8_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        while(input_buffer.size() < input_items) {
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int8_t>::CreateNullValue());
+            ++input_ptr;
+        }
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int8_t>::TransformedType;
+
+        for(size_t index = 0; index < input_buffer.size(); ++index) {
+            TransformedType result(transformer.execute(input_buffer.data()[index]));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int8_Flush(/*in*/ CatImputerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ int8_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -760,6 +801,47 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_Transform(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_TransformBuffer(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::int16_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        while(input_buffer.size() < input_items) {
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int16_t>::CreateNullValue());
+            ++input_ptr;
+        }
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int16_t>::TransformedType;
+
+        for(size_t index = 0; index < input_buffer.size(); ++index) {
+            TransformedType result(transformer.execute(input_buffer.data()[index]));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int16_Flush(/*in*/ CatImputerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ int16_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1151,6 +1233,47 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_Transform(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_TransformBuffer(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::int32_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        while(input_buffer.size() < input_items) {
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int32_t>::CreateNullValue());
+            ++input_ptr;
+        }
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int32_t>::TransformedType;
+
+        for(size_t index = 0; index < input_buffer.size(); ++index) {
+            TransformedType result(transformer.execute(input_buffer.data()[index]));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int32_Flush(/*in*/ CatImputerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ int32_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1542,6 +1665,47 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_Transform(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_TransformBuffer(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::int64_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        while(input_buffer.size() < input_items) {
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::int64_t>::CreateNullValue());
+            ++input_ptr;
+        }
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::int64_t>::TransformedType;
+
+        for(size_t index = 0; index < input_buffer.size(); ++index) {
+            TransformedType result(transformer.execute(input_buffer.data()[index]));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_int64_Flush(/*in*/ CatImputerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ int64_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1933,6 +2097,47 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_Transform(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_TransformBuffer(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint8_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        while(input_buffer.size() < input_items) {
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint8_t>::CreateNullValue());
+            ++input_ptr;
+        }
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint8_t>::TransformedType;
+
+        for(size_t index = 0; index < input_buffer.size(); ++index) {
+            TransformedType result(transformer.execute(input_buffer.data()[index]));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint8_Flush(/*in*/ CatImputerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ uint8_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2324,6 +2529,47 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_Transform(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_TransformBuffer(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint16_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        while(input_buffer.size() < input_items) {
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint16_t>::CreateNullValue());
+            ++input_ptr;
+        }
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint16_t>::TransformedType;
+
+        for(size_t index = 0; index < input_buffer.size(); ++index) {
+            TransformedType result(transformer.execute(input_buffer.data()[index]));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint16_Flush(/*in*/ CatImputerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ uint16_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2715,6 +2961,47 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_Transform(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_TransformBuffer(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint32_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        while(input_buffer.size() < input_items) {
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint32_t>::CreateNullValue());
+            ++input_ptr;
+        }
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint32_t>::TransformedType;
+
+        for(size_t index = 0; index < input_buffer.size(); ++index) {
+            TransformedType result(transformer.execute(input_buffer.data()[index]));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint32_Flush(/*in*/ CatImputerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ uint32_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3106,6 +3393,47 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_Transform(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_TransformBuffer(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<std::uint64_t>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        while(input_buffer.size() < input_items) {
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<std::uint64_t>::CreateNullValue());
+            ++input_ptr;
+        }
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::uint64_t>::TransformedType;
+
+        for(size_t index = 0; index < input_buffer.size(); ++index) {
+            TransformedType result(transformer.execute(input_buffer.data()[index]));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_uint64_Flush(/*in*/ CatImputerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3488,6 +3816,38 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_Transform(/*in*/ CatImput
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_TransformBuffer(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::float_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            TransformedType result(transformer.execute(input_ptr[index]));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_float_Flush(/*in*/ CatImputerFeaturizer_float_TransformerHandle *pHandle, /*out*/ float ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3870,6 +4230,38 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_Transform(/*in*/ CatImpu
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_TransformBuffer(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input_ptr, /*in*/ size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::CatImputerEstimator<std::double_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            TransformedType result(transformer.execute(input_ptr[index]));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_double_Flush(/*in*/ CatImputerFeaturizer_double_TransformerHandle *pHandle, /*out*/ double ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -4261,6 +4653,47 @@ FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_Transform(/*in*/ CatImpute
     }
 }
 
+FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_TransformBuffer(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * const * input_ptr, /*in*/ size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<Microsoft::Featurizer::Traits<bool>::nullable_type> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        while(input_buffer.size() < input_items) {
+            input_buffer.emplace_back(*input_ptr ? **input_ptr : Microsoft::Featurizer::Traits<bool>::CreateNullValue());
+            ++input_ptr;
+        }
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::CatImputerEstimator<bool>::TransformedType;
+
+        for(size_t index = 0; index < input_buffer.size(); ++index) {
+            TransformedType result(transformer.execute(input_buffer.data()[index]));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool CatImputerFeaturizer_bool_Flush(/*in*/ CatImputerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ bool ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
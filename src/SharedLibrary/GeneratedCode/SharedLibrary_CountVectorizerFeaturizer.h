@@ -41,6 +41,8 @@ FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_CreateTransformerSaveData(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_Transform(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const * input, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ uint32_t ** output_values, /*out*/ uint64_t ** output_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_TransformInto(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const * input_ptr, /*in*/ size_t input_size, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ uint32_t * output_values, /*out*/ uint64_t * output_indexes, /*in*/ size_t output_values_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_TransformBuffer(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint64_t * output_offsets_ptr, /*out*/ uint32_t * output_values_ptr, /*out*/ uint64_t * output_indexes_ptr, /*in*/ size_t output_values_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_Flush(/*in*/ CountVectorizerFeaturizer_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint64_t ** output_item_numValues_ptr, /*out*/ uint32_t *** output_item_values_ptr, /*out*/ uint64_t *** output_item_indexes_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool CountVectorizerFeaturizer_DestroyTransformedData(/*in*/ uint64_t result_numElements, /*in*/ uint64_t result_numValues, /*in*/ uint32_t const * result_values, /*in*/ uint64_t const * result_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
@@ -32,6 +32,7 @@ FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int8_DestroyTransformer
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int8_CreateTransformerSaveData(/*in*/ ForwardFillImputerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int8_Transform(/*in*/ ForwardFillImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input, /*out*/ int8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int8_TransformBuffer(/*in*/ ForwardFillImputerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int8_Flush(/*in*/ ForwardFillImputerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ int8_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -58,6 +59,7 @@ FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int16_DestroyTransforme
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int16_CreateTransformerSaveData(/*in*/ ForwardFillImputerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int16_Transform(/*in*/ ForwardFillImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input, /*out*/ int16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int16_TransformBuffer(/*in*/ ForwardFillImputerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int16_Flush(/*in*/ ForwardFillImputerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ int16_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -84,6 +86,7 @@ FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int32_DestroyTransforme
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int32_CreateTransformerSaveData(/*in*/ ForwardFillImputerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int32_Transform(/*in*/ ForwardFillImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input, /*out*/ int32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int32_TransformBuffer(/*in*/ ForwardFillImputerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int32_Flush(/*in*/ ForwardFillImputerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ int32_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -110,6 +113,7 @@ FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int64_DestroyTransforme
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int64_CreateTransformerSaveData(/*in*/ ForwardFillImputerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int64_Transform(/*in*/ ForwardFillImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input, /*out*/ int64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int64_TransformBuffer(/*in*/ ForwardFillImputerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_int64_Flush(/*in*/ ForwardFillImputerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ int64_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -136,6 +140,7 @@ FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint8_DestroyTransforme
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint8_CreateTransformerSaveData(/*in*/ ForwardFillImputerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint8_Transform(/*in*/ ForwardFillImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input, /*out*/ uint8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint8_TransformBuffer(/*in*/ ForwardFillImputerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint8_Flush(/*in*/ ForwardFillImputerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ uint8_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -162,6 +167,7 @@ FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint16_DestroyTransform
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint16_CreateTransformerSaveData(/*in*/ ForwardFillImputerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint16_Transform(/*in*/ ForwardFillImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input, /*out*/ uint16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint16_TransformBuffer(/*in*/ ForwardFillImputerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint16_Flush(/*in*/ ForwardFillImputerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ uint16_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -188,6 +194,7 @@ FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint32_DestroyTransform
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ ForwardFillImputerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint32_Transform(/*in*/ ForwardFillImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint32_TransformBuffer(/*in*/ ForwardFillImputerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint32_Flush(/*in*/ ForwardFillImputerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ uint32_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -214,6 +221,7 @@ FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint64_DestroyTransform
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint64_CreateTransformerSaveData(/*in*/ ForwardFillImputerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint64_Transform(/*in*/ ForwardFillImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input, /*out*/ uint64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint64_TransformBuffer(/*in*/ ForwardFillImputerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_uint64_Flush(/*in*/ ForwardFillImputerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -240,6 +248,7 @@ FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_float_DestroyTransforme
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_float_CreateTransformerSaveData(/*in*/ ForwardFillImputerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_float_Transform(/*in*/ ForwardFillImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_float_TransformBuffer(/*in*/ ForwardFillImputerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_float_Flush(/*in*/ ForwardFillImputerFeaturizer_float_TransformerHandle *pHandle, /*out*/ float ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -266,6 +275,7 @@ FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_double_DestroyTransform
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_double_CreateTransformerSaveData(/*in*/ ForwardFillImputerFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_double_Transform(/*in*/ ForwardFillImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_double_TransformBuffer(/*in*/ ForwardFillImputerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input_ptr, /*in*/ size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_double_Flush(/*in*/ ForwardFillImputerFeaturizer_double_TransformerHandle *pHandle, /*out*/ double ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -292,6 +302,7 @@ FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_bool_DestroyTransformer
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_bool_CreateTransformerSaveData(/*in*/ ForwardFillImputerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_bool_Transform(/*in*/ ForwardFillImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_bool_TransformBuffer(/*in*/ ForwardFillImputerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * const * input_ptr, /*in*/ size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool ForwardFillImputerFeaturizer_bool_Flush(/*in*/ ForwardFillImputerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ bool ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
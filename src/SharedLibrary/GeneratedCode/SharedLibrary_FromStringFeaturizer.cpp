@@ -369,6 +369,45 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_Transform(/*in*/ FromStrin
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_TransformBuffer(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        for(char const * const *input_item_ptr = input_ptr; input_item_ptr != input_ptr + input_items; ++input_item_ptr) {
+            if(*input_item_ptr == nullptr) throw std::invalid_argument("'input_ptr' element is null");
+        }
+
+        std::string input_item;
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int8_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            input_item.assign(input_ptr[index]);
+            TransformedType result(transformer.execute(input_item));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_Flush(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*out*/ int8_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -760,6 +799,45 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Transform(/*in*/ FromStri
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_TransformBuffer(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        for(char const * const *input_item_ptr = input_ptr; input_item_ptr != input_ptr + input_items; ++input_item_ptr) {
+            if(*input_item_ptr == nullptr) throw std::invalid_argument("'input_ptr' element is null");
+        }
+
+        std::string input_item;
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int16_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            input_item.assign(input_ptr[index]);
+            TransformedType result(transformer.execute(input_item));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Flush(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*out*/ int16_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1151,6 +1229,45 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Transform(/*in*/ FromStri
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_TransformBuffer(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        for(char const * const *input_item_ptr = input_ptr; input_item_ptr != input_ptr + input_items; ++input_item_ptr) {
+            if(*input_item_ptr == nullptr) throw std::invalid_argument("'input_ptr' element is null");
+        }
+
+        std::string input_item;
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int32_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            input_item.assign(input_ptr[index]);
+            TransformedType result(transformer.execute(input_item));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Flush(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*out*/ int32_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1542,6 +1659,45 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Transform(/*in*/ FromStri
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_TransformBuffer(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        for(char const * const *input_item_ptr = input_ptr; input_item_ptr != input_ptr + input_items; ++input_item_ptr) {
+            if(*input_item_ptr == nullptr) throw std::invalid_argument("'input_ptr' element is null");
+        }
+
+        std::string input_item;
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::FromStringEstimator<std::int64_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            input_item.assign(input_ptr[index]);
+            TransformedType result(transformer.execute(input_item));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Flush(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*out*/ int64_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1933,6 +2089,45 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_Transform(/*in*/ FromStri
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_TransformBuffer(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        for(char const * const *input_item_ptr = input_ptr; input_item_ptr != input_ptr + input_items; ++input_item_ptr) {
+            if(*input_item_ptr == nullptr) throw std::invalid_argument("'input_ptr' element is null");
+        }
+
+        std::string input_item;
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint8_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            input_item.assign(input_ptr[index]);
+            TransformedType result(transformer.execute(input_item));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_Flush(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ uint8_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2324,6 +2519,45 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Transform(/*in*/ FromStr
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_TransformBuffer(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        for(char const * const *input_item_ptr = input_ptr; input_item_ptr != input_ptr + input_items; ++input_item_ptr) {
+            if(*input_item_ptr == nullptr) throw std::invalid_argument("'input_ptr' element is null");
+        }
+
+        std::string input_item;
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint16_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            input_item.assign(input_ptr[index]);
+            TransformedType result(transformer.execute(input_item));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Flush(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ uint16_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2715,6 +2949,45 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Transform(/*in*/ FromStr
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_TransformBuffer(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        for(char const * const *input_item_ptr = input_ptr; input_item_ptr != input_ptr + input_items; ++input_item_ptr) {
+            if(*input_item_ptr == nullptr) throw std::invalid_argument("'input_ptr' element is null");
+        }
+
+        std::string input_item;
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint32_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            input_item.assign(input_ptr[index]);
+            TransformedType result(transformer.execute(input_item));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Flush(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ uint32_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3106,6 +3379,45 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Transform(/*in*/ FromStr
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_TransformBuffer(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        for(char const * const *input_item_ptr = input_ptr; input_item_ptr != input_ptr + input_items; ++input_item_ptr) {
+            if(*input_item_ptr == nullptr) throw std::invalid_argument("'input_ptr' element is null");
+        }
+
+        std::string input_item;
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::FromStringEstimator<std::uint64_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            input_item.assign(input_ptr[index]);
+            TransformedType result(transformer.execute(input_item));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Flush(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3497,6 +3809,45 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Transform(/*in*/ FromStri
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_TransformBuffer(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        for(char const * const *input_item_ptr = input_ptr; input_item_ptr != input_ptr + input_items; ++input_item_ptr) {
+            if(*input_item_ptr == nullptr) throw std::invalid_argument("'input_ptr' element is null");
+        }
+
+        std::string input_item;
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::FromStringEstimator<std::float_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            input_item.assign(input_ptr[index]);
+            TransformedType result(transformer.execute(input_item));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Flush(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*out*/ float ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3888,6 +4239,45 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Transform(/*in*/ FromStr
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_TransformBuffer(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        for(char const * const *input_item_ptr = input_ptr; input_item_ptr != input_ptr + input_items; ++input_item_ptr) {
+            if(*input_item_ptr == nullptr) throw std::invalid_argument("'input_ptr' element is null");
+        }
+
+        std::string input_item;
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::FromStringEstimator<std::double_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            input_item.assign(input_ptr[index]);
+            TransformedType result(transformer.execute(input_item));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Flush(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*out*/ double ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -4279,6 +4669,45 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_Transform(/*in*/ FromStrin
     }
 }
 
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_TransformBuffer(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        for(char const * const *input_item_ptr = input_ptr; input_item_ptr != input_ptr + input_items; ++input_item_ptr) {
+            if(*input_item_ptr == nullptr) throw std::invalid_argument("'input_ptr' element is null");
+        }
+
+        std::string input_item;
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::FromStringEstimator<bool>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            input_item.assign(input_ptr[index]);
+            TransformedType result(transformer.execute(input_item));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_Flush(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*out*/ bool ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
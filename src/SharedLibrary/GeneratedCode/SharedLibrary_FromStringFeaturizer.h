@@ -32,6 +32,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_Transform(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const * input, /*out*/ int8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_TransformBuffer(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int8_Flush(/*in*/ FromStringFeaturizer_int8_TransformerHandle *pHandle, /*out*/ int8_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -58,6 +59,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Transform(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const * input, /*out*/ int16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_TransformBuffer(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int16_Flush(/*in*/ FromStringFeaturizer_int16_TransformerHandle *pHandle, /*out*/ int16_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -84,6 +86,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Transform(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const * input, /*out*/ int32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_TransformBuffer(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int32_Flush(/*in*/ FromStringFeaturizer_int32_TransformerHandle *pHandle, /*out*/ int32_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -110,6 +113,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Transform(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const * input, /*out*/ int64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_TransformBuffer(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ int64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_int64_Flush(/*in*/ FromStringFeaturizer_int64_TransformerHandle *pHandle, /*out*/ int64_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -136,6 +140,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_Transform(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const * input, /*out*/ uint8_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_TransformBuffer(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint8_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint8_Flush(/*in*/ FromStringFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ uint8_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -162,6 +167,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Transform(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const * input, /*out*/ uint16_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_TransformBuffer(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint16_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint16_Flush(/*in*/ FromStringFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ uint16_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -188,6 +194,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Transform(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const * input, /*out*/ uint32_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_TransformBuffer(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint32_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint32_Flush(/*in*/ FromStringFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ uint32_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -214,6 +221,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Transform(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const * input, /*out*/ uint64_t * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_TransformBuffer(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_uint64_Flush(/*in*/ FromStringFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -240,6 +248,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Transform(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const * input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_TransformBuffer(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_float_Flush(/*in*/ FromStringFeaturizer_float_TransformerHandle *pHandle, /*out*/ float ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -266,6 +275,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Transform(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const * input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_TransformBuffer(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_double_Flush(/*in*/ FromStringFeaturizer_double_TransformerHandle *pHandle, /*out*/ double ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -292,6 +302,7 @@ FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_CreateTransformerSaveData(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_Transform(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const * input, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_TransformBuffer(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool FromStringFeaturizer_bool_Flush(/*in*/ FromStringFeaturizer_bool_TransformerHandle *pHandle, /*out*/ bool ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
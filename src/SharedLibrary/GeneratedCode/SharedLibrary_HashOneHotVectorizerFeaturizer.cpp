@@ -364,6 +364,42 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_Transform(/*in*/
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_TransformBuffer(/*in*/ HashOneHotVectorizerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint8_t * output_value_ptr, /*out*/ uint64_t * output_index_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        if(output_numElements_ptr == nullptr) throw std::invalid_argument("'output_numElements_ptr' is null");
+        if(output_value_ptr == nullptr) throw std::invalid_argument("'output_value_ptr' is null");
+        if(output_index_ptr == nullptr) throw std::invalid_argument("'output_index_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int8_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            TransformedType result(transformer.execute(input_ptr[index]));
+
+            output_numElements_ptr[index] = result.NumElements;
+            output_value_ptr[index] = result.Value;
+            output_index_ptr[index] = result.Index;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int8_Flush(/*in*/ HashOneHotVectorizerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint8_t ** output_item_value_ptr, /*out*/ uint64_t ** output_item_index_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -764,6 +800,42 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_Transform(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_TransformBuffer(/*in*/ HashOneHotVectorizerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint8_t * output_value_ptr, /*out*/ uint64_t * output_index_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        if(output_numElements_ptr == nullptr) throw std::invalid_argument("'output_numElements_ptr' is null");
+        if(output_value_ptr == nullptr) throw std::invalid_argument("'output_value_ptr' is null");
+        if(output_index_ptr == nullptr) throw std::invalid_argument("'output_index_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int16_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            TransformedType result(transformer.execute(input_ptr[index]));
+
+            output_numElements_ptr[index] = result.NumElements;
+            output_value_ptr[index] = result.Value;
+            output_index_ptr[index] = result.Index;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int16_Flush(/*in*/ HashOneHotVectorizerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint8_t ** output_item_value_ptr, /*out*/ uint64_t ** output_item_index_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1164,6 +1236,42 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_Transform(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_TransformBuffer(/*in*/ HashOneHotVectorizerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint8_t * output_value_ptr, /*out*/ uint64_t * output_index_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        if(output_numElements_ptr == nullptr) throw std::invalid_argument("'output_numElements_ptr' is null");
+        if(output_value_ptr == nullptr) throw std::invalid_argument("'output_value_ptr' is null");
+        if(output_index_ptr == nullptr) throw std::invalid_argument("'output_index_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int32_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            TransformedType result(transformer.execute(input_ptr[index]));
+
+            output_numElements_ptr[index] = result.NumElements;
+            output_value_ptr[index] = result.Value;
+            output_index_ptr[index] = result.Index;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int32_Flush(/*in*/ HashOneHotVectorizerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint8_t ** output_item_value_ptr, /*out*/ uint64_t ** output_item_index_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1564,6 +1672,42 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_Transform(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_TransformBuffer(/*in*/ HashOneHotVectorizerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint8_t * output_value_ptr, /*out*/ uint64_t * output_index_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        if(output_numElements_ptr == nullptr) throw std::invalid_argument("'output_numElements_ptr' is null");
+        if(output_value_ptr == nullptr) throw std::invalid_argument("'output_value_ptr' is null");
+        if(output_index_ptr == nullptr) throw std::invalid_argument("'output_index_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::int64_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            TransformedType result(transformer.execute(input_ptr[index]));
+
+            output_numElements_ptr[index] = result.NumElements;
+            output_value_ptr[index] = result.Value;
+            output_index_ptr[index] = result.Index;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_int64_Flush(/*in*/ HashOneHotVectorizerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint8_t ** output_item_value_ptr, /*out*/ uint64_t ** output_item_index_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -1964,6 +2108,42 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_Transform(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_TransformBuffer(/*in*/ HashOneHotVectorizerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint8_t * output_value_ptr, /*out*/ uint64_t * output_index_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        if(output_numElements_ptr == nullptr) throw std::invalid_argument("'output_numElements_ptr' is null");
+        if(output_value_ptr == nullptr) throw std::invalid_argument("'output_value_ptr' is null");
+        if(output_index_ptr == nullptr) throw std::invalid_argument("'output_index_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint8_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            TransformedType result(transformer.execute(input_ptr[index]));
+
+            output_numElements_ptr[index] = result.NumElements;
+            output_value_ptr[index] = result.Value;
+            output_index_ptr[index] = result.Index;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint8_Flush(/*in*/ HashOneHotVectorizerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint8_t ** output_item_value_ptr, /*out*/ uint64_t ** output_item_index_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2364,6 +2544,42 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_Transform(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_TransformBuffer(/*in*/ HashOneHotVectorizerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint8_t * output_value_ptr, /*out*/ uint64_t * output_index_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        if(output_numElements_ptr == nullptr) throw std::invalid_argument("'output_numElements_ptr' is null");
+        if(output_value_ptr == nullptr) throw std::invalid_argument("'output_value_ptr' is null");
+        if(output_index_ptr == nullptr) throw std::invalid_argument("'output_index_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint16_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            TransformedType result(transformer.execute(input_ptr[index]));
+
+            output_numElements_ptr[index] = result.NumElements;
+            output_value_ptr[index] = result.Value;
+            output_index_ptr[index] = result.Index;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint16_Flush(/*in*/ HashOneHotVectorizerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint8_t ** output_item_value_ptr, /*out*/ uint64_t ** output_item_index_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -2764,6 +2980,42 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_Transform(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_TransformBuffer(/*in*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint8_t * output_value_ptr, /*out*/ uint64_t * output_index_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        if(output_numElements_ptr == nullptr) throw std::invalid_argument("'output_numElements_ptr' is null");
+        if(output_value_ptr == nullptr) throw std::invalid_argument("'output_value_ptr' is null");
+        if(output_index_ptr == nullptr) throw std::invalid_argument("'output_index_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint32_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            TransformedType result(transformer.execute(input_ptr[index]));
+
+            output_numElements_ptr[index] = result.NumElements;
+            output_value_ptr[index] = result.Value;
+            output_index_ptr[index] = result.Index;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint32_Flush(/*in*/ HashOneHotVectorizerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint8_t ** output_item_value_ptr, /*out*/ uint64_t ** output_item_index_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3164,6 +3416,42 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_Transform(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_TransformBuffer(/*in*/ HashOneHotVectorizerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint8_t * output_value_ptr, /*out*/ uint64_t * output_index_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        if(output_numElements_ptr == nullptr) throw std::invalid_argument("'output_numElements_ptr' is null");
+        if(output_value_ptr == nullptr) throw std::invalid_argument("'output_value_ptr' is null");
+        if(output_index_ptr == nullptr) throw std::invalid_argument("'output_index_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::uint64_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            TransformedType result(transformer.execute(input_ptr[index]));
+
+            output_numElements_ptr[index] = result.NumElements;
+            output_value_ptr[index] = result.Value;
+            output_index_ptr[index] = result.Index;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_uint64_Flush(/*in*/ HashOneHotVectorizerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint8_t ** output_item_value_ptr, /*out*/ uint64_t ** output_item_index_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3564,6 +3852,42 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_Transform(/*in*
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_TransformBuffer(/*in*/ HashOneHotVectorizerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint8_t * output_value_ptr, /*out*/ uint64_t * output_index_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        if(output_numElements_ptr == nullptr) throw std::invalid_argument("'output_numElements_ptr' is null");
+        if(output_value_ptr == nullptr) throw std::invalid_argument("'output_value_ptr' is null");
+        if(output_index_ptr == nullptr) throw std::invalid_argument("'output_index_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::float_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            TransformedType result(transformer.execute(input_ptr[index]));
+
+            output_numElements_ptr[index] = result.NumElements;
+            output_value_ptr[index] = result.Value;
+            output_index_ptr[index] = result.Index;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_float_Flush(/*in*/ HashOneHotVectorizerFeaturizer_float_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint8_t ** output_item_value_ptr, /*out*/ uint64_t ** output_item_index_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -3964,6 +4288,42 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_Transform(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_TransformBuffer(/*in*/ HashOneHotVectorizerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint8_t * output_value_ptr, /*out*/ uint64_t * output_index_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        if(output_numElements_ptr == nullptr) throw std::invalid_argument("'output_numElements_ptr' is null");
+        if(output_value_ptr == nullptr) throw std::invalid_argument("'output_value_ptr' is null");
+        if(output_index_ptr == nullptr) throw std::invalid_argument("'output_index_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::double_t>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            TransformedType result(transformer.execute(input_ptr[index]));
+
+            output_numElements_ptr[index] = result.NumElements;
+            output_value_ptr[index] = result.Value;
+            output_index_ptr[index] = result.Index;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_double_Flush(/*in*/ HashOneHotVectorizerFeaturizer_double_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint8_t ** output_item_value_ptr, /*out*/ uint64_t ** output_item_index_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -4364,6 +4724,42 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_Transform(/*in*/
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_TransformBuffer(/*in*/ HashOneHotVectorizerFeaturizer_bool_TransformerHandle *pHandle, /*in*/ bool const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint8_t * output_value_ptr, /*out*/ uint64_t * output_index_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        if(output_numElements_ptr == nullptr) throw std::invalid_argument("'output_numElements_ptr' is null");
+        if(output_value_ptr == nullptr) throw std::invalid_argument("'output_value_ptr' is null");
+        if(output_index_ptr == nullptr) throw std::invalid_argument("'output_index_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<bool>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            TransformedType result(transformer.execute(input_ptr[index]));
+
+            output_numElements_ptr[index] = result.NumElements;
+            output_value_ptr[index] = result.Value;
+            output_index_ptr[index] = result.Index;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_bool_Flush(/*in*/ HashOneHotVectorizerFeaturizer_bool_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint8_t ** output_item_value_ptr, /*out*/ uint64_t ** output_item_index_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -4773,6 +5169,49 @@ FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_Transform(/*in
     }
 }
 
+FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_TransformBuffer(/*in*/ HashOneHotVectorizerFeaturizer_string_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint8_t * output_value_ptr, /*out*/ uint64_t * output_index_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        for(char const * const *input_item_ptr = input_ptr; input_item_ptr != input_ptr + input_items; ++input_item_ptr) {
+            if(*input_item_ptr == nullptr) throw std::invalid_argument("'input_ptr' element is null");
+        }
+
+        std::string input_item;
+
+        if(output_numElements_ptr == nullptr) throw std::invalid_argument("'output_numElements_ptr' is null");
+        if(output_value_ptr == nullptr) throw std::invalid_argument("'output_value_ptr' is null");
+        if(output_index_ptr == nullptr) throw std::invalid_argument("'output_index_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::HashOneHotVectorizerEstimator<std::string>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            input_item.assign(input_ptr[index]);
+            TransformedType result(transformer.execute(input_item));
+
+            output_numElements_ptr[index] = result.NumElements;
+            output_value_ptr[index] = result.Value;
+            output_index_ptr[index] = result.Index;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool HashOneHotVectorizerFeaturizer_string_Flush(/*in*/ HashOneHotVectorizerFeaturizer_string_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint8_t ** output_item_value_ptr, /*out*/ uint64_t ** output_item_index_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
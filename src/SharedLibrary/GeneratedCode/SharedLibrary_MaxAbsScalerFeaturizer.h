@@ -32,6 +32,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_Transform(/*in*/ MaxAbsScalerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_TransformBuffer(/*in*/ MaxAbsScalerFeaturizer_int8_TransformerHandle *pHandle, /*in*/ int8_t const * input_ptr, /*in*/ size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int8_Flush(/*in*/ MaxAbsScalerFeaturizer_int8_TransformerHandle *pHandle, /*out*/ float ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -58,6 +59,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_Transform(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_TransformBuffer(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*in*/ int16_t const * input_ptr, /*in*/ size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int16_Flush(/*in*/ MaxAbsScalerFeaturizer_int16_TransformerHandle *pHandle, /*out*/ float ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -84,6 +86,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_Transform(/*in*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_TransformBuffer(/*in*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle *pHandle, /*in*/ uint8_t const * input_ptr, /*in*/ size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint8_Flush(/*in*/ MaxAbsScalerFeaturizer_uint8_TransformerHandle *pHandle, /*out*/ float ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -110,6 +113,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_Transform(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_TransformBuffer(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*in*/ uint16_t const * input_ptr, /*in*/ size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint16_Flush(/*in*/ MaxAbsScalerFeaturizer_uint16_TransformerHandle *pHandle, /*out*/ float ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -136,6 +140,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_Transform(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float input, /*out*/ float * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_TransformBuffer(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*in*/ float const * input_ptr, /*in*/ size_t input_items, /*out*/ float * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_float_Flush(/*in*/ MaxAbsScalerFeaturizer_float_TransformerHandle *pHandle, /*out*/ float ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -162,6 +167,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_Transform(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_TransformBuffer(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*in*/ int32_t const * input_ptr, /*in*/ size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int32_Flush(/*in*/ MaxAbsScalerFeaturizer_int32_TransformerHandle *pHandle, /*out*/ double ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -188,6 +194,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_DestroyTransformer(/*in
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_Transform(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_TransformBuffer(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*in*/ int64_t const * input_ptr, /*in*/ size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_int64_Flush(/*in*/ MaxAbsScalerFeaturizer_int64_TransformerHandle *pHandle, /*out*/ double ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -214,6 +221,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_Transform(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_TransformBuffer(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*in*/ uint32_t const * input_ptr, /*in*/ size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint32_Flush(/*in*/ MaxAbsScalerFeaturizer_uint32_TransformerHandle *pHandle, /*out*/ double ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -240,6 +248,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_Transform(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_TransformBuffer(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*in*/ uint64_t const * input_ptr, /*in*/ size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_uint64_Flush(/*in*/ MaxAbsScalerFeaturizer_uint64_TransformerHandle *pHandle, /*out*/ double ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 /* ---------------------------------------------------------------------- */
@@ -266,6 +275,7 @@ FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_DestroyTransformer(/*i
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_CreateTransformerSaveData(/*in*/ MaxAbsScalerFeaturizer_double_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_Transform(/*in*/ MaxAbsScalerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double input, /*out*/ double * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_TransformBuffer(/*in*/ MaxAbsScalerFeaturizer_double_TransformerHandle *pHandle, /*in*/ double const * input_ptr, /*in*/ size_t input_items, /*out*/ double * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool MaxAbsScalerFeaturizer_double_Flush(/*in*/ MaxAbsScalerFeaturizer_double_TransformerHandle *pHandle, /*out*/ double ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 } // extern "C"
@@ -406,6 +406,64 @@ FEATURIZER_LIBRARY_API bool ShortGrainDropperFeaturizer_Transform(/*in*/ ShortGr
     }
 }
 
+FEATURIZER_LIBRARY_API bool ShortGrainDropperFeaturizer_TransformBuffer(/*in*/ ShortGrainDropperFeaturizer_TransformerHandle *pHandle, /*in*/ char const * const * const * input_ptrs, /*in*/ size_t const * input_ptr_items, /*in*/ size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptrs == nullptr) throw std::invalid_argument("'input_ptrs' is null");
+        if(input_ptr_items == nullptr) throw std::invalid_argument("'input_ptr_items' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        std::vector<std::vector<std::string>> input_buffer;
+
+        input_buffer.reserve(input_items);
+
+        while(input_buffer.size() < input_items) {
+            if(*input_ptrs == nullptr) throw std::invalid_argument("'input_ptrs' element is null");
+            if(*input_ptr_items == 0) throw std::invalid_argument("'input_ptr_items' element is 0");
+
+            std::vector<std::string> this_buffer;
+
+            this_buffer.reserve(*input_ptr_items);
+
+            char const * const * strings_ptr(*input_ptrs);
+
+            while(this_buffer.size() < *input_ptr_items) {
+                this_buffer.emplace_back(*strings_ptr);
+                ++strings_ptr;
+            }
+
+            input_buffer.emplace_back(std::move(this_buffer));
+
+            ++input_ptrs;
+            ++input_ptr_items;
+        }
+
+        if(output_ptr == nullptr) throw std::invalid_argument("'output_ptr' is null");
+
+        Microsoft::Featurizer::Featurizers::ShortGrainDropperEstimator<>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::ShortGrainDropperEstimator<>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::ShortGrainDropperEstimator<>::TransformedType;
+
+        for(size_t index = 0; index < input_buffer.size(); ++index) {
+            TransformedType result(transformer.execute(input_buffer.data()[index]));
+
+            output_ptr[index] = result;
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool ShortGrainDropperFeaturizer_Flush(/*in*/ ShortGrainDropperFeaturizer_TransformerHandle *pHandle, /*out*/ bool ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
@@ -32,6 +32,7 @@ FEATURIZER_LIBRARY_API bool ShortGrainDropperFeaturizer_DestroyTransformer(/*in*
 FEATURIZER_LIBRARY_API bool ShortGrainDropperFeaturizer_CreateTransformerSaveData(/*in*/ ShortGrainDropperFeaturizer_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool ShortGrainDropperFeaturizer_Transform(/*in*/ ShortGrainDropperFeaturizer_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ bool * output, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool ShortGrainDropperFeaturizer_TransformBuffer(/*in*/ ShortGrainDropperFeaturizer_TransformerHandle *pHandle, /*in*/ char const * const * const * input_ptrs, /*in*/ size_t const * input_ptr_items, /*in*/ size_t input_items, /*out*/ bool * output_ptr, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool ShortGrainDropperFeaturizer_Flush(/*in*/ ShortGrainDropperFeaturizer_TransformerHandle *pHandle, /*out*/ bool ** output_item_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 } // extern "C"
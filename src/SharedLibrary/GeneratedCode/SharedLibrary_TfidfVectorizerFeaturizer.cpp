@@ -387,6 +387,97 @@ FEATURIZER_LIBRARY_API bool TfidfVectorizerFeaturizer_Transform(/*in*/ TfidfVect
     }
 }
 
+FEATURIZER_LIBRARY_API bool TfidfVectorizerFeaturizer_TransformInto(/*in*/ TfidfVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const * input_ptr, /*in*/ size_t input_size, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ float * output_values, /*out*/ uint64_t * output_indexes, /*in*/ size_t output_values_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr && input_size != 0) throw std::invalid_argument("'input_ptr' is null");
+
+        if(output_numElements == nullptr) throw std::invalid_argument("'output_numElements' is null");
+        if(output_numValues == nullptr) throw std::invalid_argument("'output_numValues' is null");
+        if(output_values == nullptr && output_values_items != 0) throw std::invalid_argument("'output_values' is null");
+        if(output_indexes == nullptr && output_values_items != 0) throw std::invalid_argument("'output_indexes' is null");
+
+        Microsoft::Featurizer::Featurizers::TfidfVectorizerEstimator<>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::TfidfVectorizerEstimator<>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        // The result is written directly to the output buffers
+        *output_numValues = transformer.execute_into(input_ptr, input_size, *output_numElements, output_values, output_indexes, output_values_items);
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
+FEATURIZER_LIBRARY_API bool TfidfVectorizerFeaturizer_TransformBuffer(/*in*/ TfidfVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint64_t * output_offsets_ptr, /*out*/ float * output_values_ptr, /*out*/ uint64_t * output_indexes_ptr, /*in*/ size_t output_values_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
+    if(ppErrorInfo == nullptr)
+        return false;
+
+    try {
+        *ppErrorInfo = nullptr;
+
+        if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+        if(input_ptr == nullptr) throw std::invalid_argument("'input_ptr' is null");
+        if(input_items == 0) throw std::invalid_argument("'input_items' is 0");
+
+        for(char const * const *input_item_ptr = input_ptr; input_item_ptr != input_ptr + input_items; ++input_item_ptr) {
+            if(*input_item_ptr == nullptr) throw std::invalid_argument("'input_ptr' element is null");
+        }
+
+        std::string input_item;
+
+        if(output_numElements_ptr == nullptr) throw std::invalid_argument("'output_numElements_ptr' is null");
+        if(output_offsets_ptr == nullptr) throw std::invalid_argument("'output_offsets_ptr' is null");
+
+        bool const output_is_size_query(output_values_ptr == nullptr && output_indexes_ptr == nullptr && output_values_items == 0);
+
+        if(output_is_size_query == false) {
+            if(output_values_ptr == nullptr) throw std::invalid_argument("'output_values_ptr' is null");
+            if(output_indexes_ptr == nullptr) throw std::invalid_argument("'output_indexes_ptr' is null");
+        }
+
+        output_offsets_ptr[0] = 0;
+
+        Microsoft::Featurizer::Featurizers::TfidfVectorizerEstimator<>::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::TfidfVectorizerEstimator<>::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+        using TransformedType = typename Microsoft::Featurizer::Featurizers::TfidfVectorizerEstimator<>::TransformedType;
+
+        for(size_t index = 0; index < input_items; ++index) {
+            input_item.assign(input_ptr[index]);
+            TransformedType result(transformer.execute(input_item));
+
+            if(output_is_size_query == false) {
+                if(result.Values.size() > output_values_items - output_offsets_ptr[index]) throw std::invalid_argument("'output_values_items' is not large enough");
+
+                float * pValue(output_values_ptr + output_offsets_ptr[index]);
+                uint64_t * pIndex(output_indexes_ptr + output_offsets_ptr[index]);
+
+                for(auto const & encoding : result.Values) {
+                    *pValue++ = encoding.Value;
+                    *pIndex++ = encoding.Index;
+                }
+            }
+
+            output_numElements_ptr[index] = result.NumElements;
+            output_offsets_ptr[index + 1] = output_offsets_ptr[index] + result.Values.size();
+        }
+    
+        return true;
+    }
+    catch(std::exception const &ex) {
+        *ppErrorInfo = CreateErrorInfo(ex);
+        return false;
+    }
+}
+
 FEATURIZER_LIBRARY_API bool TfidfVectorizerFeaturizer_Flush(/*in*/ TfidfVectorizerFeaturizer_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint64_t ** output_item_numValues_ptr, /*out*/ float *** output_item_values_ptr, /*out*/ uint64_t *** output_item_indexes_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo) {
     if(ppErrorInfo == nullptr)
         return false;
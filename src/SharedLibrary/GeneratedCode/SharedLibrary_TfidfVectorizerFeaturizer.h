@@ -58,6 +58,8 @@ FEATURIZER_LIBRARY_API bool TfidfVectorizerFeaturizer_DestroyTransformer(/*in*/
 FEATURIZER_LIBRARY_API bool TfidfVectorizerFeaturizer_CreateTransformerSaveData(/*in*/ TfidfVectorizerFeaturizer_TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
 FEATURIZER_LIBRARY_API bool TfidfVectorizerFeaturizer_Transform(/*in*/ TfidfVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const * input, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ float ** output_values, /*out*/ uint64_t ** output_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool TfidfVectorizerFeaturizer_TransformInto(/*in*/ TfidfVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const * input_ptr, /*in*/ size_t input_size, /*out*/ uint64_t * output_numElements, /*out*/ uint64_t * output_numValues, /*out*/ float * output_values, /*out*/ uint64_t * output_indexes, /*in*/ size_t output_values_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
+FEATURIZER_LIBRARY_API bool TfidfVectorizerFeaturizer_TransformBuffer(/*in*/ TfidfVectorizerFeaturizer_TransformerHandle *pHandle, /*in*/ char const * const * input_ptr, /*in*/ size_t input_items, /*out*/ uint64_t * output_numElements_ptr, /*out*/ uint64_t * output_offsets_ptr, /*out*/ float * output_values_ptr, /*out*/ uint64_t * output_indexes_ptr, /*in*/ size_t output_values_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool TfidfVectorizerFeaturizer_Flush(/*in*/ TfidfVectorizerFeaturizer_TransformerHandle *pHandle, /*out*/ uint64_t ** output_item_numElements_ptr, /*out*/ uint64_t ** output_item_numValues_ptr, /*out*/ float *** output_item_values_ptr, /*out*/ uint64_t *** output_item_indexes_ptr, /*out*/ size_t * output_items, /*out*/ ErrorInfoHandle **ppErrorInfo);
 FEATURIZER_LIBRARY_API bool TfidfVectorizerFeaturizer_DestroyTransformedData(/*in*/ uint64_t result_numElements, /*in*/ uint64_t result_numValues, /*in*/ float const * result_values, /*in*/ uint64_t const * result_indexes, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
@@ -31,3 +31,82 @@ TEST_CASE("Standard") {
         false
     );
 }
+
+TEST_CASE("TransformInto") {
+    ErrorInfoHandle * pErrorInfo(nullptr);
+
+    // Create the estimator
+    CountVectorizerFeaturizer_EstimatorHandle *pEstimatorHandle(nullptr);
+
+    REQUIRE(
+        CountVectorizerFeaturizer_CreateEstimator(
+            true,
+            static_cast<std::uint8_t>(CountVectorizerFeaturizer_AnalyzerMethod_Word),
+            "",
+            1.0f,
+            0.0f,
+            nullptr,
+            static_cast<std::uint32_t>(1),
+            static_cast<std::uint32_t>(1),
+            false,
+            &pEstimatorHandle,
+            &pErrorInfo
+        )
+    );
+    REQUIRE(pEstimatorHandle != nullptr);
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Train
+    TrainingState trainingState(0);
+
+    REQUIRE(CountVectorizerFeaturizer_GetState(pEstimatorHandle, &trainingState, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    while(trainingState == Training) {
+        FitResult result(0);
+
+        REQUIRE(CountVectorizerFeaturizer_Fit(pEstimatorHandle, "apple banana grape", &result, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        REQUIRE(CountVectorizerFeaturizer_OnDataCompleted(pEstimatorHandle, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        REQUIRE(CountVectorizerFeaturizer_GetState(pEstimatorHandle, &trainingState, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+    }
+
+    REQUIRE(CountVectorizerFeaturizer_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Create the transformer
+    CountVectorizerFeaturizer_TransformerHandle * pTransformerHandle(nullptr);
+
+    REQUIRE(CountVectorizerFeaturizer_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pTransformerHandle != nullptr);
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(CountVectorizerFeaturizer_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Transform (only the first 17 characters of the input are used)
+    char const                  input[] = "grape apple grape banana";
+
+    uint64_t                    numElements(0);
+    uint64_t                    numValues(0);
+    std::vector<std::uint32_t>  values(3);
+    std::vector<uint64_t>       indexes(3);
+
+    REQUIRE(CountVectorizerFeaturizer_TransformInto(pTransformerHandle, input, 17, &numElements, &numValues, values.data(), indexes.data(), values.size(), &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CHECK(numElements == 3);
+    REQUIRE(numValues == 2);
+
+    CHECK(values[0] == 1);
+    CHECK(indexes[0] == 0);
+    CHECK(values[1] == 2);
+    CHECK(indexes[1] == 2);
+
+    REQUIRE(CountVectorizerFeaturizer_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
@@ -61,3 +61,72 @@ TEST_CASE("string") {
         bool(true)
     );
 }
+
+TEST_CASE("string - TransformBuffer") {
+    ErrorInfoHandle *                       pErrorInfo(nullptr);
+
+    // Train
+    LabelEncoderFeaturizer_string_EstimatorHandle *     pEstimatorHandle(nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_CreateEstimator(true, &pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    char const * const                      trainingInputs[] = { "orange", "apple", "orange", "grape", "carrot", "peach", "banana" };
+    TrainingState                           trainingState(0);
+
+    REQUIRE(LabelEncoderFeaturizer_string_GetState(pEstimatorHandle, &trainingState, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    while(trainingState == Training) {
+        FitResult                           result(0);
+
+        REQUIRE(LabelEncoderFeaturizer_string_FitBuffer(pEstimatorHandle, trainingInputs, sizeof(trainingInputs) / sizeof(*trainingInputs), &result, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        REQUIRE(LabelEncoderFeaturizer_string_OnDataCompleted(pEstimatorHandle, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        REQUIRE(LabelEncoderFeaturizer_string_GetState(pEstimatorHandle, &trainingState, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+    }
+
+    REQUIRE(LabelEncoderFeaturizer_string_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    LabelEncoderFeaturizer_string_TransformerHandle *   pTransformerHandle(nullptr);
+
+    REQUIRE(LabelEncoderFeaturizer_string_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+    REQUIRE(LabelEncoderFeaturizer_string_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Transform all of the rows with a single call; the shorter strings reuse
+    // the buffer allocated for the longer ones
+    char const * const                      inputs[] = { "banana", "grape", "apple", "unknown value", "peach" };
+    std::uint32_t                           outputs[5];
+
+    REQUIRE(LabelEncoderFeaturizer_string_TransformBuffer(pTransformerHandle, inputs, 5, outputs, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CHECK(std::vector<std::uint32_t>(outputs, outputs + 5) == std::vector<std::uint32_t>{2, 4, 1, 0, 6});
+
+    // Null strings are detected before any output is written
+    char const * const                      invalidInputs[] = { "banana", nullptr };
+    std::uint32_t                           invalidOutputs[2] = { 100, 100 };
+
+    CHECK(LabelEncoderFeaturizer_string_TransformBuffer(pTransformerHandle, invalidInputs, 2, invalidOutputs, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+
+    char const *                            errorString(nullptr);
+
+    REQUIRE(GetErrorInfoString(pErrorInfo, &errorString));
+    CHECK(std::string(errorString) == "'input_ptr' element is null");
+    CHECK(invalidOutputs[0] == 100);
+
+    REQUIRE(DestroyErrorInfoString(errorString));
+    REQUIRE(DestroyErrorInfo(pErrorInfo));
+    pErrorInfo = nullptr;
+
+    REQUIRE(LabelEncoderFeaturizer_string_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
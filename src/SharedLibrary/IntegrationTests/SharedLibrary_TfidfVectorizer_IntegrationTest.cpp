@@ -42,3 +42,238 @@ TEST_CASE("standard") {
     );
 }
 
+TEST_CASE("TransformBuffer") {
+    ErrorInfoHandle * pErrorInfo(nullptr);
+
+    // Create the estimator
+    std::uint32_t topKTerms = 3;
+    TfidfVectorizerFeaturizer_EstimatorHandle *pEstimatorHandle(nullptr);
+
+    REQUIRE(
+        TfidfVectorizerFeaturizer_CreateEstimator(
+            true,
+            static_cast<std::uint8_t>(TfidfVectorizerFeaturizer_AnalyzerMethod_Word),
+            "",
+            static_cast<std::uint8_t>(TfidfVectorizerFeaturizer_NormMethod_L2),
+            static_cast<std::uint32_t>(TfidfVectorizerFeaturizer_TfidfPolicy_UseIdf | TfidfVectorizerFeaturizer_TfidfPolicy_SmoothIdf),
+            0.0f,
+            1.0f,
+            &topKTerms,
+            static_cast<std::uint32_t>(1),
+            static_cast<std::uint32_t>(2),
+            &pEstimatorHandle,
+            &pErrorInfo
+        )
+    );
+    REQUIRE(pEstimatorHandle != nullptr);
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Train
+    TrainingState trainingState(0);
+
+    REQUIRE(TfidfVectorizerFeaturizer_GetState(pEstimatorHandle, &trainingState, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    while(trainingState == Training) {
+        FitResult result(0);
+
+        REQUIRE(TfidfVectorizerFeaturizer_Fit(pEstimatorHandle, "jumpy fox", &result, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        REQUIRE(TfidfVectorizerFeaturizer_OnDataCompleted(pEstimatorHandle, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        REQUIRE(TfidfVectorizerFeaturizer_GetState(pEstimatorHandle, &trainingState, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+    }
+
+    REQUIRE(TfidfVectorizerFeaturizer_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Create the transformer
+    TfidfVectorizerFeaturizer_TransformerHandle * pTransformerHandle(nullptr);
+
+    REQUIRE(TfidfVectorizerFeaturizer_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pTransformerHandle != nullptr);
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(TfidfVectorizerFeaturizer_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Transform all of the rows with a single call
+    char const * const          inputs[] = { "jumpy fox", "fox jumpy" };
+
+    uint64_t                    numElements[2];
+    uint64_t                    offsets[3];
+    std::float_t                values[5];
+    uint64_t                    indexes[5];
+
+    REQUIRE(TfidfVectorizerFeaturizer_TransformBuffer(pTransformerHandle, inputs, 2, numElements, offsets, values, indexes, 5, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CHECK(numElements[0] == 3);
+    CHECK(numElements[1] == 3);
+
+    CHECK(offsets[0] == 0);
+    CHECK(offsets[1] == 3);
+    CHECK(offsets[2] == 5);
+
+    CHECK(Approx(values[0]) == 0.57735f);
+    CHECK(indexes[0] == 0);
+    CHECK(Approx(values[1]) == 0.57735f);
+    CHECK(indexes[1] == 1);
+    CHECK(Approx(values[2]) == 0.57735f);
+    CHECK(indexes[2] == 2);
+
+    CHECK(Approx(values[3]) == 0.707107f);
+    CHECK(Approx(values[4]) == 0.707107f);
+
+    // The output buffer is too small
+    REQUIRE(TfidfVectorizerFeaturizer_TransformBuffer(pTransformerHandle, inputs, 2, numElements, offsets, values, indexes, 4, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+
+    REQUIRE(DestroyErrorInfo(pErrorInfo));
+    pErrorInfo = nullptr;
+
+    // Query the number of values required without writing them
+    uint64_t                    queryOffsets[3];
+
+    REQUIRE(TfidfVectorizerFeaturizer_TransformBuffer(pTransformerHandle, inputs, 2, numElements, queryOffsets, nullptr, nullptr, 0, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CHECK(queryOffsets[0] == 0);
+    CHECK(queryOffsets[1] == 3);
+    CHECK(queryOffsets[2] == 5);
+
+    // Null strings are detected before any output is written
+    char const * const          invalidInputs[] = { "jumpy fox", nullptr };
+
+    offsets[0] = 100;
+
+    REQUIRE(TfidfVectorizerFeaturizer_TransformBuffer(pTransformerHandle, invalidInputs, 2, numElements, offsets, values, indexes, 5, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+    CHECK(offsets[0] == 100);
+
+    REQUIRE(DestroyErrorInfo(pErrorInfo));
+    pErrorInfo = nullptr;
+
+    REQUIRE(TfidfVectorizerFeaturizer_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
+
+TEST_CASE("TransformInto") {
+    ErrorInfoHandle * pErrorInfo(nullptr);
+
+    // Create the estimator
+    std::uint32_t topKTerms = 3;
+    TfidfVectorizerFeaturizer_EstimatorHandle *pEstimatorHandle(nullptr);
+
+    REQUIRE(
+        TfidfVectorizerFeaturizer_CreateEstimator(
+            true,
+            static_cast<std::uint8_t>(TfidfVectorizerFeaturizer_AnalyzerMethod_Word),
+            "",
+            static_cast<std::uint8_t>(TfidfVectorizerFeaturizer_NormMethod_L2),
+            static_cast<std::uint32_t>(TfidfVectorizerFeaturizer_TfidfPolicy_UseIdf | TfidfVectorizerFeaturizer_TfidfPolicy_SmoothIdf),
+            0.0f,
+            1.0f,
+            &topKTerms,
+            static_cast<std::uint32_t>(1),
+            static_cast<std::uint32_t>(2),
+            &pEstimatorHandle,
+            &pErrorInfo
+        )
+    );
+    REQUIRE(pEstimatorHandle != nullptr);
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Train
+    TrainingState trainingState(0);
+
+    REQUIRE(TfidfVectorizerFeaturizer_GetState(pEstimatorHandle, &trainingState, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    while(trainingState == Training) {
+        FitResult result(0);
+
+        REQUIRE(TfidfVectorizerFeaturizer_Fit(pEstimatorHandle, "jumpy fox", &result, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        REQUIRE(TfidfVectorizerFeaturizer_OnDataCompleted(pEstimatorHandle, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+
+        REQUIRE(TfidfVectorizerFeaturizer_GetState(pEstimatorHandle, &trainingState, &pErrorInfo));
+        REQUIRE(pErrorInfo == nullptr);
+    }
+
+    REQUIRE(TfidfVectorizerFeaturizer_CompleteTraining(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Create the transformer
+    TfidfVectorizerFeaturizer_TransformerHandle * pTransformerHandle(nullptr);
+
+    REQUIRE(TfidfVectorizerFeaturizer_CreateTransformerFromEstimator(pEstimatorHandle, &pTransformerHandle, &pErrorInfo));
+    REQUIRE(pTransformerHandle != nullptr);
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(TfidfVectorizerFeaturizer_DestroyEstimator(pEstimatorHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    // Query the number of values required
+    char const                  input[] = "jumpy fox jumpy";
+
+    uint64_t                    numElements(0);
+    uint64_t                    numValues(0);
+
+    REQUIRE(TfidfVectorizerFeaturizer_TransformInto(pTransformerHandle, input, 9, &numElements, &numValues, nullptr, nullptr, 0, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CHECK(numElements == 3);
+    CHECK(numValues == 3);
+
+    // Transform into buffers that are large enough (only the first 9 characters of the input are used)
+    std::vector<std::float_t>   values(numValues);
+    std::vector<uint64_t>       indexes(numValues);
+
+    REQUIRE(TfidfVectorizerFeaturizer_TransformInto(pTransformerHandle, input, 9, &numElements, &numValues, values.data(), indexes.data(), values.size(), &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CHECK(numElements == 3);
+    REQUIRE(numValues == 3);
+
+    CHECK(Approx(values[0]) == 0.57735f);
+    CHECK(indexes[0] == 0);
+    CHECK(Approx(values[1]) == 0.57735f);
+    CHECK(indexes[1] == 1);
+    CHECK(Approx(values[2]) == 0.57735f);
+    CHECK(indexes[2] == 2);
+
+    // The buffers are reused for a result with fewer values
+    REQUIRE(TfidfVectorizerFeaturizer_TransformInto(pTransformerHandle, "fox jumpy", 9, &numElements, &numValues, values.data(), indexes.data(), values.size(), &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    REQUIRE(numValues == 2);
+
+    CHECK(Approx(values[0]) == 0.707107f);
+    CHECK(Approx(values[1]) == 0.707107f);
+
+    // The buffers are too small; the required size is returned but the buffers are not modified
+    values[0] = -1.0f;
+
+    REQUIRE(TfidfVectorizerFeaturizer_TransformInto(pTransformerHandle, input, 9, &numElements, &numValues, values.data(), indexes.data(), 2, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+
+    CHECK(numValues == 3);
+    CHECK(values[0] == -1.0f);
+
+    // Invalid buffers
+    REQUIRE(TfidfVectorizerFeaturizer_TransformInto(pTransformerHandle, input, 9, &numElements, &numValues, nullptr, nullptr, 3, &pErrorInfo) == false);
+    REQUIRE(pErrorInfo != nullptr);
+
+    REQUIRE(DestroyErrorInfo(pErrorInfo));
+    pErrorInfo = nullptr;
+
+    REQUIRE(TfidfVectorizerFeaturizer_DestroyTransformer(pTransformerHandle, &pErrorInfo));
+    REQUIRE(pErrorInfo == nullptr);
+}
+
@@ -4,10 +4,12 @@
 // ----------------------------------------------------------------------
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <limits>
 #include <mutex>
 #include <random>
 #include <stdexcept>
-#include <unordered_map>
 
 #include <assert.h>
 
@@ -19,6 +21,17 @@ namespace Featurizer{
 ///  \brief         Provide an interface to store pointers in exchange of
 ///                 an index to avoid exposing pointers to users
 ///
+///                 Pointers are stored in generation-tagged slots that live
+///                 in segments that are allocated on demand and never move.
+///                 An index encodes both the slot and the generation of the
+///                 slot at the time that the pointer was added; the generation
+///                 is incremented when the pointer is removed, which ensures
+///                 that stale indexes are rejected.
+///
+///                 `Get` is wait-free and doesn't take any locks. `Add` and
+///                 `Remove` use an atomic free list and only lock when a new
+///                 segment needs to be allocated.
+///
 class PointerTable {
 public:
     // ----------------------------------------------------------------------
@@ -27,6 +40,10 @@ public:
     // |
     // ----------------------------------------------------------------------
     PointerTable(unsigned int seed=(std::random_device())());
+    ~PointerTable(void);
+
+    PointerTable(PointerTable const &) = delete;
+    PointerTable & operator =(PointerTable const &) = delete;
 
     template<typename T>
     size_t Add(const T* const toBeAdded);
@@ -44,14 +61,56 @@ private:
     // ----------------------------------------------------------------------
     using LockGuard                         = std::lock_guard<std::mutex>;
 
+    struct Slot {
+        // Odd generations indicate that the slot is in use
+        std::atomic<std::uint32_t>          Generation;
+        std::atomic<void const *>           Pointer;
+
+        // 1-based index of the next free slot (0 indicates the end of the list)
+        std::atomic<std::uint32_t>          NextFree;
+    };
+
     // ----------------------------------------------------------------------
     // |
     // |  Private Data
     // |
     // ----------------------------------------------------------------------
-    std::unordered_map<std::size_t, const void *>       m_un;
-    std::mutex                                          m_un_mutex;
-    std::mt19937                                        m_mt;
+
+    // On 64-bit platforms, the index is made up of a 32-bit generation and a
+    // 32-bit (1-based) slot index. 32-bit platforms use 12 bits for the generation
+    // and 20 bits for the slot index.
+    static constexpr unsigned int           SlotIndexBits = sizeof(size_t) == 8 ? 32 : 20;
+    static constexpr size_t                 SlotIndexMask = (static_cast<size_t>(1) << SlotIndexBits) - 1;
+    static constexpr std::uint32_t          GenerationMask = static_cast<std::uint32_t>(std::numeric_limits<size_t>::max() >> SlotIndexBits);
+
+    static constexpr size_t                 SegmentSize = 4096;
+    static constexpr size_t                 MaxNumSegments = sizeof(size_t) == 8 ? 1024 : 255;
+
+    std::atomic<Slot *>                     m_segments[MaxNumSegments];
+    std::atomic<size_t>                     m_numSlots;
+
+    // Head of the free list; the upper 32 bits are a counter used to
+    // prevent ABA problems and the lower 32 bits are a 1-based slot index.
+    std::atomic<std::uint64_t>              m_freeHead;
+
+    std::mutex                              m_segmentsMutex;
+    std::mt19937                            m_mt;
+
+    // ----------------------------------------------------------------------
+    // |
+    // |  Private Methods
+    // |
+    // ----------------------------------------------------------------------
+
+    /// Returns the slot associated with the index or nullptr if the index
+    /// doesn't correspond to an allocated slot.
+    Slot * GetSlot(size_t index) const;
+
+    /// Returns the slot at the 0-based position, which must have been allocated.
+    Slot & GetSlotAtPosition(size_t position) const;
+
+    /// Returns a 0-based position of a slot that isn't in use.
+    size_t AcquireSlotPosition(void);
 };
 
 
@@ -64,10 +123,18 @@ private:
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
 // ----------------------------------------------------------------------
-inline PointerTable::PointerTable(unsigned int seed) : m_mt(seed) {
-
+inline PointerTable::PointerTable(unsigned int seed) :
+    m_numSlots(0),
+    m_freeHead(0),
+    m_mt(seed) {
+    for(auto & segment : m_segments)
+        segment.store(nullptr);
 }
 
+inline PointerTable::~PointerTable(void) {
+    for(auto & segment : m_segments)
+        delete [] segment.load();
+}
 
 template<typename T>
 size_t PointerTable::Add(const T * const templatePointer) {
@@ -75,42 +142,40 @@ size_t PointerTable::Add(const T * const templatePointer) {
         throw std::invalid_argument("Trying to add a null pointer to the table!");
     }
 
-
     void const * const                      toBeAdded(reinterpret_cast<const void* const>(templatePointer));
-    size_t                                  empty_index(0);
 
+    // since we are controlling where and how to use PointerTable and Add function
+    // check for duplicates at run time would not be worth the cost
+    // comparing to the chance of adding the same pointer twice,
+    // so we would only check for duplicates in debug mode
+#if (defined DEBUG)
     {
-        LockGuard const                     lock(m_un_mutex);
+        size_t const                        numSlots(m_numSlots.load());
 
-        std::ignore = lock;
+        for(size_t position = 0; position < numSlots; ++position) {
+            Slot const * const              pSlot(GetSlot(position + 1));
 
-        // since we are controlling where and how to use PointerTable and Add function
-        // it wouldn't worth the cost to have two maps with atomic insertions
-        // check for duplicates at run time
-        // comparing to the chance of adding the same pointer twice,
-        // so we would only check for duplicates in debug mode
-#if (defined DEBUG)
-            for (auto pairs : m_un) {
-                assert(pairs.second != toBeAdded);
-            }
+            if(pSlot && (pSlot->Generation.load() & 1))
+                assert(pSlot->Pointer.load() != toBeAdded);
+        }
+    }
 #endif
 
-        // size would be changing throughout the process
-        // index zero is reserved
-        std::uniform_int_distribution<size_t>           dist(1,std::numeric_limits<std::size_t>::max());
+    size_t const                            position(AcquireSlotPosition());
+    Slot &                                  slot(GetSlotAtPosition(position));
 
-        while(true) {
-            size_t rand_index = dist(m_mt);
-            if (m_un.find(rand_index) == m_un.end()) {
-                empty_index = rand_index;
-                break;
-            }
-        }
-        assert(empty_index != 0);
-        m_un[empty_index] = toBeAdded;
-    }
+    // This thread has exclusive ownership of the slot at this point
+    slot.Pointer.store(toBeAdded);
 
-    return empty_index;
+    std::uint32_t const                     generation(slot.Generation.load() + 1);
+
+    assert(generation & 1);
+    slot.Generation.store(generation);
+
+    size_t const                            index((static_cast<size_t>(generation & GenerationMask) << SlotIndexBits) | (position + 1));
+
+    assert(index != 0);
+    return index;
 }
 
 template<typename T>
@@ -120,18 +185,29 @@ T* PointerTable::Get(size_t index) {
         throw std::invalid_argument("Invalid query to the Pointer table, index cannot be zero!");
     }
 
-    LockGuard const                         lock(m_un_mutex);
+    Slot * const                            pSlot(GetSlot(index));
+
+    if(pSlot == nullptr) {
+        throw std::invalid_argument("Invalid query to the Pointer table, index incorrect!");
+    }
 
-    std::ignore = lock;
+    std::uint32_t const                     generation(static_cast<std::uint32_t>(index >> SlotIndexBits));
 
-    std::unordered_map<std::size_t, const void*>::const_iterator found = m_un.find(index);
-    if (found == m_un.end()) {
+    // Indexes created by `Add` always have an odd generation
+    if((generation & 1) == 0 || (pSlot->Generation.load() & GenerationMask) != generation) {
         throw std::invalid_argument("Invalid query to the Pointer table, index incorrect!");
     }
 
-    return reinterpret_cast<T*>(const_cast<void*>(found->second));
-}
+    void const * const                      result(pSlot->Pointer.load());
 
+    // The slot may have been released (and potentially reused) while the pointer
+    // was being read; the generation will have changed if that is the case.
+    if((pSlot->Generation.load() & GenerationMask) != generation) {
+        throw std::invalid_argument("Invalid query to the Pointer table, index incorrect!");
+    }
+
+    return reinterpret_cast<T*>(const_cast<void*>(result));
+}
 
 inline void PointerTable::Remove(size_t index) {
     // pre-check
@@ -139,16 +215,110 @@ inline void PointerTable::Remove(size_t index) {
         throw std::invalid_argument("Invalid remove from the Pointer table, index cannot be zero!");
     }
 
-    LockGuard const                         lock(m_un_mutex);
+    Slot * const                            pSlot(GetSlot(index));
 
-    std::ignore = lock;
+    if(pSlot == nullptr) {
+        throw std::invalid_argument("Invalid remove from the Pointer table, index pointer not found!");
+    }
 
-    std::unordered_map<std::size_t, const void*>::const_iterator found = m_un.find(index);
-    if (found == m_un.end()) {
+    std::uint32_t const                     generation(static_cast<std::uint32_t>(index >> SlotIndexBits));
+    std::uint32_t                           current(pSlot->Generation.load());
+
+    // Only one of the threads attempting to remove the same index will succeed
+    if(
+        (generation & 1) == 0
+        || (current & GenerationMask) != generation
+        || pSlot->Generation.compare_exchange_strong(current, current + 1) == false
+    ) {
         throw std::invalid_argument("Invalid remove from the Pointer table, index pointer not found!");
     }
 
-    m_un.erase(found);
+    pSlot->Pointer.store(nullptr);
+
+    // Push the slot onto the free list
+    std::uint32_t const                     slotIndex(static_cast<std::uint32_t>(index & SlotIndexMask));
+    std::uint64_t                           head(m_freeHead.load());
+
+    while(true) {
+        pSlot->NextFree.store(static_cast<std::uint32_t>(head));
+
+        if(m_freeHead.compare_exchange_weak(head, ((head >> 32) + 1) << 32 | slotIndex))
+            break;
+    }
+}
+
+inline PointerTable::Slot * PointerTable::GetSlot(size_t index) const {
+    size_t const                            slotIndex(index & SlotIndexMask);
+
+    if(slotIndex == 0)
+        return nullptr;
+
+    size_t const                            position(slotIndex - 1);
+    size_t const                            segmentIndex(position / SegmentSize);
+
+    if(segmentIndex >= MaxNumSegments)
+        return nullptr;
+
+    Slot * const                            pSegment(m_segments[segmentIndex].load());
+
+    if(pSegment == nullptr)
+        return nullptr;
+
+    return pSegment + position % SegmentSize;
+}
+
+inline PointerTable::Slot & PointerTable::GetSlotAtPosition(size_t position) const {
+    Slot * const                            pSegment(m_segments[position / SegmentSize].load());
+
+    assert(pSegment);
+    return pSegment[position % SegmentSize];
+}
+
+inline size_t PointerTable::AcquireSlotPosition(void) {
+    // Reuse a slot from the free list if one is available
+    std::uint64_t                           head(m_freeHead.load());
+
+    while(static_cast<std::uint32_t>(head) != 0) {
+        size_t const                        position(static_cast<std::uint32_t>(head) - 1);
+        std::uint32_t const                 next(GetSlotAtPosition(position).NextFree.load());
+
+        if(m_freeHead.compare_exchange_weak(head, ((head >> 32) + 1) << 32 | next))
+            return position;
+    }
+
+    // Use a new slot
+    size_t const                            position(m_numSlots.fetch_add(1));
+
+    if(position >= MaxNumSegments * SegmentSize || position >= SlotIndexMask) {
+        m_numSlots.fetch_sub(1);
+        throw std::runtime_error("The Pointer table is full!");
+    }
+
+    std::atomic<Slot *> &                   segment(m_segments[position / SegmentSize]);
+
+    if(segment.load() == nullptr) {
+        LockGuard const                     lock(m_segmentsMutex);
+
+        std::ignore = lock;
+
+        if(segment.load() == nullptr) {
+            Slot *                          pSegment(new Slot[SegmentSize]);
+
+            // Start each slot with a random (even) generation so that indexes
+            // are not predictable
+            for(size_t offset = 0; offset < SegmentSize; ++offset) {
+                Slot &                      slot(pSegment[offset]);
+
+                slot.Generation.store(static_cast<std::uint32_t>(m_mt()) & ~static_cast<std::uint32_t>(1));
+                slot.Pointer.store(nullptr);
+                slot.NextFree.store(0);
+            }
+
+            segment.store(pSegment);
+        }
+    }
+
+    return position;
 }
 
 } // namespace Featurizer
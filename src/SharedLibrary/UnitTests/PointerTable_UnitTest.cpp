@@ -4,8 +4,12 @@
 // ----------------------------------------------------------------------
 
 #define CATCH_CONFIG_MAIN
-#include <string>
+#include <atomic>
 #include <iostream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "catch.hpp"
 
@@ -45,36 +49,116 @@ TEST_CASE("Add_Find_Remove") {
 }
 
 TEST_CASE("Check_Randomness_Given_Seed") {
-    PointerTable TestTable(5);
-
+    PointerTable TestTable1(5);
+    PointerTable TestTable2(5);
+    PointerTable TestTable3(6);
 
     int p0 = 0;
     int p1 = 1;
     int p2 = 2;
 
+    size_t i0 = TestTable1.Add<int>(&p0);
+    size_t i1 = TestTable1.Add<int>(&p1);
+    size_t i2 = TestTable1.Add<int>(&p2);
+
+    CHECK(i0 != i1);
+    CHECK(i0 != i2);
+    CHECK(i1 != i2);
+
+    // The same seed generates the same indexes
+    CHECK(TestTable2.Add<int>(&p0) == i0);
+    CHECK(TestTable2.Add<int>(&p1) == i1);
+    CHECK(TestTable2.Add<int>(&p2) == i2);
+
+    // A different seed generates different indexes
+    CHECK(TestTable3.Add<int>(&p0) != i0);
+    CHECK(TestTable3.Add<int>(&p1) != i1);
+    CHECK(TestTable3.Add<int>(&p2) != i2);
+}
+
+TEST_CASE("Stale_Index") {
+    PointerTable TestTable;
+
+    int p0 = 0;
+    int p1 = 1;
+
     size_t i0 = TestTable.Add<int>(&p0);
+
+    TestTable.Remove(i0);
+
+    // The slot is reused, but the original index is no longer valid
     size_t i1 = TestTable.Add<int>(&p1);
-    size_t i2 = TestTable.Add<int>(&p2);
-
-#if (defined _MSC_VER)
-#   pragma warning(push)
-#   pragma warning(disable: 4127)           // conditional expression is constant
-#endif
-
-    if(sizeof(size_t) == 8) {
-        // 64 bit
-        CHECK(i0 == 4095051218741643471UL);
-        CHECK(i1 == 16062175962503177918UL);
-        CHECK(i2 == 3813295331020233847UL);
+
+    CHECK(i1 != i0);
+    CHECK(TestTable.Get<int>(i1) == &p1);
+
+    REQUIRE_THROWS_WITH(TestTable.Get<int>(i0),"Invalid query to the Pointer table, index incorrect!");
+    REQUIRE_THROWS_WITH(TestTable.Remove(i0),"Invalid remove from the Pointer table, index pointer not found!");
+
+    // Indexes that were never returned by the table
+    REQUIRE_THROWS_WITH(TestTable.Get<int>(i1 + 1),"Invalid query to the Pointer table, index incorrect!");
+    REQUIRE_THROWS_WITH(TestTable.Get<int>(i1 ^ (static_cast<size_t>(1) << (sizeof(size_t) * 8 - 1))),"Invalid query to the Pointer table, index incorrect!");
+    REQUIRE_THROWS_WITH(TestTable.Get<int>(std::numeric_limits<size_t>::max()),"Invalid query to the Pointer table, index incorrect!");
+
+    CHECK(TestTable.Get<int>(i1) == &p1);
+}
+
+TEST_CASE("Many_Pointers") {
+    PointerTable TestTable;
+
+    // More than a single segment
+    std::vector<int> values(10000);
+    std::vector<size_t> indexes;
+
+    for(auto & value : values)
+        indexes.emplace_back(TestTable.Add<int>(&value));
+
+    for(size_t i = 0; i < values.size(); ++i)
+        CHECK(TestTable.Get<int>(indexes[i]) == &values[i]);
+
+    for(size_t i = 0; i < values.size(); i += 2)
+        TestTable.Remove(indexes[i]);
+
+    for(size_t i = 0; i < values.size(); ++i) {
+        if(i % 2 == 0)
+            CHECK_THROWS(TestTable.Get<int>(indexes[i]));
+        else
+            CHECK(TestTable.Get<int>(indexes[i]) == &values[i]);
     }
-    else {
-        // 32 bit
-        CHECK(i0 == 953453412);
-        CHECK(i1 == 236996815);
-        CHECK(i2 == 3739766768);
+}
+
+TEST_CASE("Concurrent_Access") {
+    PointerTable TestTable;
+
+    size_t const numThreads(4);
+    size_t const numIterations(10000);
+
+    int shared = 0;
+    size_t const sharedIndex(TestTable.Add<int>(&shared));
+
+    std::vector<std::thread> threads;
+    std::atomic<size_t> numErrors(0);
+
+    for(size_t t = 0; t < numThreads; ++t) {
+        threads.emplace_back(
+            [&TestTable, &numErrors, sharedIndex, &shared, numIterations](void) {
+                int local = 0;
+
+                for(size_t i = 0; i < numIterations; ++i) {
+                    size_t const index(TestTable.Add<int>(&local));
+
+                    if(TestTable.Get<int>(index) != &local || TestTable.Get<int>(sharedIndex) != &shared)
+                        ++numErrors;
+
+                    TestTable.Remove(index);
+                }
+            }
+        );
     }
 
-#if (defined _MSC_VER)
-#   pragma warning(pop)
-#endif
+    for(auto & thread : threads)
+        thread.join();
+
+    CHECK(numErrors.load() == 0);
+    CHECK(TestTable.Get<int>(sharedIndex) == &shared);
 }
@@ -85,6 +85,13 @@ void Parse(std::string const &input,
 ///  \fn            ParseRegex
 ///  \brief         Parse string using RegexToken and callback each element
 ///
+///                 `regexToken` is either a pattern (which is compiled on each
+///                 call) or a compiled `re2::RE2`. Compilation is much more
+///                 expensive than matching a short string, so callers that
+///                 parse many strings should compile the pattern once;
+///                 `re2::RE2` objects can be shared across threads.
+///                 Empty matches are skipped.
+///
 template <typename RegexT>
 void ParseRegex(std::string const &input,
                 RegexT const &regexToken,
@@ -95,6 +102,10 @@ void ParseRegex(char const *pString, size_t cCharacters,
                 RegexT const &regexToken,
                 std::function<void (char const *, size_t)> const &callback);
 
+inline void ParseRegex(char const *pString, size_t cCharacters,
+                       re2::RE2 const &regex,
+                       std::function<void (char const *, size_t)> const &callback);
+
 
 /////////////////////////////////////////////////////////////////////////
 ///  \fn            ParseNgramWord
@@ -361,15 +372,34 @@ void ParseRegex(char const *pString, size_t cCharacters,
     if(pString == nullptr) throw std::invalid_argument("pString");
     if(cCharacters == 0) throw std::invalid_argument("cCharacters");
 
+    re2::RE2 const                          pattern(regexToken);
+
+    ParseRegex(pString, cCharacters, pattern, callback);
+}
+
+inline void ParseRegex(char const *pString, size_t cCharacters,
+                       re2::RE2 const &regex,
+                       std::function<void (char const *, size_t)> const &callback) {
+    if(pString == nullptr) throw std::invalid_argument("pString");
+    if(cCharacters == 0) throw std::invalid_argument("cCharacters");
+
     re2::StringPiece                        sp(pString, cCharacters);
-    re2::RE2                                pattern(regexToken);
     size_t                                  start_loc(0);
     re2::StringPiece                        submatch;
     const RE2::Anchor                       anchor(RE2::UNANCHORED);
 
-    while(pattern.Match(sp, start_loc, sp.size(), anchor, &submatch, 1)) {
+    while(start_loc <= sp.size() && regex.Match(sp, start_loc, sp.size(), anchor, &submatch, 1)) {
+        size_t const                        matchStart(static_cast<size_t>(submatch.data() - sp.data()));
+
+        // An empty match isn't an element; step past it so that the search
+        // always makes progress
+        if(submatch.empty()) {
+            start_loc = matchStart + 1;
+            continue;
+        }
+
         callback(submatch.data(), submatch.size());
-        start_loc = static_cast<size_t>(submatch.data() - sp.data()) + submatch.length();
+        start_loc = matchStart + submatch.size();
     }
 }
 
@@ -650,6 +650,40 @@ def _GenerateHeaderFile(open_file_func, output_dir, items, c_data_items, output_
             else:
                 transform_output_param = ", ".join(["/*out*/ {} {}".format(p.Type, p.Name) for p in c_data.OutputTypeInfo.GetOutputInfo("output").Parameters])
 
+            transform_buffer_output_info = _GetTransformBufferOutputInfo(item, c_data)
+
+            if transform_buffer_output_info is not None:
+                transform_buffer_method = textwrap.dedent(
+                    """\
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}TransformBuffer(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_buffer_param}, {output_buffer_param}, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    """,
+                ).format(
+                    input_buffer_param=", ".join(
+                        ["/*in*/ {} {}".format(p.Type, p.Name) for p in c_data.InputTypeInfo.GetInputBufferInfo("input", "").Parameters],
+                    ),
+                    output_buffer_param=_ToOutputBufferParamsString(transform_buffer_output_info),
+                    **d
+                )
+            else:
+                transform_buffer_method = ""
+
+            transform_into_output_info = _GetTransformIntoOutputInfo(item, c_data)
+
+            if transform_into_output_info is not None:
+                transform_into_method = textwrap.dedent(
+                    """\
+                    FEATURIZER_LIBRARY_API bool {name}{suffix}TransformInto(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_span_param}, {output_span_param}, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    """,
+                ).format(
+                    input_span_param=", ".join(
+                        ["/*in*/ {} {}".format(p.Type, p.Name) for p in c_data.InputTypeInfo.GetInputSpanInfo("input", "").Parameters],
+                    ),
+                    output_span_param=_ToOutputBufferParamsString(transform_into_output_info),
+                    **d
+                )
+            else:
+                transform_into_method = ""
+
             f.write(
                 textwrap.dedent(
                     """\
@@ -677,7 +711,7 @@ def _GenerateHeaderFile(open_file_func, output_dir, items, c_data_items, output_
                     FEATURIZER_LIBRARY_API bool {name}{suffix}CreateTransformerSaveData(/*in*/ {name}{suffix}TransformerHandle *pHandle, /*out*/ unsigned char const **ppBuffer, /*out*/ size_t *pBufferSize, /*out*/ ErrorInfoHandle **ppErrorInfo);
 
                     FEATURIZER_LIBRARY_API bool {name}{suffix}Transform(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {transform_output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo);
-                    FEATURIZER_LIBRARY_API bool {name}{suffix}Flush(/*in*/ {name}{suffix}TransformerHandle *pHandle, {flush_output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo);
+                    {transform_into_method}{transform_buffer_method}FEATURIZER_LIBRARY_API bool {name}{suffix}Flush(/*in*/ {name}{suffix}TransformerHandle *pHandle, {flush_output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo);
                     {delete_transformed_method}
                     """,
                 ).format(
@@ -692,6 +726,8 @@ def _GenerateHeaderFile(open_file_func, output_dir, items, c_data_items, output_
                     ),
                     transform_output_param=transform_output_param,
                     flush_output_param=flush_output_param,
+                    transform_into_method=transform_into_method,
+                    transform_buffer_method=transform_buffer_method,
                     delete_transformed_method=delete_transformed_method,
                     **d
                 )
@@ -1202,6 +1238,128 @@ def _GenerateCppFile(open_file_func, output_dir, items, c_data_items, output_str
                 )
             )
 
+            # TransformInto (optional)
+            transform_into_output_info = _GetTransformIntoOutputInfo(item, c_data)
+
+            if transform_into_output_info is not None:
+                transform_into_input_info = c_data.InputTypeInfo.GetInputSpanInfo("input", transform_into_output_info.InvocationStatements)
+
+                f.write(
+                    textwrap.dedent(
+                        """\
+                        FEATURIZER_LIBRARY_API bool {name}{suffix}TransformInto(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                            {method_prefix}
+                                if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+                                {input_validation}
+
+                                {output_validation}
+
+                                Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+                                // The result is written directly to the output buffers
+                                {invocation_statement}
+                            {method_suffix}
+                        }}
+
+                        """,
+                    ).format(
+                        input_param=", ".join(["/*in*/ {} {}".format(p.Type, p.Name) for p in transform_into_input_info.Parameters]),
+                        output_param=_ToOutputBufferParamsString(transform_into_output_info),
+                        input_validation="// No input validation" if not transform_into_input_info.ValidationStatements else StringHelpers.LeftJustify(
+                            transform_into_input_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        output_validation="// No output validation" if not transform_into_output_info.ValidationStatements else StringHelpers.LeftJustify(
+                            transform_into_output_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        invocation_statement=StringHelpers.LeftJustify(
+                            transform_into_input_info.InvocationStatements.strip(),
+                            8,
+                        ),
+                        **d
+                    )
+                )
+
+            # TransformBuffer (optional)
+            transform_buffer_output_info = _GetTransformBufferOutputInfo(item, c_data)
+
+            if transform_buffer_output_info is not None:
+                transform_buffer_invocation_template = "TransformedType result(transformer.execute({}));"
+
+                # Process the items one at a time if the type supports it, as that avoids a copy
+                # of the entire input
+                transform_buffer_input_info = c_data.InputTypeInfo.GetInputBufferItemInfo("input", transform_buffer_invocation_template)
+
+                if transform_buffer_input_info is not None:
+                    transform_buffer_input_statements = ""
+                    transform_buffer_input_items = "input_items"
+                    transform_buffer_input_invocation = transform_buffer_input_info.InvocationStatements
+
+                else:
+                    transform_buffer_input_info = c_data.InputTypeInfo.GetInputBufferInfo("input", c_data.InputTypeInfo._InvocationTemplate)
+
+                    transform_buffer_input_statements, transform_buffer_input_tuple = c_data.InputTypeInfo._ExtractDecoratedInvocationStatements(
+                        transform_buffer_input_info.InvocationStatements,
+                    )
+
+                    transform_buffer_input_items = transform_buffer_input_tuple[1]
+                    transform_buffer_input_invocation = transform_buffer_invocation_template.format(
+                        "{}[index]".format(transform_buffer_input_tuple[0]),
+                    )
+
+                f.write(
+                    textwrap.dedent(
+                        """\
+                        FEATURIZER_LIBRARY_API bool {name}{suffix}TransformBuffer(/*in*/ {name}{suffix}TransformerHandle *pHandle, {input_param}, {output_param}, /*out*/ ErrorInfoHandle **ppErrorInfo) {{
+                            {method_prefix}
+                                if(pHandle == nullptr) throw std::invalid_argument("'pHandle' is null");
+
+                                {input_validation}
+
+                                {output_validation}
+
+                                Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType & transformer(*g_pointerTable.Get<Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformerType>(reinterpret_cast<size_t>(pHandle)));
+
+                                using TransformedType = typename Microsoft::Featurizer::Featurizers::{estimator_name}{cpp_template_suffix}::TransformedType;
+
+                                {input_statement}for(size_t index = 0; index < {input_items}; ++index) {{
+                                    {input_invocation}
+
+                                    {output_statement}
+                                }}
+                            {method_suffix}
+                        }}
+
+                        """,
+                    ).format(
+                        input_param=", ".join(["/*in*/ {} {}".format(p.Type, p.Name) for p in transform_buffer_input_info.Parameters]),
+                        output_param=_ToOutputBufferParamsString(transform_buffer_output_info),
+                        input_validation="// No input validation" if not transform_buffer_input_info.ValidationStatements else StringHelpers.LeftJustify(
+                            transform_buffer_input_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        output_validation="// No output validation" if not transform_buffer_output_info.ValidationStatements else StringHelpers.LeftJustify(
+                            transform_buffer_output_info.ValidationStatements.strip(),
+                            8,
+                        ),
+                        input_statement="" if not transform_buffer_input_statements else "{}\n\n        ".format(
+                            StringHelpers.LeftJustify(transform_buffer_input_statements.strip(), 8),
+                        ),
+                        input_items=transform_buffer_input_items,
+                        input_invocation=StringHelpers.LeftJustify(
+                            transform_buffer_input_invocation.strip(),
+                            12,
+                        ),
+                        output_statement=StringHelpers.LeftJustify(
+                            transform_buffer_output_info.InvocationStatements.strip(),
+                            12,
+                        ),
+                        **d
+                    )
+                )
+
             # Flush
             f.write(
                 textwrap.dedent(
@@ -1286,6 +1444,54 @@ def _GenerateCppFile(open_file_func, output_dir, items, c_data_items, output_str
         )
 
 
+# ----------------------------------------------------------------------
+def _GetTransformBufferOutputInfo(item, c_data):
+    """\
+    Returns the output info used by the TransformBuffer method or None if the
+    featurizer doesn't support writing to caller-provided buffers.
+
+    TransformBuffer is only available for featurizers that produce exactly
+    one output for each input.
+    """
+
+    if item.has_dynamic_output:
+        return None
+
+    return c_data.OutputTypeInfo.GetOutputBufferInfo("output")
+
+
+# ----------------------------------------------------------------------
+def _GetTransformIntoOutputInfo(item, c_data):
+    """\
+    Returns the output info used by the TransformInto method or None if the
+    featurizer doesn't support writing a single result to caller-provided buffers.
+
+    TransformInto allows callers to reuse their buffers across calls for outputs
+    whose size varies from row to row.
+    """
+
+    if item.has_dynamic_output:
+        return None
+
+    return c_data.OutputTypeInfo.GetOutputSpanInfo("output")
+
+
+# ----------------------------------------------------------------------
+def _ToOutputBufferParamsString(output_buffer_info):
+    # Output buffers are provided by the caller; values that aren't pointers
+    # describe those buffers (for example, their capacity) and are inputs.
+    return ", ".join(
+        [
+            "/*{}*/ {} {}".format(
+                "out" if p.Type.endswith("*") else "in",
+                p.Type,
+                p.Name,
+            )
+            for p in output_buffer_info.Parameters
+        ],
+    )
+
+
 # ----------------------------------------------------------------------
 # ----------------------------------------------------------------------
 # ----------------------------------------------------------------------
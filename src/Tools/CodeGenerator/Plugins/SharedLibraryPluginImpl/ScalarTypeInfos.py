@@ -193,6 +193,31 @@ class _ScalarTypeInfo(TypeInfo):
             ),
         )
 
+    # ----------------------------------------------------------------------
+    @Interface.override
+    def GetOutputBufferInfo(
+        self,
+        arg_name,
+        index_var_name="index",
+        result_name="result",
+    ):
+        # Optional values are returned as individually allocated pointers, which
+        # defeats the purpose of a caller-provided buffer.
+        if self.RequiresOptionalType:
+            return None
+
+        return self.Result(
+            [self.Type("{} *".format(self.CType), "{}_ptr".format(arg_name))],
+            """if({name}_ptr == nullptr) throw std::invalid_argument("'{name}_ptr' is null");""".format(
+                name=arg_name,
+            ),
+            "{name}_ptr[{index}] = {result};".format(
+                name=arg_name,
+                index=index_var_name,
+                result=result_name,
+            ),
+        )
+
     # ----------------------------------------------------------------------
     @Interface.override
     def GetDestroyOutputInfo(
@@ -113,6 +113,42 @@ class SingleValueSparseVectorTypeInfo(TypeInfo):
             ),
         )
 
+    # ----------------------------------------------------------------------
+    @Interface.override
+    def GetOutputBufferInfo(
+        self,
+        arg_name,
+        index_var_name="index",
+        result_name="result",
+    ):
+        return self.Result(
+            [
+                self.Type("uint64_t *", "{}_numElements_ptr".format(arg_name)),
+                self.Type("{} *".format(self._type_info.CType), "{}_value_ptr".format(arg_name)),
+                self.Type("uint64_t *", "{}_index_ptr".format(arg_name)),
+            ],
+            textwrap.dedent(
+                """\
+                if({name}_numElements_ptr == nullptr) throw std::invalid_argument("'{name}_numElements_ptr' is null");
+                if({name}_value_ptr == nullptr) throw std::invalid_argument("'{name}_value_ptr' is null");
+                if({name}_index_ptr == nullptr) throw std::invalid_argument("'{name}_index_ptr' is null");
+                """,
+            ).format(
+                name=arg_name,
+            ),
+            textwrap.dedent(
+                """\
+                {name}_numElements_ptr[{index}] = {result}.NumElements;
+                {name}_value_ptr[{index}] = {result}.Value;
+                {name}_index_ptr[{index}] = {result}.Index;
+                """,
+            ).format(
+                name=arg_name,
+                index=index_var_name,
+                result=result_name,
+            ),
+        )
+
     # ----------------------------------------------------------------------
     @Interface.override
     def GetDestroyOutputInfo(
@@ -129,6 +129,104 @@ class SparseVectorTypeInfo(TypeInfo):
             ),
         )
 
+    # ----------------------------------------------------------------------
+    @Interface.override
+    def GetOutputBufferInfo(
+        self,
+        arg_name,
+        index_var_name="index",
+        result_name="result",
+    ):
+        # The output is written in a CSR-like format: the values and indexes for all rows are
+        # stored contiguously, and `<name>_offsets_ptr` (which must contain one more element than
+        # the number of rows) holds the offset of the first value for each row.
+        #
+        # When `<name>_values_ptr` and `<name>_indexes_ptr` are both null and `<name>_values_items`
+        # is 0, only the elements and offsets are written; the last offset is the number of values
+        # required, which the caller can use to allocate buffers of the exact size.
+        return self.Result(
+            [
+                self.Type("uint64_t *", "{}_numElements_ptr".format(arg_name)),
+                self.Type("uint64_t *", "{}_offsets_ptr".format(arg_name)),
+                self.Type("{} *".format(self._type_info.CType), "{}_values_ptr".format(arg_name)),
+                self.Type("uint64_t *", "{}_indexes_ptr".format(arg_name)),
+                self.Type("size_t", "{}_values_items".format(arg_name)),
+            ],
+            textwrap.dedent(
+                """\
+                if({name}_numElements_ptr == nullptr) throw std::invalid_argument("'{name}_numElements_ptr' is null");
+                if({name}_offsets_ptr == nullptr) throw std::invalid_argument("'{name}_offsets_ptr' is null");
+
+                bool const {name}_is_size_query({name}_values_ptr == nullptr && {name}_indexes_ptr == nullptr && {name}_values_items == 0);
+
+                if({name}_is_size_query == false) {{
+                    if({name}_values_ptr == nullptr) throw std::invalid_argument("'{name}_values_ptr' is null");
+                    if({name}_indexes_ptr == nullptr) throw std::invalid_argument("'{name}_indexes_ptr' is null");
+                }}
+
+                {name}_offsets_ptr[0] = 0;
+                """,
+            ).format(
+                name=arg_name,
+            ),
+            textwrap.dedent(
+                """\
+                if({name}_is_size_query == false) {{
+                    if({result}.Values.size() > {name}_values_items - {name}_offsets_ptr[{index}]) throw std::invalid_argument("'{name}_values_items' is not large enough");
+
+                    {type} * pValue({name}_values_ptr + {name}_offsets_ptr[{index}]);
+                    uint64_t * pIndex({name}_indexes_ptr + {name}_offsets_ptr[{index}]);
+
+                    for(auto const & encoding : {result}.Values) {{
+                        *pValue++ = encoding.Value;
+                        *pIndex++ = encoding.Index;
+                    }}
+                }}
+
+                {name}_numElements_ptr[{index}] = {result}.NumElements;
+                {name}_offsets_ptr[{index} + 1] = {name}_offsets_ptr[{index}] + {result}.Values.size();
+                """,
+            ).format(
+                name=arg_name,
+                index=index_var_name,
+                result=result_name,
+                type=self._type_info.CType,
+            ),
+        )
+
+    # ----------------------------------------------------------------------
+    @Interface.override
+    def GetOutputSpanInfo(
+        self,
+        arg_name,
+        transformer_name="transformer",
+    ):
+        # `<name>_numValues` always receives the number of values in the result; the values
+        # and indexes are only written when `<name>_values_items` is large enough to hold them.
+        return self.Result(
+            [
+                self.Type("uint64_t *", "{}_numElements".format(arg_name)),
+                self.Type("uint64_t *", "{}_numValues".format(arg_name)),
+                self.Type("{} *".format(self._type_info.CType), "{}_values".format(arg_name)),
+                self.Type("uint64_t *", "{}_indexes".format(arg_name)),
+                self.Type("size_t", "{}_values_items".format(arg_name)),
+            ],
+            textwrap.dedent(
+                """\
+                if({name}_numElements == nullptr) throw std::invalid_argument("'{name}_numElements' is null");
+                if({name}_numValues == nullptr) throw std::invalid_argument("'{name}_numValues' is null");
+                if({name}_values == nullptr && {name}_values_items != 0) throw std::invalid_argument("'{name}_values' is null");
+                if({name}_indexes == nullptr && {name}_values_items != 0) throw std::invalid_argument("'{name}_indexes' is null");
+                """,
+            ).format(
+                name=arg_name,
+            ),
+            "*{name}_numValues = {transformer}.execute_into({{}}, *{name}_numElements, {name}_values, {name}_indexes, {name}_values_items);".format(
+                name=arg_name,
+                transformer=transformer_name,
+            ),
+        )
+
     # ----------------------------------------------------------------------
     @Interface.override
     def GetDestroyOutputInfo(
@@ -68,6 +68,28 @@ class StringTypeInfo(TypeInfo):
             invocation,
         )
 
+    # ----------------------------------------------------------------------
+    @Interface.override
+    def GetInputSpanInfo(self, arg_name, invocation_template):
+        if self.IsOptional:
+            return self.GetInputInfo(arg_name, invocation_template)
+
+        # The pointer and length are passed through as-is, so the string isn't copied
+        return self.Result(
+            [
+                self.Type("char const *", "{}_ptr".format(arg_name)),
+                self.Type("size_t", "{}_size".format(arg_name)),
+            ],
+            textwrap.dedent(
+                """\
+                if({name}_ptr == nullptr && {name}_size != 0) throw std::invalid_argument("'{name}_ptr' is null");
+                """,
+            ).format(
+                name=arg_name,
+            ),
+            invocation_template.format("{name}_ptr, {name}_size".format(name=arg_name)),
+        )
+
     # ----------------------------------------------------------------------
     @Interface.override
     def GetInputBufferInfo(
@@ -149,6 +171,75 @@ class StringTypeInfo(TypeInfo):
             input_buffer_type=self.Type(buffer_type, "{}_buffer".format(arg_name)),
         )
 
+    # ----------------------------------------------------------------------
+    @Interface.override
+    def GetInputBufferItemInfo(
+        self,
+        arg_name,
+        invocation_template,
+        index_var_name="index",
+    ):
+        # Each string is copied to a buffer that is reused for every item, so memory is only
+        # allocated when a longer string is encountered.
+        if self.IsOptional:
+            validation_suffix = "nonstd::optional<std::string> {name}_item;".format(
+                name=arg_name,
+            )
+
+            invocation = textwrap.dedent(
+                """\
+                if({name}_ptr[{index}] == nullptr)
+                    {name}_item.reset();
+                else {{
+                    if(!{name}_item)
+                        {name}_item.emplace();
+
+                    {name}_item->assign({name}_ptr[{index}]);
+                }}
+
+                """,
+            )
+
+        else:
+            validation_suffix = textwrap.dedent(
+                """\
+                for(char const * const *{name}_item_ptr = {name}_ptr; {name}_item_ptr != {name}_ptr + {name}_items; ++{name}_item_ptr) {{
+                    if(*{name}_item_ptr == nullptr) throw std::invalid_argument("'{name}_ptr' element is null");
+                }}
+
+                std::string {name}_item;
+                """,
+            ).format(
+                name=arg_name,
+            )
+
+            invocation = "{name}_item.assign({name}_ptr[{index}]);\n"
+
+        return self.Result(
+            [
+                self.Type("char const * const *", "{}_ptr".format(arg_name)),
+                self.Type("size_t", "{}_items".format(arg_name)),
+            ],
+            textwrap.dedent(
+                """\
+                if({name}_ptr == nullptr) throw std::invalid_argument("'{name}_ptr' is null");
+                if({name}_items == 0) throw std::invalid_argument("'{name}_items' is 0");
+
+                {validation_suffix}
+                """,
+            ).format(
+                name=arg_name,
+                validation_suffix=validation_suffix.strip(),
+            ),
+            "{}{}".format(
+                invocation.format(
+                    name=arg_name,
+                    index=index_var_name,
+                ),
+                invocation_template.format("{}_item".format(arg_name)),
+            ),
+        )
+
     # ----------------------------------------------------------------------
     @Interface.override
     def GetOutputInfo(
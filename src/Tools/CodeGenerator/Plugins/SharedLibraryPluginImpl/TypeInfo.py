@@ -124,6 +124,28 @@ class TypeInfo(Interface.Interface):
         """
         raise Exception("Abstract method")
 
+    # ----------------------------------------------------------------------
+    @Interface.extensionmethod
+    def GetInputBufferItemInfo(
+        self,
+        arg_name,
+        invocation_template,
+        index_var_name="index",
+    ):
+        """\
+        Returns information about the type when used as a buffer input argument whose
+        items are processed one at a time (rather than as a single buffer).
+
+        The validation statements are executed once, before any item is processed; the
+        invocation statements are executed for each item, where `index_var_name` is the
+        index of the item being processed. The number of items is provided in the
+        `<arg_name>_items` parameter.
+
+        Return `None` to process the items with the information returned by
+        `GetInputBufferInfo`.
+        """
+        return None
+
     # ----------------------------------------------------------------------
     @Interface.abstractmethod
     def GetOutputInfo(
@@ -139,6 +161,63 @@ class TypeInfo(Interface.Interface):
         """
         raise Exception("Abstract method")
 
+    # ----------------------------------------------------------------------
+    @Interface.extensionmethod
+    def GetOutputBufferInfo(
+        self,
+        arg_name,
+        index_var_name="index",
+        result_name="result",
+    ):
+        """\
+        Returns information about the type when used as an output argument that is
+        written to caller-provided buffers (one entry per input item).
+
+        The invocation statements are executed once for each item, where `index_var_name`
+        is the index of the item being processed and `result_name` is the name of the
+        result returned by the shared library.
+
+        Return `None` if the type cannot be written to caller-provided buffers.
+        """
+        return None
+
+    # ----------------------------------------------------------------------
+    @Interface.extensionmethod
+    def GetInputSpanInfo(self, arg_name, invocation_template):
+        """\
+        Returns information about the type when used as an input argument whose
+        content is provided as a pointer and length (rather than a null-terminated
+        value); types that don't have a variable length use the information
+        returned by `GetInputInfo`.
+
+        `invocation_template` is a template string that should be formatted with
+        the argument values (the pointer and length for types with a variable length).
+        """
+        return self.GetInputInfo(arg_name, invocation_template)
+
+    # ----------------------------------------------------------------------
+    @Interface.extensionmethod
+    def GetOutputSpanInfo(
+        self,
+        arg_name,
+        transformer_name="transformer",
+    ):
+        """\
+        Returns information about the type when used as an output argument that is
+        written to caller-provided buffers of a caller-specified capacity.
+
+        The number of items required is always written; the items themselves are
+        only written if the buffers are large enough, so that the caller can grow
+        the buffers and invoke the method again.
+
+        The invocation statements are a template (to be formatted with the input
+        arguments) that invokes the transformer's `execute_into` method, which
+        writes the result directly to the buffers.
+
+        Return `None` if the type cannot be written to caller-provided buffers.
+        """
+        return None
+
     # ----------------------------------------------------------------------
     @Interface.abstractmethod
     def GetDestroyOutputInfo(
@@ -60,6 +60,7 @@
 #endif
 
 #include "3rdParty/eigen/Eigen/Dense"
+#include "3rdParty/eigen/Eigen/SparseCore"
 
 #if (defined __clang__)
 #   pragma clang diagnostic pop
@@ -202,6 +203,10 @@ using RowMajMatrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::Row
 template<class T>
 using ColMajMatrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor>;
 
+// Define a compressed sparse row (CSR) type
+template<class T>
+using SparseRowMajMatrix = Eigen::SparseMatrix<T, Eigen::RowMajor>;
+
 namespace Details {
 // Force to provide mappings for other types
 // The following two level specialization is provided to
@@ -232,6 +237,19 @@ struct MatrixTypeMapper<const ColMajMatrix<T>> {
     typedef ColMajMatrix<T> OutType;
     typedef ColMajMatrix<T> MatrixType;
 };
+
+// Sparse inputs are projected into dense matrices
+template <typename T, int OptionsV, typename IndexT>
+struct MatrixTypeMapper<Eigen::SparseMatrix<T, OptionsV, IndexT>> {
+    typedef RowMajMatrix<T> OutType;
+    typedef RowMajMatrix<T> MatrixType;
+};
+
+template <typename T, int OptionsV, typename IndexT>
+struct MatrixTypeMapper<const Eigen::SparseMatrix<T, OptionsV, IndexT>> {
+    typedef RowMajMatrix<T> OutType;
+    typedef RowMajMatrix<T> MatrixType;
+};
 }  // namespace Details
 
 template<typename T>
@@ -246,6 +264,12 @@ struct InputMatrixTypeMapper<Eigen::Map<T>> {
     using MatrixType = typename std::remove_cv<T>::type;
 };
 
+template<typename T, int OptionsV, typename IndexT>
+struct InputMatrixTypeMapper<Eigen::Map<Eigen::SparseMatrix<T, OptionsV, IndexT>>> {
+    using OutType = typename Details::MatrixTypeMapper<Eigen::SparseMatrix<T, OptionsV, IndexT>>::OutType;
+    using MatrixType = typename Details::MatrixTypeMapper<Eigen::SparseMatrix<T, OptionsV, IndexT>>::MatrixType;
+};
+
 /////////////////////////////////////////////////////////////////////////
 ///  \struct        Traits
 ///  \brief         We have a range of of types we are dealing with. Many types
@@ -914,6 +938,56 @@ struct Traits<std::array<T, ArrayV>> : public TraitsImpl<std::array<T, ArrayV>>
     }
 };
 
+namespace Details {
+
+/////////////////////////////////////////////////////////////////////////
+///  \struct        IsBulkSerializable
+///  \brief         Types whose `Traits<T>::serialize` writes the in-memory
+///                 representation of the value; contiguous ranges of these
+///                 types are serialized with a single copy rather than one
+///                 item at a time (the serialized data is the same).
+///
+template <typename T> struct IsBulkSerializable : public std::false_type {};
+
+template <> struct IsBulkSerializable<std::int8_t> : public std::true_type {};
+template <> struct IsBulkSerializable<std::int16_t> : public std::true_type {};
+template <> struct IsBulkSerializable<std::int32_t> : public std::true_type {};
+template <> struct IsBulkSerializable<std::int64_t> : public std::true_type {};
+template <> struct IsBulkSerializable<std::uint8_t> : public std::true_type {};
+template <> struct IsBulkSerializable<std::uint16_t> : public std::true_type {};
+template <> struct IsBulkSerializable<std::uint32_t> : public std::true_type {};
+template <> struct IsBulkSerializable<std::uint64_t> : public std::true_type {};
+template <> struct IsBulkSerializable<float> : public std::true_type {};
+template <> struct IsBulkSerializable<double> : public std::true_type {};
+
+template <typename T, typename ArchiveT>
+void SerializeItems(ArchiveT &ar, T const *pItems, size_t cItems, std::true_type /*is_bulk_serializable*/) {
+    ar.serialize_array(pItems, cItems);
+}
+
+template <typename T, typename ArchiveT>
+void SerializeItems(ArchiveT &ar, T const *pItems, size_t cItems, std::false_type /*is_bulk_serializable*/) {
+    T const * const                         pEndItems(pItems + cItems);
+
+    while(pItems != pEndItems)
+        Traits<T>::serialize(ar, *pItems++);
+}
+
+template <typename T, typename ArchiveT>
+void DeserializeItems(ArchiveT &ar, T *pItems, size_t cItems, std::true_type /*is_bulk_serializable*/) {
+    ar.deserialize_array(pItems, cItems);
+}
+
+template <typename T, typename ArchiveT>
+void DeserializeItems(ArchiveT &ar, T *pItems, size_t cItems, std::false_type /*is_bulk_serializable*/) {
+    T * const                               pEndItems(pItems + cItems);
+
+    while(pItems != pEndItems)
+        *pItems++ = Traits<T>::deserialize(ar);
+}
+
+} // namespace Details
+
 template <typename T, typename AllocatorT>
 struct Traits<std::vector<T, AllocatorT>> : public TraitsImpl<std::vector<T, AllocatorT>> {
 
@@ -928,16 +1002,29 @@ struct Traits<std::vector<T, AllocatorT>> : public TraitsImpl<std::vector<T, All
     template <typename ArchiveT>
     static ArchiveT & serialize(ArchiveT &ar, std::vector<T, AllocatorT> const &value) {
         ar.serialize(static_cast<std::uint32_t>(value.size()));
-
-        for(auto const &item: value) {
-            Traits<T>::serialize(ar, item);
-        }
+        Details::SerializeItems(ar, value.data(), value.size(), Details::IsBulkSerializable<T>());
 
         return ar;
     }
 
     template <typename ArchiveT>
     static std::vector<T, AllocatorT> deserialize(ArchiveT &ar) {
+        return Traits::deserialize_impl(ar, Details::IsBulkSerializable<T>());
+    }
+
+private:
+    // ----------------------------------------------------------------------
+    // |  Private Methods
+    template <typename ArchiveT>
+    static std::vector<T, AllocatorT> deserialize_impl(ArchiveT &ar, std::true_type /*is_bulk_serializable*/) {
+        std::vector<T, AllocatorT>          result(ar.template deserialize<std::uint32_t>());
+
+        ar.deserialize_array(result.data(), result.size());
+        return result;
+    }
+
+    template <typename ArchiveT>
+    static std::vector<T, AllocatorT> deserialize_impl(ArchiveT &ar, std::false_type /*is_bulk_serializable*/) {
         std::vector<T, AllocatorT>          result;
         std::uint32_t                       size(ar.template deserialize<std::uint32_t>());
 
@@ -1141,11 +1228,8 @@ struct Traits<ColMajMatrix<T>> : public TraitsImpl<ColMajMatrix<T>> {
         ar.serialize(static_cast<typename MatrixT::Index>(value.rows()));
         ar.serialize(static_cast<typename MatrixT::Index>(value.cols()));
 
-        for(typename MatrixT::Index colId = 0; colId < value.cols(); ++colId) {
-            for(typename MatrixT::Index rowId = 0; rowId < value.rows(); ++rowId) {
-                Traits<typename MatrixT::Scalar>::serialize(ar, value(rowId, colId));
-            }
-        }
+        // Column-major storage order
+        Details::SerializeItems(ar, value.data(), static_cast<size_t>(value.size()), Details::IsBulkSerializable<T>());
 
         return ar;
     }
@@ -1159,11 +1243,7 @@ struct Traits<ColMajMatrix<T>> : public TraitsImpl<ColMajMatrix<T>> {
 
         MatrixT                                 result(numRows, numCols);
 
-        for(typename MatrixT::Index colId = 0; colId < numCols; ++colId) {
-            for(typename MatrixT::Index rowId = 0; rowId < numRows; ++rowId) {
-                result(rowId, colId) = Traits<typename MatrixT::Scalar>::deserialize(ar);
-            }
-        }
+        Details::DeserializeItems(ar, result.data(), static_cast<size_t>(result.size()), Details::IsBulkSerializable<T>());
 
         return result;
     }
@@ -1187,11 +1267,8 @@ struct Traits<RowMajMatrix<T>> : public TraitsImpl<RowMajMatrix<T>> {
         ar.serialize(static_cast<typename MatrixT::Index>(value.rows()));
         ar.serialize(static_cast<typename MatrixT::Index>(value.cols()));
 
-        for(typename MatrixT::Index rowId = 0; rowId < value.rows(); ++rowId) {
-            for(typename MatrixT::Index colId = 0; colId < value.cols(); ++colId) {
-                Traits<typename MatrixT::Scalar>::serialize(ar, value(rowId, colId));
-                }
-            }
+        // Row-major storage order
+        Details::SerializeItems(ar, value.data(), static_cast<size_t>(value.size()), Details::IsBulkSerializable<T>());
 
         return ar;
     }
@@ -1205,11 +1282,7 @@ struct Traits<RowMajMatrix<T>> : public TraitsImpl<RowMajMatrix<T>> {
 
         MatrixT                                 result(numRows, numCols);
 
-        for(typename MatrixT::Index rowId = 0; rowId < numRows; ++rowId) {
-            for(typename MatrixT::Index colId = 0; colId < numCols; ++colId) {
-                result(rowId, colId) = Traits<typename MatrixT::Scalar>::deserialize(ar);
-                }
-            }
+        Details::DeserializeItems(ar, result.data(), static_cast<size_t>(result.size()), Details::IsBulkSerializable<T>());
 
         return result;
      }
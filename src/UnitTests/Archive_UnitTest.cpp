@@ -177,6 +177,55 @@ TEST_CASE("Clone") {
     }
 }
 
+TEST_CASE("Extract") {
+    NS::Archive                             out;
+
+    out.serialize(10);
+    out.serialize(20);
+    out.serialize(30);
+
+    NS::Archive::ByteArray const            data(out.commit());
+
+    SECTION("Owned buffer") {
+        NS::Archive                         in(data);
+
+        CHECK(in.template deserialize<int>() == 10);
+
+        NS::Archive                         other(in.extract(sizeof(int)));
+
+        CHECK(in.template deserialize<int>() == 30);
+        CHECK(in.AtEnd());
+
+        CHECK(other.template deserialize<int>() == 20);
+        CHECK(other.AtEnd());
+    }
+
+    SECTION("Referenced buffer") {
+        std::unique_ptr<NS::Archive>        pOther;
+
+        {
+            NS::Archive::ByteArray          buffer(data);
+            NS::Archive                     in(buffer.data(), buffer.size());
+
+            pOther.reset(new NS::Archive(in.extract(2 * sizeof(int))));
+            CHECK(in.template deserialize<int>() == 30);
+        }
+
+        // The extracted data is valid after the original buffer is destroyed
+        CHECK(pOther->template deserialize<int>() == 10);
+        CHECK(pOther->template deserialize<int>() == 20);
+        CHECK(pOther->AtEnd());
+    }
+
+    SECTION("Errors") {
+        NS::Archive                         in(data);
+
+        CHECK_THROWS_WITH(in.extract(0), "cBytes");
+        CHECK_THROWS_WITH(in.extract(4 * sizeof(int)), "Invalid delta");
+        CHECK_THROWS_WITH(out.extract(1), "Invalid mode");
+    }
+}
+
 TEST_CASE("Clone and movement") {
     NS::Archive                             out;
 
@@ -217,3 +266,62 @@ TEST_CASE("Clone and movement") {
     CHECK(in2.Mode == NS::Archive::ModeValue::Deserializing);
     CHECK(movedIn3.Mode == NS::Archive::ModeValue::Deserializing);
 }
+
+TEST_CASE("Arrays") {
+    std::vector<double> const               values{ 1.0, -2.5, 3.25, 1e100 };
+    std::vector<std::int16_t> const         shorts{ 1, -2, 300 };
+
+    // Bulk serialization produces the same data as serializing each item
+    NS::Archive                             bulk;
+    NS::Archive                             items;
+
+    bulk.serialize(true);
+    bulk.serialize_array(values.data(), values.size());
+    bulk.serialize_array(shorts.data(), shorts.size());
+    bulk.serialize_array(static_cast<double const *>(nullptr), 0);
+
+    items.serialize(true);
+
+    for(auto const &value : values)
+        items.serialize(value);
+
+    for(auto const &value : shorts)
+        items.serialize(value);
+
+    NS::Archive::ByteArray const            data(bulk.commit());
+
+    CHECK(data == items.commit());
+
+    // The doubles aren't aligned in the buffer because of the leading bool
+    NS::Archive                             in(data);
+    std::vector<double>                     deserializedValues(values.size());
+    std::vector<std::int16_t>               deserializedShorts(shorts.size());
+
+    CHECK(in.deserialize<bool const>());
+    in.deserialize_array(deserializedValues.data(), deserializedValues.size());
+    in.deserialize_array(deserializedShorts.data(), deserializedShorts.size());
+    in.deserialize_array(static_cast<double *>(nullptr), 0);
+
+    CHECK(in.AtEnd());
+    CHECK(deserializedValues == values);
+    CHECK(deserializedShorts == shorts);
+}
+
+TEST_CASE("Array errors") {
+    std::int32_t                            values[3] = { 1, 2, 3 };
+    NS::Archive                             out;
+
+    CHECK_THROWS_WITH(out.serialize_array(static_cast<std::int32_t const *>(nullptr), 1), "Invalid items");
+    CHECK_THROWS_WITH(out.deserialize_array(values, 3), "Invalid mode");
+
+    out.serialize_array(values, 2);
+
+    NS::Archive                             in(out.commit());
+
+    CHECK_THROWS_WITH(in.deserialize_array(static_cast<std::int32_t *>(nullptr), 1), "Invalid items");
+    CHECK_THROWS_WITH(in.deserialize_array(values, 3), "Invalid buffer");
+
+    // The archive isn't modified when there isn't enough data
+    in.deserialize_array(values, 2);
+    CHECK(in.AtEnd());
+}
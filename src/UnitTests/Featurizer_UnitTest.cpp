@@ -404,3 +404,58 @@ TEST_CASE("TransformerEstimator - Movement and Names") {
         CHECK(reinterpret_cast<size_t>(estimator1.Name) == reinterpret_cast<size_t>(estimator2.Name)); // Since the memory was moved, the string buffer should be the same
     }
 }
+
+TEST_CASE("StandardTransformer - execute_batch") {
+    MyTransformerEstimator::MyTransformer   transformer;
+    int const                               inputs[] = { 1, 2, 3, 4, 5 };
+    bool                                    results[] = { false, true, false, true, false };
+
+    transformer.execute_batch(inputs, 5, results);
+
+    CHECK(results[0]);
+    CHECK(results[1] == false);
+    CHECK(results[2]);
+    CHECK(results[3] == false);
+    CHECK(results[4]);
+
+    // Empty batches are allowed
+    transformer.execute_batch(nullptr, 0, nullptr);
+
+    CHECK_THROWS_WITH(transformer.execute_batch(nullptr, 1, results), "pInput");
+    CHECK_THROWS_WITH(transformer.execute_batch(inputs, 1, nullptr), "pOutput");
+}
+
+// Transformed type that can be constructed but not assigned
+struct MyConstValue {
+    int const                               Value;
+
+    MyConstValue(int value) :
+        Value(value) {
+    }
+};
+
+class MyConstValueTransformer : public Microsoft::Featurizer::StandardTransformer<int, MyConstValue> {
+public:
+    MyConstValueTransformer(void) = default;
+    ~MyConstValueTransformer(void) override = default;
+
+    FEATURIZER_MOVE_CONSTRUCTOR_ONLY(MyConstValueTransformer);
+
+    void save(Microsoft::Featurizer::Archive &) const override {
+        // Nothing to do here
+    }
+
+private:
+    void execute_impl(int const &value, CallbackFunction const &callback) override {
+        callback(MyConstValue(value * 10));
+    }
+};
+
+TEST_CASE("StandardTransformer - non-assignable output") {
+    // `execute_batch` requires assignable output, but transformers whose output
+    // can't be assigned must still compile and execute one item at a time
+    MyConstValueTransformer                 transformer;
+
+    CHECK(transformer.execute(1).Value == 10);
+    CHECK(transformer.execute(3).Value == 30);
+}
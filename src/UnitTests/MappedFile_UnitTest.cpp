@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License
+// ----------------------------------------------------------------------
+#define CATCH_CONFIG_MAIN
+#include "catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+#include "../Archive.h"
+#include "../MappedFile.h"
+
+namespace NS                                = Microsoft::Featurizer;
+
+/// Writes the data to a file in the current directory that is removed when the
+/// instance is destroyed.
+class TempFile {
+public:
+    std::string const                       Filename;
+
+    TempFile(std::string filename, NS::Archive::ByteArray const &data) :
+        Filename(std::move(filename)) {
+        std::ofstream                       file(Filename, std::ios::binary);
+
+        file.write(reinterpret_cast<char const *>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+
+    ~TempFile(void) {
+        std::remove(Filename.c_str());
+    }
+};
+
+TEST_CASE("MapFile") {
+    NS::Archive                             out;
+
+    out.serialize(static_cast<std::uint32_t>(1234));
+    NS::Traits<std::vector<double>>::serialize(out, std::vector<double>{ 1.0, 2.0, 3.0 });
+
+    NS::Archive::ByteArray const            data(out.commit());
+    TempFile const                          file("MappedFile_UnitTest.bin", data);
+
+    size_t                                  cData(0);
+    NS::SharedDataPtr const                 pData(NS::MapFile(file.Filename, cData));
+
+    REQUIRE(pData);
+    CHECK(cData == data.size());
+    CHECK(NS::Archive::ByteArray(pData.get(), pData.get() + cData) == data);
+
+    // Deserialize directly from the mapped data
+    NS::Archive                             in(pData.get(), cData);
+
+    CHECK(in.deserialize<std::uint32_t>() == 1234);
+    CHECK(NS::Traits<std::vector<double>>::deserialize(in) == std::vector<double>{ 1.0, 2.0, 3.0 });
+    CHECK(in.AtEnd());
+}
+
+TEST_CASE("MapFile - missing file") {
+    size_t                                  cData(0);
+
+    CHECK(NS::MapFile("MappedFile_UnitTest.does_not_exist", cData) == nullptr);
+    CHECK(cData == 0);
+}
+
+TEST_CASE("MapFile - empty file") {
+    TempFile const                          file("MappedFile_UnitTest.empty", NS::Archive::ByteArray());
+    size_t                                  cData(0);
+
+    CHECK_THROWS_WITH(NS::MapFile(file.Filename, cData), "The file is empty");
+}
+
+TEST_CASE("MapFile - not a file") {
+    size_t                                  cData(0);
+
+    // Failures other than a missing file report the OS error
+    CHECK_THROWS_AS(NS::MapFile(".", cData), std::system_error);
+    CHECK(cData == 0);
+}
@@ -80,6 +80,17 @@ void ParseRegexTest(std::string const & input,
         }
     );
     CHECK(output2 == label);
+
+    re2::RE2 const regex(token);
+    std::vector<std::string> output3;
+    ParseRegex(
+        input,
+        regex,
+        [&output3] (std::string::const_iterator iterBegin, std::string::const_iterator iterEnd) {
+            output3.emplace_back(std::string(iterBegin, iterEnd));
+        }
+    );
+    CHECK(output3 == label);
 }
 
 void ParseNgramWordTest(std::string & input,
@@ -200,6 +211,12 @@ TEST_CASE("ParseRegex") {
     ParseRegexTest(" this is   a document", {"this", "is", "a", "document"});
     ParseRegexTest(" this is a document ", {"this", "is", "a", "document"});
     ParseRegexTest(" this   is a   document  ", {"this", "is", "a", "document"});
+
+    // Patterns that can match an empty string
+    ParseRegexTest("this is a document", {"this", "is", "a", "document"}, "[^\\s]*");
+    ParseRegexTest("ab", {}, "x*");
+    ParseRegexTest("axxb", {"xx"}, "x*");
+    ParseRegexTest("   ", {}, "");
 }
 
 TEST_CASE("ParseNgramWord") {